@@ -0,0 +1,44 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/AdaptiveLatency.h"
+
+#include <algorithm>
+
+namespace AudioCommon
+{
+AdaptiveLatency::AdaptiveLatency(u32 min_frames, u32 max_frames, u32 step_frames)
+    : m_min_frames(min_frames), m_max_frames(std::max(min_frames, max_frames)),
+      m_step_frames(std::max(step_frames, 1u)), m_frames(min_frames)
+{
+}
+
+bool AdaptiveLatency::OnUnderrun(TimePoint now)
+{
+  ++m_underrun_count;
+  m_stable_since = now;
+
+  if (m_frames >= m_max_frames || now - m_last_grow < GROW_HOLDOFF)
+    return false;
+
+  m_frames = std::min(m_frames + m_step_frames, m_max_frames);
+  m_last_grow = now;
+  return true;
+}
+
+bool AdaptiveLatency::Update(TimePoint now)
+{
+  if (m_stable_since == TimePoint{})
+  {
+    m_stable_since = now;
+    return false;
+  }
+
+  if (m_frames <= m_min_frames || now - m_stable_since < STABLE_TIME)
+    return false;
+
+  m_frames -= std::min(m_step_frames, m_frames - m_min_frames);
+  m_stable_since = now;
+  return true;
+}
+}  // namespace AudioCommon
@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// Picks how many frames an audio backend keeps queued. It starts at the configured minimum, grows
+// by a step when the backend runs dry, and shrinks back by a step after playing without running
+// dry for a while, so that the latency settles just above what the host can keep up with.
+class AdaptiveLatency final
+{
+public:
+  // How long playback has to go without an underrun before the latency is lowered again.
+  static constexpr DT STABLE_TIME = std::chrono::seconds(10);
+  // Underruns this soon after growing are still from before the new size took effect.
+  static constexpr DT GROW_HOLDOFF = std::chrono::milliseconds(100);
+
+  AdaptiveLatency(u32 min_frames, u32 max_frames, u32 step_frames);
+
+  u32 GetFrames() const { return m_frames; }
+  u64 GetUnderrunCount() const { return m_underrun_count; }
+
+  // Both return true if GetFrames() changed.
+  bool OnUnderrun(TimePoint now);
+  bool Update(TimePoint now);
+
+private:
+  u32 m_min_frames;
+  u32 m_max_frames;
+  u32 m_step_frames;
+  u32 m_frames;
+
+  u64 m_underrun_count = 0;
+  // Since when playback has gone without an underrun, unset until the first Update.
+  TimePoint m_stable_since{};
+  TimePoint m_last_grow{};
+};
+}  // namespace AudioCommon
@@ -150,7 +150,8 @@ bool SupportsDPL2Decoder(std::string_view backend)
 
 bool SupportsLatencyControl(std::string_view backend)
 {
-  return backend == BACKEND_OPENAL || backend == BACKEND_WASAPI;
+  return backend == BACKEND_NULLSOUND || backend == BACKEND_OPENAL ||
+         backend == BACKEND_PULSEAUDIO || backend == BACKEND_WASAPI;
 }
 
 bool SupportsVolumeChanges(std::string_view backend)
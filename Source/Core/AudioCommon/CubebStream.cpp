@@ -3,6 +3,9 @@
 
 #include "AudioCommon/CubebStream.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include <cubeb/cubeb.h>
 
 #include "AudioCommon/CubebUtils.h"
@@ -90,10 +93,21 @@ bool CubebStream::Init()
         ERROR_LOG_FMT(AUDIO, "Error getting minimum latency");
       INFO_LOG_FMT(AUDIO, "Minimum latency: {} frames", minimum_latency);
 
+      const u32 latency = std::max(BUFFER_SAMPLES, minimum_latency);
       return_value =
           cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr, nullptr,
-                            nullptr, &params, std::max(BUFFER_SAMPLES, minimum_latency),
-                            DataCallback, StateCallback, this) == CUBEB_OK;
+                            nullptr, &params, latency, DataCallback, StateCallback,
+                            this) == CUBEB_OK;
+
+      if (return_value)
+      {
+        // Not every cubeb backend knows how much latency the device adds on top.
+        u32 stream_latency = 0;
+        if (cubeb_stream_get_latency(m_stream, &stream_latency) != CUBEB_OK)
+          stream_latency = latency;
+        m_mixer->SetBackendLatency(std::chrono::duration_cast<DT>(
+            DT_s(static_cast<double>(stream_latency) / params.rate)));
+      }
     }
 
 #ifdef _WIN32
@@ -12,4 +12,14 @@ enum class DPL2Quality : int
   High = 2,
   Highest = 3
 };
+
+enum class ResamplingQuality : int
+{
+  // 6-point Hermite interpolation
+  Lowest = 0,
+  // Polyphase windowed sinc filters with 8, 16 and 32 taps
+  Low = 1,
+  High = 2,
+  Highest = 3
+};
 }  // namespace AudioCommon
@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "AudioCommon/Enums.h"
+#include "AudioCommon/PolyphaseFilter.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -16,6 +17,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/System.h"
+#include "VideoCommon/PerformanceMetrics.h"
 
 static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 {
@@ -46,6 +48,17 @@ Mixer::Mixer(u32 BackendSampleRate)
 Mixer::~Mixer()
 {
   Config::RemoveConfigChangedCallback(m_config_changed_callback_id);
+
+  const MixStats stats = GetMixStats();
+  if (stats.mixed_samples != 0)
+  {
+    const DT_s mixed_audio = DT_s(static_cast<double>(stats.mixed_samples) / m_output_sample_rate);
+    INFO_LOG_FMT(AUDIO_INTERFACE,
+                 "Mixing took {:.2f}% of the audio thread's time, {:.3f} ms at most per callback",
+                 100.0 * DT_s(stats.total_time) / mixed_audio, DT_ms(stats.peak_time).count());
+  }
+  if (stats.underruns != 0)
+    INFO_LOG_FMT(AUDIO_INTERFACE, "The audio backend ran dry {} times", stats.underruns);
 }
 
 void Mixer::DoState(PointerWrap& p)
@@ -95,6 +108,17 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 
   m_granule_queue_size.store(buffer_size_granules, std::memory_order_relaxed);
 
+  // Only look up the filter again when the quality or the ratio has changed, the filters for the
+  // common ratios are built ahead of time by RefreshConfig.
+  const AudioCommon::ResamplingQuality quality = m_mixer->m_config_resampling_quality;
+  const double ratio = out_sample_rate / in_sample_rate;
+  if (quality != m_filter_quality || ratio != m_filter_ratio)
+  {
+    m_filter = AudioCommon::GetResamplingFilter(quality, ratio);
+    m_filter_quality = quality;
+    m_filter_ratio = ratio;
+  }
+
   while (num_samples-- > 0)
   {
     // The indexes for the front and back buffers are offset by 50% of the granule size.
@@ -113,28 +137,37 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
     // The Granules are pre-windowed, so we can just add them together
     const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
     const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
-    const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
-    const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
-    const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
-    const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
-    const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
-    const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
-
-    // Polynomial Interpolators for High-Quality Resampling of
-    // Over Sampled Audio by Olli Niemitalo, October 2001.
-    // Page 43 -- 6-point, 3rd-order Hermite:
-    // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
     const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
     const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
-    const float t2 = t1 * t1;
-    const float t3 = t2 * t1;
 
-    StereoPair sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
-                         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
-                         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
-                         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
-                         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
-                         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
+    StereoPair sample;
+    if (m_filter)
+    {
+      sample = ApplyFilter(*m_filter, ft, bt, t1);
+    }
+    else
+    {
+      const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
+      const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
+      const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
+      const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
+      const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
+      const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
+
+      // Polynomial Interpolators for High-Quality Resampling of
+      // Over Sampled Audio by Olli Niemitalo, October 2001.
+      // Page 43 -- 6-point, 3rd-order Hermite:
+      // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
+      const float t2 = t1 * t1;
+      const float t3 = t2 * t1;
+
+      sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
+                s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
+                s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
+                s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
+                s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
+                s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
+    }
 
     // Apply Fade In / Fade Out depending on if we are looping
     if (m_queue_looping.load(std::memory_order_relaxed))
@@ -158,11 +191,43 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
   }
 }
 
+Mixer::MixerFifo::StereoPair
+Mixer::MixerFifo::ApplyFilter(const AudioCommon::PolyphaseFilter& filter, std::size_t ft,
+                              std::size_t bt, float t) const
+{
+  const std::size_t taps = filter.GetTaps();
+  const std::size_t front_start = (ft - (taps / 2 - 1)) & GRANULE_MASK;
+  const std::size_t back_start = (bt - (taps / 2 - 1)) & GRANULE_MASK;
+
+  const StereoPair* front = &m_front[front_start];
+  const StereoPair* back = &m_back[back_start];
+
+  // The filter needs the samples in one piece, so copy them out when they wrap around the end of
+  // a granule.
+  std::array<StereoPair, AudioCommon::PolyphaseFilter::MAX_TAPS> front_copy, back_copy;
+  if (front_start + taps > GRANULE_SIZE || back_start + taps > GRANULE_SIZE)
+  {
+    for (std::size_t i = 0; i < taps; ++i)
+    {
+      front_copy[i] = m_front[(front_start + i) & GRANULE_MASK];
+      back_copy[i] = m_back[(back_start + i) & GRANULE_MASK];
+    }
+    front = front_copy.data();
+    back = back_copy.data();
+  }
+
+  StereoPair sample;
+  filter.Apply(&front->l, &back->l, t, &sample.l, &sample.r);
+  return sample;
+}
+
 std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
 {
   if (!samples)
     return 0;
 
+  const TimePoint start = Clock::now();
+
   memset(samples, 0, num_samples * 2 * sizeof(s16));
 
   m_dma_mixer.Mix(samples, num_samples);
@@ -172,9 +237,70 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   for (auto& mixer : m_gba_mixers)
     mixer.Mix(samples, num_samples);
 
+  const TimePoint end = Clock::now();
+  const u64 elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  m_mix_time.fetch_add(elapsed, std::memory_order_relaxed);
+  if (elapsed > m_peak_mix_time.load(std::memory_order_relaxed))
+    m_peak_mix_time.store(elapsed, std::memory_order_relaxed);
+  m_mixed_samples.fetch_add(num_samples, std::memory_order_relaxed);
+  const DT queued_time = m_dma_mixer.GetQueuedTime();
+  m_queued_time.store(std::chrono::duration_cast<std::chrono::nanoseconds>(queued_time).count(),
+                      std::memory_order_relaxed);
+
+  ReportStats(end);
+
   return num_samples;
 }
 
+void Mixer::CountUnderrun()
+{
+  m_underruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Mixer::SetBackendLatency(DT latency)
+{
+  m_backend_latency.store(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count(),
+                          std::memory_order_relaxed);
+}
+
+void Mixer::ReportStats(TimePoint now)
+{
+  constexpr DT REPORT_INTERVAL = std::chrono::milliseconds(500);
+
+  const u64 mix_time = m_mix_time.load(std::memory_order_relaxed);
+  if (m_last_report_time == TimePoint{})
+  {
+    m_last_report_time = now;
+    m_last_report_mix_time = mix_time;
+    return;
+  }
+
+  const DT interval = now - m_last_report_time;
+  if (interval < REPORT_INTERVAL)
+    return;
+
+  const MixStats stats = GetMixStats();
+  const DT mix_time_delta = std::chrono::nanoseconds(mix_time - m_last_report_mix_time);
+  g_perf_metrics.SetAudioState(stats.queued_time + stats.backend_latency, stats.underruns,
+                               DT_s(mix_time_delta) / DT_s(interval));
+
+  m_last_report_time = now;
+  m_last_report_mix_time = mix_time;
+}
+
+Mixer::MixStats Mixer::GetMixStats() const
+{
+  MixStats stats;
+  stats.total_time = std::chrono::nanoseconds(m_mix_time.load(std::memory_order_relaxed));
+  stats.peak_time = std::chrono::nanoseconds(m_peak_mix_time.load(std::memory_order_relaxed));
+  stats.mixed_samples = m_mixed_samples.load(std::memory_order_relaxed);
+  stats.underruns = m_underruns.load(std::memory_order_relaxed);
+  stats.queued_time = std::chrono::nanoseconds(m_queued_time.load(std::memory_order_relaxed));
+  stats.backend_latency =
+      std::chrono::nanoseconds(m_backend_latency.load(std::memory_order_relaxed));
+  return stats;
+}
+
 std::size_t Mixer::MixSurround(float* samples, std::size_t num_samples)
 {
   if (!num_samples)
@@ -413,6 +539,14 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_fill_audio_gaps = Config::Get(Config::MAIN_AUDIO_FILL_GAPS);
   m_config_audio_buffer_ms = Config::Get(Config::MAIN_AUDIO_BUFFER_SIZE);
+  m_config_resampling_quality = Config::Get(Config::MAIN_AUDIO_RESAMPLING_QUALITY);
+
+  // Build the filters for the usual input sample rates here rather than on the audio thread.
+  for (const u32 input_sample_rate : {32000, 48000})
+  {
+    AudioCommon::GetResamplingFilter(m_config_resampling_quality,
+                                     static_cast<double>(m_output_sample_rate) / input_sample_rate);
+  }
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -443,6 +577,19 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
   return std::make_pair(m_LVolume.load(), m_RVolume.load());
 }
 
+DT Mixer::MixerFifo::GetQueuedTime() const
+{
+  const std::size_t head = m_queue_head.load(std::memory_order_acquire);
+  const std::size_t tail = m_queue_tail.load(std::memory_order_acquire);
+  const std::size_t queued_granules = (head - tail) & GRANULE_QUEUE_MASK;
+
+  // The granules overlap by half, so each one only adds GRANULE_OVERLAP samples.
+  const u64 queued_samples = queued_granules * GRANULE_OVERLAP;
+  return std::chrono::duration_cast<DT>(DT_s(static_cast<double>(queued_samples) *
+                                             m_input_sample_rate_divisor /
+                                             FIXED_SAMPLE_RATE_DIVIDEND));
+}
+
 void Mixer::MixerFifo::Enqueue()
 {
   // import numpy as np
@@ -6,7 +6,9 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <memory>
 
+#include "AudioCommon/Enums.h"
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
@@ -14,6 +16,11 @@
 
 class PointerWrap;
 
+namespace AudioCommon
+{
+class PolyphaseFilter;
+}
+
 class Mixer final
 {
 public:
@@ -25,6 +32,9 @@ public:
   // Called from audio threads
   std::size_t Mix(s16* samples, std::size_t numSamples);
   std::size_t MixSurround(float* samples, std::size_t num_samples);
+  // For backends that can tell when they ran dry and how much they keep queued after mixing.
+  void CountUnderrun();
+  void SetBackendLatency(DT latency);
 
   // Called from main thread
   void PushSamples(const s16* samples, std::size_t num_samples);
@@ -50,6 +60,20 @@ public:
   void StartLogDSPAudio(const std::string& filename);
   void StopLogDSPAudio();
 
+  // How long the audio thread has spent mixing and resampling so far, and how far the output lags
+  // behind the emulated audio, for performance stats.
+  struct MixStats
+  {
+    DT total_time{};
+    DT peak_time{};
+    u64 mixed_samples = 0;
+    u64 underruns = 0;
+    // The DSP audio queued in the mixer, and the output queued in the backend.
+    DT queued_time{};
+    DT backend_latency{};
+  };
+  MixStats GetMixStats() const;
+
   // 54000000 doesn't work here as it doesn't evenly divide with 32000, but 108000000 does
   static constexpr u64 FIXED_SAMPLE_RATE_DIVIDEND = 54000000 * 2;
 
@@ -108,6 +132,7 @@ private:
     u32 GetInputSampleRateDivisor() const;
     void SetVolume(u32 lvolume, u32 rvolume);
     std::pair<s32, s32> GetVolume() const;
+    DT GetQueuedTime() const;
 
   private:
     Mixer* m_mixer;
@@ -129,15 +154,23 @@ private:
 
     void Enqueue();
     void Dequeue(Granule* granule);
+    StereoPair ApplyFilter(const AudioCommon::PolyphaseFilter& filter, std::size_t ft,
+                           std::size_t bt, float t) const;
 
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
 
     StereoPair m_quantization_error;
+
+    // The filter for the current resampling quality and ratio, if it isn't the Hermite one.
+    std::shared_ptr<const AudioCommon::PolyphaseFilter> m_filter;
+    AudioCommon::ResamplingQuality m_filter_quality{};
+    double m_filter_ratio = 0.0;
   };
 
   void RefreshConfig();
+  void ReportStats(TimePoint now);
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -160,6 +193,19 @@ private:
   float m_config_emulation_speed;
   bool m_config_fill_audio_gaps;
   int m_config_audio_buffer_ms;
+  AudioCommon::ResamplingQuality m_config_resampling_quality;
+
+  // Written by the audio thread only, in nanoseconds.
+  std::atomic<u64> m_mix_time{0};
+  std::atomic<u64> m_peak_mix_time{0};
+  std::atomic<u64> m_mixed_samples{0};
+  std::atomic<u64> m_underruns{0};
+  std::atomic<u64> m_queued_time{0};
+  std::atomic<u64> m_backend_latency{0};
+
+  // When the stats were last handed to the performance overlay, and the mixing time back then.
+  TimePoint m_last_report_time{};
+  u64 m_last_report_mix_time = 0;
 
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
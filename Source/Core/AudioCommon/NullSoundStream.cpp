@@ -3,16 +3,124 @@
 
 #include "AudioCommon/NullSoundStream.h"
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/Config/MainSettings.h"
+
+namespace
+{
+constexpr u32 MIN_BUFFER_SAMPLES = 256;
+constexpr u32 MAX_BUFFER_SAMPLES = 8192;
+constexpr u32 BUFFER_STEP_SAMPLES = 256;
+}  // namespace
+
+NullSound::NullSound() = default;
+
+NullSound::~NullSound()
+{
+  if (!m_thread.joinable())
+    return;
+
+  m_run_thread.Clear();
+  m_thread.join();
+}
+
 bool NullSound::Init()
 {
+  const u32 sample_rate = m_mixer->GetSampleRate();
+  const u32 latency_samples = Config::Get(Config::MAIN_AUDIO_LATENCY) * sample_rate / 1000;
+  m_latency.emplace(std::max(latency_samples, MIN_BUFFER_SAMPLES), MAX_BUFFER_SAMPLES,
+                    BUFFER_STEP_SAMPLES);
+
+  const std::string path = Config::Get(Config::MAIN_AUDIO_NULL_OUTPUT_PATH);
+  if (!path.empty())
+  {
+    // The path is set on purpose, so replace the last output rather than asking about it.
+    File::Delete(path);
+    m_write_file = m_wave_writer.Start(path, Mixer::FIXED_SAMPLE_RATE_DIVIDEND / sample_rate);
+    if (m_write_file)
+      NOTICE_LOG_FMT(AUDIO, "Null audio backend writing to {}", path);
+  }
+
+  m_run_thread.Set();
+  m_thread = std::thread(&NullSound::SoundLoop, this);
   return true;
 }
 
 bool NullSound::SetRunning(bool running)
 {
+  if (running)
+    m_running.Set();
+  else
+    m_running.Clear();
   return true;
 }
 
 void NullSound::SetVolume(int volume)
 {
 }
+
+// Called on audio thread.
+void NullSound::SoundLoop()
+{
+  Common::SetCurrentThreadName("Audio thread - null");
+
+  const u32 sample_rate = m_mixer->GetSampleRate();
+  const auto frames_to_time = [sample_rate](u32 frames) {
+    return std::chrono::duration_cast<DT>(DT_s(static_cast<double>(frames) / sample_rate));
+  };
+
+  std::vector<s16> buffer(MAX_BUFFER_SAMPLES * 2);
+  // When the imaginary device would run out of samples to play, unset while not running.
+  TimePoint queued_until{};
+
+  while (m_run_thread.IsSet())
+  {
+    if (!m_running.IsSet())
+    {
+      queued_until = TimePoint{};
+      Common::SleepCurrentThread(10);
+      continue;
+    }
+
+    const TimePoint now = Clock::now();
+    if (queued_until == TimePoint{})
+    {
+      queued_until = now;
+    }
+    else if (now > queued_until)
+    {
+      m_mixer->CountUnderrun();
+      if (m_latency->OnUnderrun(now))
+        WARN_LOG_FMT(AUDIO, "Null audio underrun, new latency: {} frames", m_latency->GetFrames());
+      queued_until = now;
+    }
+    else
+    {
+      m_latency->Update(now);
+    }
+
+    // Top the device up to the target latency.
+    const u32 queued_frames = static_cast<u32>(DT_s(queued_until - now).count() * sample_rate);
+    const u32 target_frames = m_latency->GetFrames();
+    if (queued_frames < target_frames)
+    {
+      const u32 frames = target_frames - queued_frames;
+      m_mixer->Mix(buffer.data(), frames);
+      if (m_write_file)
+        m_wave_writer.AddStereoSamples(buffer.data(), frames);
+      queued_until += frames_to_time(frames);
+    }
+    m_mixer->SetBackendLatency(queued_until - now);
+
+    // Wake up again when half of the target latency has been played.
+    std::this_thread::sleep_for(frames_to_time(target_frames / 2));
+  }
+}
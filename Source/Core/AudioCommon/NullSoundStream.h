@@ -3,14 +3,37 @@
 
 #pragma once
 
+#include <optional>
+#include <thread>
+
+#include "AudioCommon/AdaptiveLatency.h"
 #include "AudioCommon/SoundStream.h"
+#include "AudioCommon/WaveFile.h"
+#include "Common/Flag.h"
 
+// Pulls from the mixer in real time like an audio device would, but plays to nowhere, or to the
+// WAV file at Config::MAIN_AUDIO_NULL_OUTPUT_PATH if it is set. This keeps the mixer, the latency
+// and the underrun stats working without any audio hardware.
 class NullSound final : public SoundStream
 {
 public:
+  NullSound();
+  ~NullSound() override;
+
   bool Init() override;
   bool SetRunning(bool running) override;
   void SetVolume(int volume) override;
 
   static bool IsValid() { return true; }
+
+private:
+  void SoundLoop();
+
+  std::thread m_thread;
+  Common::Flag m_run_thread;
+  Common::Flag m_running;
+
+  std::optional<AudioCommon::AdaptiveLatency> m_latency;
+  WaveFileWriter m_wave_writer;
+  bool m_write_file = false;
 };
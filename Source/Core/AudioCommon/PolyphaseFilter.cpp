@@ -0,0 +1,175 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/PolyphaseFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <utility>
+
+#include "Common/Assert.h"
+
+#if defined(_M_X86_64)
+#include <immintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace AudioCommon
+{
+namespace
+{
+struct FilterSettings
+{
+  u32 taps;
+  double kaiser_beta;
+  // Where the filter cuts off, relative to the Nyquist frequency of the lower sample rate.
+  double passband;
+};
+
+FilterSettings GetFilterSettings(ResamplingQuality quality)
+{
+  switch (quality)
+  {
+  case ResamplingQuality::Low:
+    return {8, 5.0, 0.80};
+  case ResamplingQuality::Highest:
+    return {32, 9.0, 0.93};
+  default:
+    return {16, 7.0, 0.88};
+  }
+}
+
+// The zeroth order modified Bessel function of the first kind, for the Kaiser window.
+double BesselI0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; term > sum * 1e-12; ++k)
+  {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+}  // namespace
+
+PolyphaseFilter::PolyphaseFilter(u32 taps, double cutoff, double kaiser_beta) : m_taps(taps)
+{
+  ASSERT(taps % 2 == 0 && taps <= MAX_TAPS);
+
+  const double half_width = taps / 2.0;
+  const double window_scale = 1.0 / BesselI0(kaiser_beta);
+
+  m_coefficients.resize((PHASES + 1) * taps * 2);
+  for (u32 phase = 0; phase <= PHASES; ++phase)
+  {
+    float* const coefficients = &m_coefficients[phase * taps * 2];
+
+    double sum = 0.0;
+    for (u32 tap = 0; tap < taps; ++tap)
+    {
+      // The distance from the output sample, which never exceeds half_width.
+      const double distance = tap - (half_width - 1) - static_cast<double>(phase) / PHASES;
+      const double x = distance / half_width;
+      const double window = BesselI0(kaiser_beta * std::sqrt(std::max(0.0, 1 - x * x)));
+      const double arg = std::numbers::pi * cutoff * distance;
+      const double sinc = arg == 0.0 ? 1.0 : std::sin(arg) / arg;
+
+      const double coefficient = cutoff * sinc * window * window_scale;
+      coefficients[tap * 2] = static_cast<float>(coefficient);
+      sum += coefficient;
+    }
+
+    // Keep every phase at unity gain for DC, so that the phases can't be heard as ripple.
+    for (u32 tap = 0; tap < taps; ++tap)
+    {
+      coefficients[tap * 2] = static_cast<float>(coefficients[tap * 2] / sum);
+      coefficients[tap * 2 + 1] = coefficients[tap * 2];
+    }
+  }
+}
+
+void PolyphaseFilter::Apply(const float* first, const float* second, float fraction, float* left,
+                            float* right) const
+{
+  // Interpolate between the two nearest phases, which both get applied in the same pass.
+  const float position = fraction * PHASES;
+  const u32 phase = std::min(static_cast<u32>(position), PHASES - 1);
+  const float weight = position - phase;
+  const float* const coefficients0 = &m_coefficients[phase * m_taps * 2];
+  const float* const coefficients1 = coefficients0 + m_taps * 2;
+  const u32 count = m_taps * 2;
+
+#if defined(_M_X86_64)
+  __m128 sum0 = _mm_setzero_ps();
+  __m128 sum1 = _mm_setzero_ps();
+  for (u32 i = 0; i < count; i += 4)
+  {
+    const __m128 samples = _mm_add_ps(_mm_loadu_ps(first + i), _mm_loadu_ps(second + i));
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(samples, _mm_loadu_ps(coefficients0 + i)));
+    sum1 = _mm_add_ps(sum1, _mm_mul_ps(samples, _mm_loadu_ps(coefficients1 + i)));
+  }
+  __m128 sum = _mm_add_ps(sum0, _mm_mul_ps(_mm_sub_ps(sum1, sum0), _mm_set1_ps(weight)));
+  // Add the two stereo pairs together.
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  *left = _mm_cvtss_f32(sum);
+  *right = _mm_cvtss_f32(_mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+#elif defined(_M_ARM_64)
+  float32x4_t sum0 = vdupq_n_f32(0.0f);
+  float32x4_t sum1 = vdupq_n_f32(0.0f);
+  for (u32 i = 0; i < count; i += 4)
+  {
+    const float32x4_t samples = vaddq_f32(vld1q_f32(first + i), vld1q_f32(second + i));
+    sum0 = vfmaq_f32(sum0, samples, vld1q_f32(coefficients0 + i));
+    sum1 = vfmaq_f32(sum1, samples, vld1q_f32(coefficients1 + i));
+  }
+  const float32x4_t sum = vfmaq_n_f32(sum0, vsubq_f32(sum1, sum0), weight);
+  // Add the two stereo pairs together.
+  const float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+  *left = vget_lane_f32(pair, 0);
+  *right = vget_lane_f32(pair, 1);
+#else
+  float sum0[2] = {};
+  float sum1[2] = {};
+  for (u32 i = 0; i < count; ++i)
+  {
+    const float sample = first[i] + second[i];
+    sum0[i & 1] += sample * coefficients0[i];
+    sum1[i & 1] += sample * coefficients1[i];
+  }
+  *left = sum0[0] + (sum1[0] - sum0[0]) * weight;
+  *right = sum0[1] + (sum1[1] - sum0[1]) * weight;
+#endif
+}
+
+std::shared_ptr<const PolyphaseFilter> GetResamplingFilter(ResamplingQuality quality,
+                                                           double ratio)
+{
+  if (quality == ResamplingQuality::Lowest)
+    return nullptr;
+
+  // Upsampling only has to filter out the images above the input Nyquist frequency, so every
+  // upsampling ratio shares the same filter. Downsampling ratios are rounded down a little so
+  // that changing the emulation speed doesn't build a new filter for every possible value.
+  constexpr u32 RATIO_STEPS = 256;
+  const u32 ratio_key = static_cast<u32>(std::clamp(ratio, 1.0 / RATIO_STEPS, 1.0) * RATIO_STEPS);
+
+  static std::mutex s_filters_lock;
+  static std::map<std::pair<ResamplingQuality, u32>, std::shared_ptr<const PolyphaseFilter>>
+      s_filters;
+
+  std::lock_guard lk(s_filters_lock);
+  auto& filter = s_filters[{quality, ratio_key}];
+  if (!filter)
+  {
+    const FilterSettings settings = GetFilterSettings(quality);
+    const double cutoff = settings.passband * ratio_key / RATIO_STEPS;
+    filter = std::make_shared<PolyphaseFilter>(settings.taps, cutoff, settings.kaiser_beta);
+  }
+  return filter;
+}
+}  // namespace AudioCommon
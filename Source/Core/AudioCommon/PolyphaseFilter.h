@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "AudioCommon/Enums.h"
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// A Kaiser windowed sinc low-pass filter for resampling, precomputed for PHASES + 1 positions
+// between two input samples. Every coefficient is stored twice in a row, so that a phase can be
+// applied to interleaved stereo samples as they are.
+class PolyphaseFilter final
+{
+public:
+  static constexpr u32 PHASES = 128;
+  static constexpr u32 MAX_TAPS = 32;
+
+  // cutoff is relative to the input Nyquist frequency.
+  PolyphaseFilter(u32 taps, double cutoff, double kaiser_beta);
+
+  u32 GetTaps() const { return m_taps; }
+
+  // Filters the sums of taps interleaved stereo samples from first and second into the sample at
+  // fraction (between 0 and 1) past sample taps / 2 - 1.
+  void Apply(const float* first, const float* second, float fraction, float* left,
+             float* right) const;
+
+private:
+  u32 m_taps;
+  std::vector<float> m_coefficients;
+};
+
+// Returns the filter for the given quality and ratio of the output to the input sample rate,
+// building it first if no mixer has used it before. Returns nullptr for ResamplingQuality::Lowest,
+// which uses Hermite interpolation instead.
+std::shared_ptr<const PolyphaseFilter> GetResamplingFilter(ResamplingQuality quality,
+                                                           double ratio);
+}  // namespace AudioCommon
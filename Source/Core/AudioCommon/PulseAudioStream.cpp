@@ -1,6 +1,8 @@
 // Copyright 2009 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 
 #include "AudioCommon/PulseAudioStream.h"
@@ -13,7 +15,9 @@
 
 namespace
 {
-const size_t BUFFER_SAMPLES = 512;  // ~10 ms - needs to be at least 240 for surround
+constexpr u32 MIN_BUFFER_SAMPLES = 256;  // ~5 ms - needs to be at least 240 for surround
+constexpr u32 MAX_BUFFER_SAMPLES = 8192;
+constexpr u32 BUFFER_STEP_SAMPLES = 256;
 }
 
 PulseAudio::PulseAudio() = default;
@@ -110,15 +114,18 @@ bool PulseAudio::PulseInit()
   pa_stream_set_write_callback(m_pa_s, WriteCallback, this);
   pa_stream_set_underflow_callback(m_pa_s, UnderflowCallback, this);
 
+  // start at the configured latency, which grows on underflows and shrinks back when stable
+  const u32 latency_samples = Config::Get(Config::MAIN_AUDIO_LATENCY) * ss.rate / 1000;
+  m_latency.emplace(std::max(latency_samples, MIN_BUFFER_SAMPLES), MAX_BUFFER_SAMPLES,
+                    BUFFER_STEP_SAMPLES);
+
   // connect this audio stream to the default audio playback
   // limit buffersize to reduce latency
   m_pa_ba.fragsize = -1;
   m_pa_ba.maxlength = -1;  // max buffer, so also max latency
   m_pa_ba.minreq = -1;     // don't read every byte, try to group them _a bit_
   m_pa_ba.prebuf = -1;     // start as early as possible
-  m_pa_ba.tlength =
-      BUFFER_SAMPLES * m_channels *
-      m_bytespersample;  // designed latency, only change this flag for low latency output
+  m_pa_ba.tlength = m_latency->GetFrames() * m_channels * m_bytespersample;  // designed latency
   pa_stream_flags flags = pa_stream_flags(PA_STREAM_INTERPOLATE_TIMING | PA_STREAM_ADJUST_LATENCY |
                                           PA_STREAM_AUTO_TIMING_UPDATE);
   m_pa_error = pa_stream_connect_playback(m_pa_s, nullptr, &m_pa_ba, flags, nullptr, nullptr);
@@ -155,18 +162,38 @@ void PulseAudio::StateCallback(pa_context* c)
     break;
   }
 }
-// on underflow, increase pulseaudio latency in ~10ms steps
-void PulseAudio::UnderflowCallback(pa_stream* s)
+void PulseAudio::UpdateBufferAttr(pa_stream* s)
 {
-  m_pa_ba.tlength += BUFFER_SAMPLES * m_channels * m_bytespersample;
+  m_pa_ba.tlength = m_latency->GetFrames() * m_channels * m_bytespersample;
   pa_operation* op = pa_stream_set_buffer_attr(s, &m_pa_ba, nullptr, nullptr);
   pa_operation_unref(op);
+}
+
+// on underflow, increase pulseaudio latency in ~5ms steps
+void PulseAudio::UnderflowCallback(pa_stream* s)
+{
+  m_mixer->CountUnderrun();
+  if (!m_latency->OnUnderrun(Clock::now()))
+    return;
 
-  WARN_LOG_FMT(AUDIO, "pulseaudio underflow, new latency: {} bytes", m_pa_ba.tlength);
+  UpdateBufferAttr(s);
+  WARN_LOG_FMT(AUDIO, "pulseaudio underflow, new latency: {} frames", m_latency->GetFrames());
 }
 
 void PulseAudio::WriteCallback(pa_stream* s, size_t length)
 {
+  // lower the latency again after playing without underflows for a while
+  if (m_latency->Update(Clock::now()))
+  {
+    UpdateBufferAttr(s);
+    INFO_LOG_FMT(AUDIO, "pulseaudio stable, new latency: {} frames", m_latency->GetFrames());
+  }
+
+  pa_usec_t latency_us;
+  int negative;
+  if (pa_stream_get_latency(s, &latency_us, &negative) == 0 && !negative)
+    m_mixer->SetBackendLatency(std::chrono::microseconds(latency_us));
+
   int bytes_per_frame = m_channels * m_bytespersample;
   int frames = (length / bytes_per_frame);
   size_t trunc_length = frames * bytes_per_frame;
@@ -7,6 +7,9 @@
 #include <pulse/pulseaudio.h>
 #endif
 
+#include <optional>
+
+#include "AudioCommon/AdaptiveLatency.h"
 #include "AudioCommon/SoundStream.h"
 #include "Common/Flag.h"
 #include "Common/Thread.h"
@@ -30,6 +33,7 @@ private:
 
   bool PulseInit();
   void PulseShutdown();
+  void UpdateBufferAttr(pa_stream* s);
 
   // wrapper callback functions, last parameter _must_ be PulseAudio*
   static void StateCallback(pa_context* c, void* userdata);
@@ -50,5 +54,7 @@ private:
   pa_context* m_pa_ctx;
   pa_stream* m_pa_s;
   pa_buffer_attr m_pa_ba;
+
+  std::optional<AudioCommon::AdaptiveLatency> m_latency;
 #endif
 };
@@ -3,6 +3,7 @@
 
 #include "AudioCommon/WaveFile.h"
 
+#include <algorithm>
 #include <string>
 
 #include <fmt/format.h>
@@ -117,6 +118,24 @@ void WaveFileWriter::Write4(const char* ptr)
   m_file.WriteBytes(ptr, 4);
 }
 
+void WaveFileWriter::AddStereoSamples(const short* sample_data, u32 count)
+{
+  if (!m_file)
+  {
+    ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
+    return;
+  }
+
+  if (m_skip_silence && std::all_of(sample_data, sample_data + count * 2,
+                                    [](short sample) { return sample == 0; }))
+  {
+    return;
+  }
+
+  m_file.WriteBytes(sample_data, count * 4);
+  m_audio_size += count * 4;
+}
+
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
                                         u32 sample_rate_divisor, int l_volume, int r_volume)
 {
@@ -37,6 +37,8 @@ public:
   // big endian
   void AddStereoSamplesBE(const short* sample_data, u32 count, u32 sample_rate_divisor,
                           int l_volume, int r_volume);
+  // native endian, left channel first, at the sample rate the file was started with
+  void AddStereoSamples(const short* sample_data, u32 count);
   u32 GetAudioSize() const { return m_audio_size; }
 
 private:
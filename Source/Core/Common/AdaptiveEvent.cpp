@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/AdaptiveEvent.h"
+
+#include <algorithm>
+#include <thread>
+
+#ifdef __linux__
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(_M_X86_64)
+#include <immintrin.h>
+#elif defined(_M_ARM_64) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Common
+{
+// In pause instructions, which take somewhere between a few and a hundred cycles each.
+constexpr u32 MIN_SPIN_LIMIT = 16;
+constexpr u32 MAX_SPIN_LIMIT = 4096;
+
+static void SpinPause()
+{
+#if defined(_M_X86_64)
+  _mm_pause();
+#elif defined(_M_ARM_64) && defined(_MSC_VER)
+  __yield();
+#elif defined(_M_ARM_64)
+  asm volatile("yield");
+#endif
+}
+
+bool AdaptiveEvent::WaitInternal(std::optional<std::chrono::nanoseconds> timeout)
+{
+  if (TryConsume())
+    return true;
+
+  // With a single hardware thread, the thread that would set the event can't run while spinning.
+  static const bool can_spin = std::thread::hardware_concurrency() > 1;
+  if (!can_spin)
+    return Park(timeout);
+
+  const u32 spin_limit = std::max(m_spin_limit, MIN_SPIN_LIMIT);
+  for (u32 i = 0; i < spin_limit; ++i)
+  {
+    SpinPause();
+    if (TryConsume())
+    {
+      m_spin_limit = std::min(spin_limit * 2, MAX_SPIN_LIMIT);
+      return true;
+    }
+  }
+
+  // Spinning didn't pay off this time, so spin less the next time.
+  m_spin_limit = spin_limit / 2;
+  return Park(timeout);
+}
+
+bool AdaptiveEvent::TryConsume()
+{
+  // Only the waiting thread moves the state away from STATE_SET, so the load avoids writing to the
+  // cache line while spinning.
+  if (m_state.load(std::memory_order_relaxed) != STATE_SET)
+    return false;
+
+  m_state.store(STATE_EMPTY, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return true;
+}
+
+bool AdaptiveEvent::Park(std::optional<std::chrono::nanoseconds> timeout)
+{
+  u32 expected = STATE_EMPTY;
+  if (!m_state.compare_exchange_strong(expected, STATE_PARKED, std::memory_order_relaxed))
+    return TryConsume();
+
+  const auto deadline =
+      std::chrono::steady_clock::now() + timeout.value_or(std::chrono::nanoseconds{});
+  while (true)
+  {
+#ifdef __linux__
+    static_assert(sizeof(m_state) == sizeof(u32) && std::atomic<u32>::is_always_lock_free);
+
+    timespec relative_timeout{};
+    if (timeout)
+    {
+      const auto remaining = std::max(deadline - std::chrono::steady_clock::now(),
+                                      std::chrono::steady_clock::duration::zero());
+      const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+      relative_timeout.tv_sec = static_cast<time_t>(ns / 1000000000);
+      relative_timeout.tv_nsec = static_cast<long>(ns % 1000000000);
+    }
+
+    // Returns right away if the state isn't STATE_PARKED anymore.
+    syscall(SYS_futex, reinterpret_cast<u32*>(&m_state), FUTEX_WAIT_PRIVATE, STATE_PARKED,
+            timeout ? &relative_timeout : nullptr, nullptr, 0);
+#else
+    {
+      std::unique_lock lk(m_mutex);
+      const auto is_woken = [this] {
+        return m_state.load(std::memory_order_relaxed) != STATE_PARKED;
+      };
+      if (timeout)
+        m_condvar.wait_until(lk, deadline, is_woken);
+      else
+        m_condvar.wait(lk, is_woken);
+    }
+#endif
+
+    if (TryConsume())
+      return true;
+
+    if (timeout && std::chrono::steady_clock::now() >= deadline)
+    {
+      expected = STATE_PARKED;
+      if (m_state.compare_exchange_strong(expected, STATE_EMPTY, std::memory_order_relaxed))
+        return false;
+
+      // It was set right after timing out.
+      return TryConsume();
+    }
+  }
+}
+
+void AdaptiveEvent::Wake()
+{
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<u32*>(&m_state), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr,
+          0);
+#else
+  // Holding the lock between the change of the state and the notification prevents the wakeup
+  // from happening between the waiting thread's check of the state and it starting to wait.
+  {
+    std::lock_guard lk(m_mutex);
+  }
+  m_condvar.notify_one();
+#endif
+}
+}  // namespace Common
@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// An event for handing work between two threads which usually only wait for each other briefly.
+// It has the same interface as Common::Event, but Wait() spins for a while before parking the
+// thread, which avoids the kernel round trip when the event is set soon. How long to spin adapts
+// to how the last waits went, so it stops spinning when waits are long. On Linux, threads are
+// parked on a futex directly rather than through a mutex and condition variable.
+//
+// Only one thread may wait at a time, but any thread may set it.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+#ifndef __linux__
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+class AdaptiveEvent final
+{
+public:
+  void Set()
+  {
+    if (m_state.exchange(STATE_SET, std::memory_order_release) == STATE_PARKED)
+      Wake();
+  }
+
+  void Wait() { WaitInternal(std::nullopt); }
+
+  template <class Rep, class Period>
+  bool WaitFor(const std::chrono::duration<Rep, Period>& rel_time)
+  {
+    return WaitInternal(std::chrono::duration_cast<std::chrono::nanoseconds>(rel_time));
+  }
+
+  void Reset()
+  {
+    u32 expected = STATE_SET;
+    m_state.compare_exchange_strong(expected, STATE_EMPTY, std::memory_order_relaxed);
+  }
+
+private:
+  enum : u32
+  {
+    STATE_EMPTY = 0,
+    STATE_SET = 1,
+    // Not set, and the waiting thread is parked or about to be.
+    STATE_PARKED = 2,
+  };
+
+  bool WaitInternal(std::optional<std::chrono::nanoseconds> timeout);
+  bool TryConsume();
+  bool Park(std::optional<std::chrono::nanoseconds> timeout);
+  void Wake();
+
+  std::atomic<u32> m_state = STATE_EMPTY;
+
+  // Only touched by the waiting thread.
+  u32 m_spin_limit = 0;
+
+#ifndef __linux__
+  std::mutex m_mutex;
+  std::condition_variable m_condvar;
+#endif
+};
+}  // namespace Common
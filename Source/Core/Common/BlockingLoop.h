@@ -7,7 +7,7 @@
 #include <mutex>
 #include <thread>
 
-#include "Common/Event.h"
+#include "Common/AdaptiveEvent.h"
 #include "Common/Flag.h"
 
 namespace Common
@@ -239,8 +239,10 @@ private:
   Flag m_stopped;   // If this is set, Wait() shall not block.
   Flag m_shutdown;  // If this is set, the loop shall end.
 
-  Event m_new_work_event;
-  Event m_done_event;
+  // The worker thread only parks once it has been allowed to sleep, and the waiting threads usually
+  // only wait for the rest of a payload run, so both sides spin a little before parking.
+  AdaptiveEvent m_new_work_event;
+  AdaptiveEvent m_done_event;
 
   enum RUNNING_TYPE
   {
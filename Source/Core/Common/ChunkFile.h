@@ -46,14 +46,18 @@ public:
     Verify,
   };
 
+  // Alignment of large arrays within the stream, see DoPageAlignment().
+  static constexpr u32 PAGE_ALIGNMENT = 0x1000;
+
 private:
   u8** m_ptr_current;
+  u8* m_ptr_start;
   u8* m_ptr_end;
   Mode m_mode;
 
 public:
   PointerWrap(u8** ptr, size_t size, Mode mode)
-      : m_ptr_current(ptr), m_ptr_end(*ptr + size), m_mode(mode)
+      : m_ptr_current(ptr), m_ptr_start(*ptr), m_ptr_end(*ptr + size), m_mode(mode)
   {
   }
 
@@ -229,6 +233,40 @@ public:
     return current;
   }
 
+  // Skips over size bytes without storing a size like DoExternal does. In write mode, a pointer to
+  // the skipped bytes is returned and the caller has to fill them in before the buffer is used.
+  // Otherwise, or if the buffer is too small, nullptr is returned.
+  [[nodiscard]] u8* ReserveBytes(u32 size)
+  {
+    u8* current = *m_ptr_current;
+    *m_ptr_current += size;
+    if (!IsMeasureMode() && *m_ptr_current > m_ptr_end)
+    {
+      // trying to read/write past the end of the buffer, prevent this
+      SetMeasureMode();
+    }
+    return IsWriteMode() ? current : nullptr;
+  }
+
+  // Pads the stream so that the next value starts at a multiple of PAGE_ALIGNMENT from the start of
+  // the stream. Large arrays are aligned like this so that they line up between two states even if
+  // the data before them changed in size, which keeps incremental states small.
+  void DoPageAlignment()
+  {
+    const size_t offset = static_cast<size_t>(*m_ptr_current - m_ptr_start);
+    const size_t padding = (PAGE_ALIGNMENT - offset % PAGE_ALIGNMENT) % PAGE_ALIGNMENT;
+    if (!IsMeasureMode() && (*m_ptr_current + padding) > m_ptr_end)
+    {
+      // trying to read/write past the end of the buffer, prevent this
+      SetMeasureMode();
+    }
+
+    if (IsWriteMode())
+      std::memset(*m_ptr_current, 0, padding);
+
+    *m_ptr_current += padding;
+  }
+
   // The reserved u32 is set to 0, and a pointer to it is returned.
   // The caller needs to fill in the reserved u32 with the appropriate value later on, if they
   // want a non-zero value there.
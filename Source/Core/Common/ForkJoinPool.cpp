@@ -0,0 +1,97 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ForkJoinPool.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <fmt/format.h>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+void ForkJoinPool::Start(std::string name, u32 worker_count)
+{
+  Stop();
+
+  m_stop = false;
+  for (u32 i = 0; i < worker_count; ++i)
+  {
+    Worker& worker = *m_workers.emplace_back(std::make_unique<Worker>());
+    worker.thread = std::thread(&ForkJoinPool::WorkerLoop, this, std::ref(worker),
+                                fmt::format("{} {}", name, i), i + 1);
+  }
+}
+
+void ForkJoinPool::Stop()
+{
+  if (m_workers.empty())
+    return;
+
+  m_stop = true;
+  for (auto& worker : m_workers)
+  {
+    worker->work_event.Set();
+    worker->thread.join();
+  }
+  m_workers.clear();
+}
+
+void ForkJoinPool::ParallelFor(u32 item_count, const std::function<void(u32, u32)>& func)
+{
+  if (m_workers.empty() || item_count <= 1)
+  {
+    for (u32 i = 0; i < item_count; ++i)
+      func(0, i);
+    return;
+  }
+
+  m_func = &func;
+  m_item_count = item_count;
+  m_next_item.store(0, std::memory_order_relaxed);
+
+  // Waking up more workers than there are items left for them would only add latency.
+  const u32 woken_count = std::min<u32>(static_cast<u32>(m_workers.size()), item_count - 1);
+  m_busy_workers.store(woken_count, std::memory_order_relaxed);
+  for (u32 i = 0; i < woken_count; ++i)
+    m_workers[i]->work_event.Set();
+
+  RunItems(0);
+
+  while (m_busy_workers.load(std::memory_order_acquire) != 0)
+    m_done_event.Wait();
+
+  m_func = nullptr;
+}
+
+void ForkJoinPool::WorkerLoop(Worker& worker, std::string name, u32 thread_index)
+{
+  SetCurrentThreadName(name.c_str());
+
+  while (true)
+  {
+    worker.work_event.Wait();
+    if (m_stop)
+      return;
+
+    RunItems(thread_index);
+
+    if (m_busy_workers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      m_done_event.Set();
+  }
+}
+
+void ForkJoinPool::RunItems(u32 thread_index)
+{
+  while (true)
+  {
+    const u32 item = m_next_item.fetch_add(1, std::memory_order_relaxed);
+    if (item >= m_item_count)
+      return;
+
+    (*m_func)(thread_index, item);
+  }
+}
+}  // namespace Common
@@ -0,0 +1,63 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// A set of worker threads for splitting short, latency sensitive batches of work between them and
+// the calling thread, which waits for all of the batch to be done. Idle workers wait on an
+// AdaptiveEvent, so batches coming in quickly one after another don't go through the kernel.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/AdaptiveEvent.h"
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+class ForkJoinPool final
+{
+public:
+  ForkJoinPool() = default;
+  ForkJoinPool(const ForkJoinPool&) = delete;
+  ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+  ~ForkJoinPool() { Stop(); }
+
+  // Starts worker_count worker threads, stopping the current ones first.
+  void Start(std::string name, u32 worker_count);
+  void Stop();
+
+  // The number of threads ParallelFor uses, including the calling thread.
+  u32 GetThreadCount() const { return static_cast<u32>(m_workers.size()) + 1; }
+
+  // Calls func(thread_index, item_index) for every item_index below item_count, spread over the
+  // workers and the calling thread, and returns once all of the calls have returned. thread_index
+  // is below GetThreadCount(), 0 being the calling thread, and no two calls with the same one run
+  // at the same time. Must not be called from more than one thread at a time.
+  void ParallelFor(u32 item_count, const std::function<void(u32, u32)>& func);
+
+private:
+  struct Worker
+  {
+    std::thread thread;
+    AdaptiveEvent work_event;
+  };
+
+  void WorkerLoop(Worker& worker, std::string name, u32 thread_index);
+  void RunItems(u32 thread_index);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  bool m_stop = false;
+
+  // The current batch. Written before the workers are woken up.
+  const std::function<void(u32, u32)>* m_func = nullptr;
+  u32 m_item_count = 0;
+  std::atomic<u32> m_next_item = 0;
+  std::atomic<u32> m_busy_workers = 0;
+  AdaptiveEvent m_done_event;
+};
+}  // namespace Common
@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a simple lockless thread-safe,
+// multiple producer, single consumer queue
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+// Producers push onto an intrusive stack with a single compare-and-swap. The consumer takes the
+// whole stack at once and reverses it, so elements are still consumed in the order they were
+// pushed in.
+template <typename T>
+class MPSCQueue final
+{
+public:
+  MPSCQueue() = default;
+  ~MPSCQueue() { Clear(); }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  bool Empty() const { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+  // Safe from any thread:
+  void Push(T value)
+  {
+    Node* const node = new Node{std::move(value), m_head.load(std::memory_order_relaxed)};
+    while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                         std::memory_order_relaxed))
+    {
+    }
+  }
+
+  // The following are only safe from the "consumer thread":
+
+  // Calls func with each element pushed so far, oldest first.
+  template <typename Func>
+  void PopAll(Func&& func)
+  {
+    if (m_head.load(std::memory_order_relaxed) == nullptr)
+      return;
+
+    Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+    Node* oldest = nullptr;
+    while (node)
+    {
+      Node* const next = node->next;
+      node->next = oldest;
+      oldest = node;
+      node = next;
+    }
+
+    while (oldest)
+    {
+      Node* const next = oldest->next;
+      func(std::move(oldest->value));
+      delete oldest;
+      oldest = next;
+    }
+  }
+
+  void Clear()
+  {
+    PopAll([](T&&) {});
+  }
+
+private:
+  struct Node
+  {
+    T value;
+    Node* next;
+  };
+
+  std::atomic<Node*> m_head = nullptr;
+};
+}  // namespace Common
@@ -0,0 +1,190 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <limits>
+#include <utility>
+
+#include "Common/CommonFuncs.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#endif
+
+namespace File
+{
+namespace
+{
+// Reads starting at most this far past where the previous one ended still count as sequential,
+// since the DVD thread skips over small holes in the same file.
+constexpr u64 SEQUENTIAL_GAP = 0x10000;
+// How far ahead of a sequential read to prefetch, and how close to the end of the prefetched
+// range a read has to get before the next window is requested.
+constexpr u64 PREFETCH_SIZE = 0x400000;
+constexpr u64 PREFETCH_THRESHOLD = PREFETCH_SIZE / 2;
+// Scattered reads in a row before the kernel's readahead gets turned off.
+constexpr u32 RANDOM_READ_THRESHOLD = 16;
+
+#if defined(__linux__)
+// Whether the file is on a network or FUSE file system, where a failed read of a mapped page is
+// far more likely than on a local disk and would kill the process with SIGBUS.
+bool IsOnRemoteFileSystem(int fd)
+{
+  struct statfs info;
+  if (fstatfs(fd, &info) != 0)
+    return true;
+
+  switch (static_cast<u32>(info.f_type))
+  {
+  case 0x6969:      // NFS
+  case 0x517B:      // SMB
+  case 0xFF534D42:  // CIFS
+  case 0xFE534D42:  // SMB2
+  case 0x65735546:  // FUSE
+  case 0x01021997:  // 9P
+  case 0x00C36400:  // Ceph
+  case 0x5346414F:  // AFS
+  case 0x73757245:  // Coda
+    return true;
+  default:
+    return false;
+  }
+}
+#endif
+}  // namespace
+
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+      m_next_offset(other.m_next_offset), m_prefetched_end(other.m_prefetched_end),
+      m_scattered_reads(other.m_scattered_reads), m_advice(other.m_advice)
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+  if (this != &other)
+  {
+    Unmap();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_next_offset = other.m_next_offset;
+    m_prefetched_end = other.m_prefetched_end;
+    m_scattered_reads = other.m_scattered_reads;
+    m_advice = other.m_advice;
+  }
+  return *this;
+}
+
+bool MappedFile::Map(IOFile& file)
+{
+  Unmap();
+
+#if defined(__linux__)
+  const u64 size = file.GetSize();
+  if (!file.IsOpen() || size == 0 || size > std::numeric_limits<size_t>::max())
+    return false;
+
+  const int fd = fileno(file.GetHandle());
+  if (IsOnRemoteFileSystem(fd))
+  {
+    INFO_LOG_FMT(COMMON, "Not mapping a file on a network or FUSE file system");
+    return false;
+  }
+
+  void* const data = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED)
+  {
+    WARN_LOG_FMT(COMMON, "Failed to map file: {}", Common::LastStrerrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(data);
+  m_size = size;
+  m_next_offset = 0;
+  m_prefetched_end = 0;
+  m_scattered_reads = 0;
+  m_advice = Advice::Normal;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void MappedFile::Unmap()
+{
+  if (!m_data)
+    return;
+
+#if defined(__linux__)
+  munmap(const_cast<u8*>(m_data), static_cast<size_t>(m_size));
+#endif
+  m_data = nullptr;
+  m_size = 0;
+}
+
+void MappedFile::AdviseRead(u64 offset, u64 size)
+{
+  if (!m_data || offset >= m_size)
+    return;
+
+  const u64 end = std::min(offset + size, m_size);
+  const bool sequential = offset >= m_next_offset && offset - m_next_offset <= SEQUENTIAL_GAP;
+  m_next_offset = end;
+
+  if (!sequential)
+  {
+    m_prefetched_end = 0;
+    if (m_scattered_reads < RANDOM_READ_THRESHOLD && ++m_scattered_reads == RANDOM_READ_THRESHOLD)
+    {
+#if defined(__linux__)
+      Advise(0, m_size, MADV_RANDOM);
+#endif
+      m_advice = Advice::Random;
+    }
+    return;
+  }
+
+  m_scattered_reads = 0;
+  if (m_advice == Advice::Random)
+  {
+#if defined(__linux__)
+    Advise(0, m_size, MADV_NORMAL);
+#endif
+    m_advice = Advice::Normal;
+  }
+
+  if (end + PREFETCH_THRESHOLD < m_prefetched_end || end == m_size)
+    return;
+
+  const u64 prefetch_start = std::max(end, m_prefetched_end);
+  m_prefetched_end = std::min(end + PREFETCH_SIZE, m_size);
+#if defined(__linux__)
+  Advise(prefetch_start, m_prefetched_end - prefetch_start, MADV_WILLNEED);
+#endif
+}
+
+void MappedFile::Advise(u64 offset, u64 size, int advice) const
+{
+#if defined(__linux__)
+  // madvise wants a page aligned address.
+  static const u64 page_size = static_cast<u64>(sysconf(_SC_PAGESIZE));
+  const u64 aligned_offset = offset - offset % page_size;
+  u8* const address = const_cast<u8*>(m_data) + aligned_offset;
+  if (madvise(address, static_cast<size_t>(size + offset - aligned_offset), advice) != 0)
+    DEBUG_LOG_FMT(COMMON, "madvise failed: {}", Common::LastStrerrorString());
+#endif
+}
+}  // namespace File
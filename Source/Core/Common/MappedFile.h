@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+
+// A read-only mapping of a whole file into memory. Only implemented on Linux for now, everywhere
+// else Map fails and the caller has to keep reading through the file instead.
+//
+// Reading a page of the mapping that the file can't provide, because of an I/O error or because
+// the file was truncated, raises SIGBUS instead of returning an error. Map therefore refuses files
+// on network and FUSE file systems, and callers should only map files when the user opted in.
+class MappedFile final
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  // The file can be closed again once this has returned.
+  bool Map(IOFile& file);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  u64 GetSize() const { return m_size; }
+  std::span<const u8> GetSpan() const { return {m_data, static_cast<size_t>(m_size)}; }
+
+  // Tells the kernel that the given range is about to be read. Sequential runs of reads get the
+  // data after them prefetched, and long runs of scattered reads turn off the kernel's own
+  // readahead so that it doesn't read pages nobody is going to look at.
+  void AdviseRead(u64 offset, u64 size);
+
+private:
+  enum class Advice
+  {
+    Normal,
+    Random,
+  };
+
+  void Advise(u64 offset, u64 size, int advice) const;
+
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+
+  u64 m_next_offset = 0;
+  u64 m_prefetched_end = 0;
+  u32 m_scattered_reads = 0;
+  Advice m_advice = Advice::Normal;
+};
+}  // namespace File
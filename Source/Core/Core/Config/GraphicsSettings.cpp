@@ -76,6 +76,9 @@ const Info<FrameDumpResolutionType> GFX_FRAME_DUMPS_RESOLUTION_TYPE{
     {System::GFX, "Settings", "FrameDumpsResolutionType"},
     FrameDumpResolutionType::XFBAspectRatioCorrectedResolution};
 const Info<int> GFX_PNG_COMPRESSION_LEVEL{{System::GFX, "Settings", "PNGCompressionLevel"}, 6};
+const Info<int> GFX_FRAME_DUMPS_QUEUE_SIZE{{System::GFX, "Settings", "FrameDumpsQueueSize"}, 4};
+const Info<bool> GFX_FRAME_DUMPS_DROP_WHEN_FULL{
+    {System::GFX, "Settings", "FrameDumpsDropWhenFull"}, false};
 const Info<bool> GFX_ENABLE_GPU_TEXTURE_DECODING{
     {System::GFX, "Settings", "EnableGPUTextureDecoding"}, false};
 const Info<bool> GFX_ENABLE_PIXEL_LIGHTING{{System::GFX, "Settings", "EnablePixelLighting"}, false};
@@ -97,6 +100,7 @@ const Info<bool> GFX_BACKEND_MULTITHREADING{{System::GFX, "Settings", "BackendMu
                                             true};
 const Info<int> GFX_COMMAND_BUFFER_EXECUTE_INTERVAL{
     {System::GFX, "Settings", "CommandBufferExecuteInterval"}, 100};
+const Info<int> GFX_DRAW_RECORDING_THREADS{{System::GFX, "Settings", "DrawRecordingThreads"}, 0};
 
 const Info<bool> GFX_SHADER_CACHE{{System::GFX, "Settings", "ShaderCache"}, true};
 const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING{
@@ -60,6 +60,10 @@ const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY{{System::Main, "Core", "D
 const Info<int> MAIN_AUDIO_LATENCY{{System::Main, "Core", "AudioLatency"}, 20};
 const Info<int> MAIN_AUDIO_BUFFER_SIZE{{System::Main, "Core", "AudioBufferSize"}, 80};
 const Info<bool> MAIN_AUDIO_FILL_GAPS{{System::Main, "Core", "AudioFillGaps"}, true};
+const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY{
+    {System::Main, "Core", "AudioResamplingQuality"}, AudioCommon::ResamplingQuality::High};
+const Info<std::string> MAIN_AUDIO_NULL_OUTPUT_PATH{{System::Main, "Core", "AudioNullOutputPath"},
+                                                    ""};
 const Info<std::string> MAIN_MEMCARD_A_PATH{{System::Main, "Core", "MemcardAPath"}, ""};
 const Info<std::string> MAIN_MEMCARD_B_PATH{{System::Main, "Core", "MemcardBPath"}, ""};
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot)
@@ -204,7 +208,13 @@ const Info<bool> MAIN_SYNC_GPU{{System::Main, "Core", "SyncGPU"}, false};
 const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE{{System::Main, "Core", "SyncGpuMaxDistance"}, 200000};
 const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE{{System::Main, "Core", "SyncGpuMinDistance"}, -200000};
 const Info<float> MAIN_SYNC_GPU_OVERCLOCK{{System::Main, "Core", "SyncGpuOverclock"}, 1.0f};
+const Info<bool> MAIN_SYNC_GPU_ADAPTIVE{{System::Main, "Core", "SyncGpuAdaptive"}, false};
 const Info<bool> MAIN_FAST_DISC_SPEED{{System::Main, "Core", "FastDiscSpeed"}, false};
+// Number of threads reading GCZ, WIA and RVZ discs ahead of sequential reads. 0 disables it.
+const Info<int> MAIN_DVD_READ_AHEAD_THREADS{{System::Main, "Core", "DVDReadAheadThreads"}, 2};
+// Map plain disc images into memory instead of reading them through the file. Off by default, as
+// an I/O error or the image being truncated while mapped kills the process with SIGBUS.
+const Info<bool> MAIN_MAP_DISC_IMAGES{{System::Main, "Core", "MapDiscImages"}, false};
 const Info<bool> MAIN_LOW_DCBZ_HACK{{System::Main, "Core", "LowDCBZHack"}, false};
 const Info<bool> MAIN_FLOAT_EXCEPTIONS{{System::Main, "Core", "FloatExceptions"}, false};
 const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS{{System::Main, "Core", "DivByZeroExceptions"},
@@ -264,6 +274,21 @@ const Info<DiscIO::Region> MAIN_FALLBACK_REGION{{System::Main, "Core", "Fallback
 const Info<bool> MAIN_AUTO_DISC_CHANGE{{System::Main, "Core", "AutoDiscChange"}, false};
 const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrites"}, true};
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
+const Info<bool> MAIN_INCREMENTAL_SAVESTATES{{System::Main, "Core", "IncrementalSaveStates"},
+                                             false};
+const Info<int> MAIN_SAVESTATE_KEYFRAME_INTERVAL{
+    {System::Main, "Core", "SaveStateKeyframeInterval"}, 10};
+const Info<SaveStateCompression> MAIN_SAVESTATE_COMPRESSION{
+    {System::Main, "Core", "SaveStateCompression"}, SaveStateCompression::LZ4};
+const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL{{System::Main, "Core", "SaveStateZstdLevel"}, 5};
+const Info<bool> MAIN_COPY_ON_WRITE_SAVESTATES{{System::Main, "Core", "CopyOnWriteSaveStates"},
+                                               false};
+const Info<bool> MAIN_REWIND_ENABLE{{System::Main, "Core", "EnableRewind"}, false};
+const Info<int> MAIN_REWIND_FRAME_INTERVAL{{System::Main, "Core", "RewindFrameInterval"}, 4};
+const Info<int> MAIN_REWIND_KEYFRAME_INTERVAL{{System::Main, "Core", "RewindKeyframeInterval"}, 60};
+const Info<int> MAIN_REWIND_BUFFER_SIZE_MB{{System::Main, "Core", "RewindBufferSizeMB"}, 256};
+const Info<bool> MAIN_SUPPRESSED_PRESENTATION_SKIP_DRAWS{
+    {System::Main, "Core", "SuppressedPresentationSkipDraws"}, false};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
 const Info<bool> MAIN_WII_WIILINK_ENABLE{{System::Main, "Core", "EnableWiiLink"}, false};
@@ -291,6 +316,8 @@ const Info<bool> MAIN_DISABLE_SCREENSAVER{{System::Main, "Display", "DisableScre
 const Info<bool> MAIN_DSP_THREAD{{System::Main, "DSP", "DSPThread"}, false};
 const Info<bool> MAIN_DSP_CAPTURE_LOG{{System::Main, "DSP", "CaptureLog"}, false};
 const Info<bool> MAIN_DSP_JIT{{System::Main, "DSP", "EnableJIT"}, true};
+// Number of threads helping the emulation thread process AX voices with DSP HLE. 0 disables it.
+const Info<int> MAIN_DSP_HLE_VOICE_THREADS{{System::Main, "DSP", "HLEVoiceThreads"}, 0};
 const Info<bool> MAIN_DUMP_AUDIO{{System::Main, "DSP", "DumpAudio"}, false};
 const Info<bool> MAIN_DUMP_AUDIO_SILENT{{System::Main, "DSP", "DumpAudioSilent"}, false};
 const Info<bool> MAIN_DUMP_UCODE{{System::Main, "DSP", "DumpUCode"}, false};
@@ -505,6 +532,8 @@ const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT{{System::Main, "Movie", "DumpFram
 const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY{{System::Main, "Movie", "ShowInputDisplay"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RTC{{System::Main, "Movie", "ShowRTC"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RERECORD{{System::Main, "Movie", "ShowRerecord"}, false};
+const Info<bool> MAIN_MOVIE_COMPRESS_INPUT{{System::Main, "Movie", "CompressInput"}, false};
+const Info<bool> MAIN_MOVIE_VERIFY_PLAYBACK{{System::Main, "Movie", "VerifyPlayback"}, false};
 
 // Main.Input
 
@@ -31,6 +31,7 @@ enum class CPUCore;
 namespace AudioCommon
 {
 enum class DPL2Quality;
+enum class ResamplingQuality;
 }
 
 namespace ExpansionInterface
@@ -76,6 +77,9 @@ extern const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY;
 extern const Info<int> MAIN_AUDIO_LATENCY;
 extern const Info<int> MAIN_AUDIO_BUFFER_SIZE;
 extern const Info<bool> MAIN_AUDIO_FILL_GAPS;
+extern const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY;
+// If set, the null audio backend writes its output to this WAV file.
+extern const Info<std::string> MAIN_AUDIO_NULL_OUTPUT_PATH;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -119,7 +123,11 @@ extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+// Scale the SyncGPU distances at runtime to avoid stalling the CPU thread.
+extern const Info<bool> MAIN_SYNC_GPU_ADAPTIVE;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+extern const Info<int> MAIN_DVD_READ_AHEAD_THREADS;
+extern const Info<bool> MAIN_MAP_DISC_IMAGES;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
@@ -157,6 +165,24 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+extern const Info<bool> MAIN_INCREMENTAL_SAVESTATES;
+extern const Info<int> MAIN_SAVESTATE_KEYFRAME_INTERVAL;
+
+enum class SaveStateCompression
+{
+  LZ4,
+  Zstd,
+};
+extern const Info<SaveStateCompression> MAIN_SAVESTATE_COMPRESSION;
+extern const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL;
+extern const Info<bool> MAIN_COPY_ON_WRITE_SAVESTATES;
+
+extern const Info<bool> MAIN_REWIND_ENABLE;
+extern const Info<int> MAIN_REWIND_FRAME_INTERVAL;
+extern const Info<int> MAIN_REWIND_KEYFRAME_INTERVAL;
+extern const Info<int> MAIN_REWIND_BUFFER_SIZE_MB;
+// Skip drawing primitives while presentation is suppressed, see Core::SetIsPresentationSuppressed.
+extern const Info<bool> MAIN_SUPPRESSED_PRESENTATION_SKIP_DRAWS;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
@@ -168,6 +194,7 @@ extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
 extern const Info<bool> MAIN_DSP_THREAD;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
+extern const Info<int> MAIN_DSP_HLE_VOICE_THREADS;
 extern const Info<bool> MAIN_DUMP_AUDIO;
 extern const Info<bool> MAIN_DUMP_AUDIO_SILENT;
 extern const Info<bool> MAIN_DUMP_UCODE;
@@ -326,6 +353,9 @@ extern const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT;
 extern const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY;
 extern const Info<bool> MAIN_MOVIE_SHOW_RTC;
 extern const Info<bool> MAIN_MOVIE_SHOW_RERECORD;
+extern const Info<bool> MAIN_MOVIE_COMPRESS_INPUT;
+// Plays movies back without presenting frames, to verify them as quickly as possible.
+extern const Info<bool> MAIN_MOVIE_VERIFY_PLAYBACK;
 
 // Main.Input
 
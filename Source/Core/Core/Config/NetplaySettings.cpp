@@ -58,4 +58,7 @@ const Info<std::string> NETPLAY_NETWORK_MODE{{System::Main, "NetPlay", "NetworkM
 const Info<bool> NETPLAY_GOLF_MODE_OVERLAY{{System::Main, "NetPlay", "GolfModeOverlay"}, true};
 const Info<bool> NETPLAY_HIDE_REMOTE_GBAS{{System::Main, "NetPlay", "HideRemoteGBAs"}, false};
 
+const Info<bool> NETPLAY_ROLLBACK{{System::Main, "NetPlay", "Rollback"}, false};
+const Info<u32> NETPLAY_ROLLBACK_MAX_FRAMES{{System::Main, "NetPlay", "RollbackMaxFrames"}, 8};
+
 }  // namespace Config
@@ -52,4 +52,7 @@ extern const Info<std::string> NETPLAY_NETWORK_MODE;
 extern const Info<bool> NETPLAY_GOLF_MODE_OVERLAY;
 extern const Info<bool> NETPLAY_HIDE_REMOTE_GBAS;
 
+extern const Info<bool> NETPLAY_ROLLBACK;
+extern const Info<u32> NETPLAY_ROLLBACK_MAX_FRAMES;
+
 }  // namespace Config
@@ -57,6 +57,8 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
+#include "Core/HW/MemorySnapshot.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -70,6 +72,7 @@
 #include "Core/PowerPC/GDBStub.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/WiiRoot.h"
@@ -102,6 +105,9 @@ static std::vector<StateChangedCallbackFunc> s_on_state_changed_callbacks;
 
 static std::thread s_cpu_thread;
 static bool s_is_throttler_temp_disabled = false;
+static std::atomic<bool> s_is_presentation_suppressed = false;
+static TimePoint s_presentation_suppressed_time;
+static u64 s_presentation_suppressed_ticks = 0;
 static bool s_frame_step = false;
 static std::atomic<bool> s_stop_frame_step;
 
@@ -144,14 +150,60 @@ void SetIsThrottlerTempDisabled(bool disable)
   s_is_throttler_temp_disabled = disable;
 }
 
+bool GetIsPresentationSuppressed()
+{
+  return s_is_presentation_suppressed.load(std::memory_order_relaxed);
+}
+
+void SetIsPresentationSuppressed(bool suppress)
+{
+  if (s_is_presentation_suppressed.load(std::memory_order_relaxed) == suppress)
+    return;
+
+  auto& system = Core::System::GetInstance();
+  const u64 ticks = system.GetCoreTiming().GetTicks();
+  if (suppress)
+  {
+    s_presentation_suppressed_time = Clock::now();
+    s_presentation_suppressed_ticks = ticks;
+    g_perf_metrics.BeginSuppressedPresentation();
+  }
+  else
+  {
+    const DT host_time = Clock::now() - s_presentation_suppressed_time;
+    const DT_s emulated_time{static_cast<double>(ticks - s_presentation_suppressed_ticks) /
+                             system.GetSystemTimers().GetTicksPerSecond()};
+    g_perf_metrics.CountSuppressedPresentation(std::chrono::duration_cast<DT>(emulated_time),
+                                               host_time);
+    DEBUG_LOG_FMT(CORE, "Emulated {:.2f} ms in {:.2f} ms without presentation, speedup {:.2f}x",
+                  emulated_time.count() * 1000.0, DT_ms(host_time).count(),
+                  g_perf_metrics.GetSuppressedPresentationSpeedup());
+  }
+
+  system.GetFifo().SetSkipDraws(suppress &&
+                                Config::Get(Config::MAIN_SUPPRESSED_PRESENTATION_SKIP_DRAWS));
+  s_is_presentation_suppressed.store(suppress, std::memory_order_relaxed);
+}
+
 void FrameUpdateOnCPUThread()
 {
   if (NetPlay::IsNetPlayRunning())
     NetPlay::NetPlayClient::SendTimeBase();
 }
 
+static void OnFrameEndSafePoint(Core::System& system)
+{
+  if (NetPlay::IsNetPlayRunning())
+    NetPlay::NetPlayClient::OnFrameEnd(system);
+
+  Rewind::OnFrameEnd(system);
+}
+
 void OnFrameEnd(Core::System& system)
 {
+  // This is called from the VI event, which hasn't been scheduled again yet.
+  system.GetCoreTiming().RunAtSafePoint(&OnFrameEndSafePoint);
+
 #ifdef USE_MEMORYWATCHER
   if (s_memory_watcher)
   {
@@ -416,6 +468,8 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   s_memory_watcher.reset();
 #endif
 
+  // Snapshots of emulated memory rely on the exception handler.
+  system.GetMemory().GetSnapshot().Finish();
   if (exception_handler)
     EMM::UninstallExceptionHandler();
 
@@ -470,6 +524,9 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 {
   NotifyStateChanged(State::Starting);
   Common::ScopeGuard flag_guard{[] {
+    // A pending safe point callback which would have resumed presentation is dropped on shutdown.
+    SetIsPresentationSuppressed(false);
+
     s_state.store(State::Uninitialized);
 
     NotifyStateChanged(State::Uninitialized);
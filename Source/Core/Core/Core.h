@@ -27,6 +27,14 @@ class System;
 bool GetIsThrottlerTempDisabled();
 void SetIsThrottlerTempDisabled(bool disable);
 
+// While set, fields aren't presented and emulation runs unthrottled, so that it catches up as
+// quickly as possible, e.g. when emulating frames again after a NetPlay rollback or verifying a
+// movie. If MAIN_SUPPRESSED_PRESENTATION_SKIP_DRAWS is set, the GPU also skips drawing primitives.
+// The speedup over the speed before is reported to the performance metrics when presentation is
+// resumed.
+bool GetIsPresentationSuppressed();
+void SetIsPresentationSuppressed(bool suppress);
+
 void Callback_NewField(Core::System& system);
 
 enum class State
@@ -4,7 +4,7 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
-#include <mutex>
+#include <bit>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,7 +14,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -38,6 +38,231 @@ static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLat
 {
 }
 
+EventQueue::EventQueue()
+{
+  m_bucket_heads.fill(NONE);
+}
+
+EventQueue::~EventQueue() = default;
+
+void EventQueue::Reset(s64 time)
+{
+  for (const Node& node : m_nodes)
+  {
+    if (node.bucket != FREE_NODE)
+      node.event.type->first_pending = NONE;
+  }
+
+  m_nodes.clear();
+  m_first_free = NONE;
+  m_bucket_heads.fill(NONE);
+  m_occupied_buckets.fill(0);
+  m_wheel_start = time & ~(BUCKET_CYCLES - 1);
+  m_overflow_min_time = std::numeric_limits<s64>::max();
+  m_overflow_size = 0;
+  m_size = 0;
+  m_front = NONE;
+}
+
+void EventQueue::Push(const Event& event)
+{
+  u32 index = m_first_free;
+  if (index != NONE)
+  {
+    m_first_free = m_nodes[index].next;
+  }
+  else
+  {
+    index = static_cast<u32>(m_nodes.size());
+    m_nodes.emplace_back();
+  }
+
+  Node& node = m_nodes[index];
+  node.event = event;
+
+  EventType* const type = event.type;
+  node.type_prev = NONE;
+  node.type_next = type->first_pending;
+  if (type->first_pending != NONE)
+    m_nodes[type->first_pending].type_prev = index;
+  type->first_pending = index;
+
+  Link(index, GetBucket(event.time));
+  ++m_size;
+
+  if (m_front != NONE && event < m_nodes[m_front].event)
+    m_front = index;
+}
+
+const Event& EventQueue::Front()
+{
+  if (m_front == NONE)
+    m_front = FindFront();
+  return m_nodes[m_front].event;
+}
+
+void EventQueue::Pop()
+{
+  const u32 index = m_front != NONE ? m_front : FindFront();
+  const s64 time = m_nodes[index].event.time;
+  Free(index);
+  m_front = NONE;
+
+  // Everything left is at or after the popped event, so the buckets before it are empty.
+  MoveWheel(time);
+}
+
+void EventQueue::RemoveAll(EventType* event_type)
+{
+  u32 index = event_type->first_pending;
+  while (index != NONE)
+  {
+    const u32 next = m_nodes[index].type_next;
+    if (index == m_front)
+      m_front = NONE;
+    Free(index);
+    index = next;
+  }
+}
+
+std::vector<Event> EventQueue::GetEvents() const
+{
+  std::vector<Event> events;
+  events.reserve(m_size);
+  for (const Node& node : m_nodes)
+  {
+    if (node.bucket != FREE_NODE)
+      events.push_back(node.event);
+  }
+  return events;
+}
+
+u32 EventQueue::GetBucket(s64 time) const
+{
+  if (time - m_wheel_start >= BUCKET_CYCLES * WHEEL_SIZE)
+    return OVERFLOW_BUCKET;
+  return static_cast<u32>(std::max(time, m_wheel_start) >> BUCKET_CYCLES_SHIFT) % WHEEL_SIZE;
+}
+
+void EventQueue::Link(u32 index, u32 bucket)
+{
+  Node& node = m_nodes[index];
+  node.bucket = bucket;
+  node.prev = NONE;
+  node.next = m_bucket_heads[bucket];
+  if (node.next != NONE)
+    m_nodes[node.next].prev = index;
+  m_bucket_heads[bucket] = index;
+
+  if (bucket == OVERFLOW_BUCKET)
+  {
+    ++m_overflow_size;
+    m_overflow_min_time = std::min(m_overflow_min_time, node.event.time);
+  }
+  else
+  {
+    m_occupied_buckets[bucket / 64] |= u64(1) << (bucket % 64);
+  }
+}
+
+void EventQueue::Unlink(u32 index)
+{
+  const Node& node = m_nodes[index];
+  if (node.prev != NONE)
+    m_nodes[node.prev].next = node.next;
+  else
+    m_bucket_heads[node.bucket] = node.next;
+  if (node.next != NONE)
+    m_nodes[node.next].prev = node.prev;
+
+  if (node.bucket == OVERFLOW_BUCKET)
+    --m_overflow_size;
+  else if (m_bucket_heads[node.bucket] == NONE)
+    m_occupied_buckets[node.bucket / 64] &= ~(u64(1) << (node.bucket % 64));
+}
+
+void EventQueue::Free(u32 index)
+{
+  Unlink(index);
+
+  Node& node = m_nodes[index];
+  if (node.type_prev != NONE)
+    m_nodes[node.type_prev].type_next = node.type_next;
+  else
+    node.event.type->first_pending = node.type_next;
+  if (node.type_next != NONE)
+    m_nodes[node.type_next].type_prev = node.type_prev;
+
+  node.bucket = FREE_NODE;
+  node.next = m_first_free;
+  m_first_free = index;
+  --m_size;
+}
+
+u32 EventQueue::FindFront() const
+{
+  // Find the first bucket in use, starting at the one the wheel starts with. Every event in it is
+  // earlier than those in later buckets, and all of those are earlier than the overflow events.
+  u32 bucket = OVERFLOW_BUCKET;
+  if (m_size != m_overflow_size)
+  {
+    const u32 start = static_cast<u32>(m_wheel_start >> BUCKET_CYCLES_SHIFT) % WHEEL_SIZE;
+    for (u32 i = 0; i <= m_occupied_buckets.size(); ++i)
+    {
+      const u32 word = (start / 64 + i) % m_occupied_buckets.size();
+      u64 bits = m_occupied_buckets[word];
+      if (i == 0)
+        bits &= ~u64(0) << (start % 64);
+      else if (i == m_occupied_buckets.size())
+        bits &= ~(~u64(0) << (start % 64));
+
+      if (bits != 0)
+      {
+        bucket = word * 64 + static_cast<u32>(std::countr_zero(bits));
+        break;
+      }
+    }
+  }
+
+  u32 front = m_bucket_heads[bucket];
+  for (u32 index = m_nodes[front].next; index != NONE; index = m_nodes[index].next)
+  {
+    if (m_nodes[index].event < m_nodes[front].event)
+      front = index;
+  }
+  return front;
+}
+
+void EventQueue::MoveWheel(s64 time)
+{
+  const s64 start = time & ~(BUCKET_CYCLES - 1);
+  if (start <= m_wheel_start)
+    return;
+
+  m_wheel_start = start;
+  if (m_overflow_min_time - m_wheel_start >= BUCKET_CYCLES * WHEEL_SIZE)
+    return;
+
+  // Take in the overflow events which the wheel now reaches.
+  m_overflow_min_time = std::numeric_limits<s64>::max();
+  u32 index = m_bucket_heads[OVERFLOW_BUCKET];
+  while (index != NONE)
+  {
+    const u32 next = m_nodes[index].next;
+    const u32 bucket = GetBucket(m_nodes[index].event.time);
+    if (bucket != OVERFLOW_BUCKET)
+    {
+      Unlink(index);
+      Link(index, bucket);
+    }
+    else
+    {
+      m_overflow_min_time = std::min(m_overflow_min_time, m_nodes[index].event.time);
+    }
+    index = next;
+  }
+}
+
 CoreTimingManager::CoreTimingManager(Core::System& system) : m_system(system)
 {
 }
@@ -76,7 +301,7 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.IsEmpty(), "Cannot unregister events with events pending");
   m_event_types.clear();
 }
 
@@ -86,6 +311,7 @@ void CoreTimingManager::Init()
   m_globals.slice_length = MAX_SLICE_LENGTH;
   m_globals.global_timer = 0;
   m_idled_cycles = 0;
+  m_event_queue.Reset(0);
 
   // The time between CoreTiming being initialized and the first call to Advance() is considered
   // the slice boundary between slice -1 and slice 0. Dispatcher loops must call Advance() before
@@ -97,6 +323,7 @@ void CoreTimingManager::Init()
   ResetThrottle(0);
 
   m_event_fifo_id = 0;
+  m_safe_point_callbacks.clear();
   m_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
 
   m_registered_config_callback_id =
@@ -119,10 +346,10 @@ void CoreTimingManager::Shutdown()
 {
   Core::RemoveOnStateChangedCallback(&m_on_state_changed_handle);
 
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
+  m_safe_point_callbacks.clear();
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
 }
 
@@ -158,7 +385,6 @@ void CoreTimingManager::RefreshConfig()
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -173,7 +399,8 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
-  p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
+  std::vector<Event> events = m_event_queue.GetEvents();
+  p.DoEachElement(events, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
 
@@ -208,10 +435,11 @@ void CoreTimingManager::DoState(PointerWrap& p)
 
   if (p.IsReadMode())
   {
-    // When loading from a save state, we must assume the Event order is random and meaningless.
-    // The exact layout of the heap in memory is implementation defined, therefore it is platform
-    // and library version specific.
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    // The events are saved in no particular order, as the order in which they are kept in memory
+    // depends on what happened to the queue before.
+    m_event_queue.Reset(m_globals.global_timer);
+    for (const Event& ev : events)
+      m_event_queue.Push(ev);
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -239,7 +467,7 @@ u64 CoreTimingManager::GetIdleTicks() const
 
 void CoreTimingManager::ClearPendingEvents()
 {
-  m_event_queue.clear();
+  m_event_queue.Reset(m_globals.global_timer);
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -268,8 +496,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.Push(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -281,21 +508,13 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{cycles_into_future, 0, userdata, event_type});
   }
 }
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  const size_t erased =
-      std::erase_if(m_event_queue, [&](const Event& e) { return e.type == event_type; });
-
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (erased != 0)
-  {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
-  }
+  m_event_queue.RemoveAll(event_type);
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -319,16 +538,11 @@ void CoreTimingManager::ForceExceptionCheck(s64 cycles)
 
 void CoreTimingManager::MoveEvents()
 {
-  while (!m_ts_queue.Empty())
-  {
-    auto& ev = m_event_queue.emplace_back(m_ts_queue.Front());
-    m_ts_queue.Pop();
-
+  m_ts_queue.PopAll([this](Event ev) {
     ev.fifo_order = m_event_fifo_id++;
     ev.time += m_globals.global_timer;
-
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
-  }
+    m_event_queue.Push(ev);
+  });
 }
 
 void CoreTimingManager::Advance()
@@ -348,21 +562,20 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = true;
 
-  while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
+  while (!m_event_queue.IsEmpty() && m_event_queue.Front().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
-    m_event_queue.pop_back();
+    const Event evt = m_event_queue.Front();
+    m_event_queue.Pop();
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
   m_is_global_timer_sane = false;
 
   // Still events left (scheduled in the future)
-  if (!m_event_queue.empty())
+  if (!m_event_queue.IsEmpty())
   {
     m_globals.slice_length = static_cast<int>(
-        std::min<s64>(m_event_queue.front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
+        std::min<s64>(m_event_queue.Front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
   }
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
@@ -372,6 +585,19 @@ void CoreTimingManager::Advance()
   // until the next slice:
   //        Pokemon Box refuses to boot if the first exception from the audio DMA is received late
   power_pc.CheckExternalExceptions();
+
+  // This is the same point at which the CPU thread stops for a savestate to be saved or loaded, so
+  // states handled here include the rescheduled events and the new slice. A callback loading one
+  // replaces all of that, which is fine since nothing after this looks at it.
+  for (size_t i = 0; i < m_safe_point_callbacks.size(); ++i)
+    m_safe_point_callbacks[i](m_system);
+  m_safe_point_callbacks.clear();
+}
+
+void CoreTimingManager::RunAtSafePoint(SafePointCallback callback)
+{
+  if (std::ranges::find(m_safe_point_callbacks, callback) == m_safe_point_callbacks.end())
+    m_safe_point_callbacks.push_back(callback);
 }
 
 TimePoint CoreTimingManager::CalculateTargetHostTimeInternal(s64 target_cycle)
@@ -383,7 +609,8 @@ TimePoint CoreTimingManager::CalculateTargetHostTimeInternal(s64 target_cycle)
 
 bool CoreTimingManager::IsSpeedUnlimited() const
 {
-  return m_throttle_adj_clock_per_sec == 0 || Core::GetIsThrottlerTempDisabled();
+  return m_throttle_adj_clock_per_sec == 0 || Core::GetIsThrottlerTempDisabled() ||
+         Core::GetIsPresentationSuppressed();
 }
 
 TimePoint CoreTimingManager::GetTargetHostTime(s64 target_cycle)
@@ -514,7 +741,7 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 
 void CoreTimingManager::LogPendingEvents() const
 {
-  auto clone = m_event_queue;
+  auto clone = m_event_queue.GetEvents();
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -532,10 +759,13 @@ void CoreTimingManager::AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clo
 
   g_perf_metrics.AdjustClockSpeed(ticks, new_ppc_clock, old_ppc_clock);
 
-  for (Event& ev : m_event_queue)
+  std::vector<Event> events = m_event_queue.GetEvents();
+  m_event_queue.Reset(ticks);
+  for (Event& ev : events)
   {
     const s64 ev_ticks = (ev.time - ticks) * new_ppc_clock / old_ppc_clock;
     ev.time = ticks + ev_ticks;
+    m_event_queue.Push(ev);
   }
 }
 
@@ -560,7 +790,7 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   std::string text = "Scheduled events\n";
   text.reserve(1000);
 
-  auto clone = m_event_queue;
+  auto clone = m_event_queue.GetEvents();
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -16,14 +16,16 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
-#include <mutex>
+#include <array>
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Common/Timer.h"
 #include "Core/CPUThreadConfigCallback.h"
 
@@ -47,11 +49,14 @@ struct Globals
 };
 
 typedef void (*TimedCallback)(Core::System& system, u64 userdata, s64 cyclesLate);
+typedef void (*SafePointCallback)(Core::System& system);
 
 struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+  // The pending events of a type are linked together by the EventQueue, starting here.
+  u32 first_pending = std::numeric_limits<u32>::max();
 };
 
 struct Event
@@ -72,6 +77,83 @@ struct Event
   }
 };
 
+// The pending events, ordered by time and then by the order they were scheduled in.
+//
+// Events due within the next WHEEL_SIZE buckets of BUCKET_CYCLES each are kept in a timing wheel,
+// with one unsorted list per bucket. Later events are kept in a single unsorted overflow list,
+// which is only looked at when the wheel has moved far enough to take some of them in. Scheduling
+// an event is constant time, and finding the next one only has to look through a single bucket.
+// The events of each type are linked together as well, so removing them doesn't have to look at
+// any other events.
+class EventQueue
+{
+public:
+  EventQueue();
+  ~EventQueue();
+
+  EventQueue(const EventQueue&) = delete;
+  EventQueue& operator=(const EventQueue&) = delete;
+
+  // Removes all events. New events are expected to be mostly after the given time.
+  void Reset(s64 time);
+
+  bool IsEmpty() const { return m_size == 0; }
+  size_t GetSize() const { return m_size; }
+
+  void Push(const Event& event);
+
+  // The queue must not be empty for these.
+  const Event& Front();
+  void Pop();
+
+  void RemoveAll(EventType* event_type);
+
+  // Returns the events in no particular order.
+  std::vector<Event> GetEvents() const;
+
+  static constexpr int BUCKET_CYCLES_SHIFT = 10;
+  static constexpr s64 BUCKET_CYCLES = s64(1) << BUCKET_CYCLES_SHIFT;
+  static constexpr u32 WHEEL_SIZE = 512;
+
+private:
+  static constexpr u32 NONE = std::numeric_limits<u32>::max();
+  static constexpr u32 OVERFLOW_BUCKET = WHEEL_SIZE;
+  static constexpr u32 FREE_NODE = WHEEL_SIZE + 1;
+
+  struct Node
+  {
+    Event event;
+    u32 bucket;
+    u32 prev;
+    u32 next;
+    u32 type_prev;
+    u32 type_next;
+  };
+
+  u32 GetBucket(s64 time) const;
+  void Link(u32 index, u32 bucket);
+  void Unlink(u32 index);
+  void Free(u32 index);
+  u32 FindFront() const;
+  void MoveWheel(s64 time);
+
+  std::vector<Node> m_nodes;
+  u32 m_first_free = NONE;
+
+  // The last list holds the overflow events.
+  std::array<u32, WHEEL_SIZE + 1> m_bucket_heads;
+  std::array<u64, WHEEL_SIZE / 64> m_occupied_buckets{};
+
+  // The start time of the first bucket of the wheel. Events before it are put into that bucket.
+  s64 m_wheel_start = 0;
+  // No overflow event is earlier than this, but it may be earlier than all of them.
+  s64 m_overflow_min_time = std::numeric_limits<s64>::max();
+  size_t m_overflow_size = 0;
+  size_t m_size = 0;
+
+  u32 m_front = NONE;
+};
+
 enum class FromThread
 {
   CPU,
@@ -130,6 +212,12 @@ public:
   void Advance();
   void MoveEvents();
 
+  // Calls the callback once at the end of the current Advance(), after all due events have run and
+  // the next slice has been set up. Event callbacks must not save or load states themselves, as the
+  // events which already ran haven't been scheduled again at that point. They use this instead.
+  // Must be called from the CPU thread.
+  void RunAtSafePoint(SafePointCallback callback);
+
   // Pretend that the main CPU has executed enough cycles to reach the next event.
   void Idle();
 
@@ -179,17 +267,12 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::ranges::make_heap/push_heap/pop_heap.
-  // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-  // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
-  // by the standard adaptor class.
-  std::vector<Event> m_event_queue;
+  EventQueue m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
 
   // Event objects created from other threads.
   // The time value of each Event here is a cycles_into_future value.
-  Common::SPSCQueue<Event> m_ts_queue;
+  Common::MPSCQueue<Event> m_ts_queue;
 
   float m_last_oc_factor = 0.0f;
 
@@ -200,6 +283,8 @@ private:
   // Are we in a function that has been called from Advance()
   bool m_is_global_timer_sane = false;
 
+  std::vector<SafePointCallback> m_safe_point_callbacks;
+
   EventType* m_ev_lost = nullptr;
 
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
@@ -234,6 +234,12 @@ u16 Accelerator::ReadSample(const s16* coefs)
   return val;
 }
 
+void Accelerator::ReadSamples(const s16* coefs, s16* samples, u32 count)
+{
+  for (u32 i = 0; i < count; ++i)
+    samples[i] = static_cast<s16>(ReadSample(coefs));
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
@@ -16,6 +16,8 @@ public:
   virtual ~Accelerator() = default;
 
   u16 ReadSample(const s16* coefs);
+  // Reads count samples in a row, like calling ReadSample for each.
+  void ReadSamples(const s16* coefs, s16* samples, u32 count);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadRaw();
   void WriteRaw(u16 value);
@@ -60,6 +60,55 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0, 0},
 };
 
+// Loops found by FindIdleLoops are at most this many words long, branch included.
+constexpr u16 MAX_IDLE_LOOP_SIZE = 8;
+
+// Whether reading the given hardware register gives back state that only changes from outside of
+// the DSP, without any side effects. Reading the low halves of the mailboxes would clear them.
+static bool IsPolledRegister(u16 address)
+{
+  return address == (0xff00 | DSP_DMBH) || address == (0xff00 | DSP_CMBH) ||
+         address == (0xff00 | DSP_DSCR);
+}
+
+// Whether the instruction at addr can be part of a polling loop: it either reads one of the
+// polled registers, in which case polls is set, or only sets flags from registers.
+static bool IsIdleLoopInstruction(const SDSP& dsp, u16 addr, bool* polls)
+{
+  const UDSPInstruction inst = dsp.ReadIMEM(addr);
+  const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+  if (!opcode)
+    return false;
+
+  switch (opcode->opcode)
+  {
+  case 0x2000:  // LRS, like the signatures above this assumes $cr is 0xff
+  case 0x00c0:  // LR
+  {
+    const u16 address = opcode->opcode == 0x2000 ? (0xff00 | (inst & 0xff)) :
+                                                   dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    if (!IsPolledRegister(address))
+      return false;
+    *polls = true;
+    return true;
+  }
+  case 0x0000:  // NOP
+  case 0x0280:  // CMPI
+  case 0x02a0:  // ANDF
+  case 0x02c0:  // ANDCF
+  case 0x0600:  // CMPIS
+    return true;
+  case 0x8200:  // CMP
+  case 0x8600:  // TSTAXH
+  case 0xb100:  // TST
+  case 0xc100:  // CMPAXH
+    // Only without an extended opcode, as those can touch memory or change registers.
+    return (inst & 0x00fc) == 0;
+  default:
+    return false;
+  }
+}
+
 Analyzer::Analyzer() = default;
 Analyzer::~Analyzer() = default;
 
@@ -83,6 +132,7 @@ void Analyzer::AnalyzeRange(const SDSP& dsp, u16 start_addr, u16 end_addr)
 
   // Next, we'll scan for potential idle skips.
   FindIdleSkips(dsp, start_addr, end_addr);
+  FindIdleLoops(dsp, start_addr, end_addr);
 
   INFO_LOG_FMT(DSPLLE, "Finished analysis.");
 }
@@ -172,4 +222,34 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
     }
   }
 }
+
+void Analyzer::FindIdleLoops(const SDSP& dsp, u16 start_addr, u16 end_addr)
+{
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    // Look for conditional jumps backwards...
+    const UDSPInstruction inst = dsp.ReadIMEM(addr);
+    if (!IsStartOfInstruction(addr) || (inst & 0xfff0) != 0x0290 || inst == 0x029f)
+      continue;
+
+    const u16 loop_start = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    if (loop_start < start_addr || loop_start >= addr || addr - loop_start >= MAX_IDLE_LOOP_SIZE)
+      continue;
+
+    // ...over nothing but polling a register and testing the result.
+    bool polls = false;
+    u16 loop_addr = loop_start;
+    while (loop_addr < addr && IsStartOfInstruction(loop_addr) &&
+           IsIdleLoopInstruction(dsp, loop_addr, &polls))
+    {
+      loop_addr += GetOpTemplate(dsp.ReadIMEM(loop_addr))->size;
+    }
+
+    if (loop_addr == addr && polls && !IsIdleSkip(loop_start))
+    {
+      INFO_LOG_FMT(DSPLLE, "Idle loop found at {:02x}", loop_start);
+      m_code_flags[loop_start] |= CODE_IDLE_SKIP;
+    }
+  }
+}
 }  // namespace DSP
@@ -78,7 +78,6 @@ void DSPEmitter::ClearIRAM()
     m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
     m_block_links[i] = nullptr;
     m_block_size[i] = 0;
-    m_unresolved_jumps[i].clear();
   }
   m_dsp_core.DSPState().reset_dspjit_codespace = true;
 }
@@ -94,7 +93,6 @@ void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
     m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
     m_block_links[i] = nullptr;
     m_block_size[i] = 0;
-    m_unresolved_jumps[i].clear();
   }
   m_dsp_core.DSPState().reset_dspjit_codespace = false;
 }
@@ -231,7 +229,6 @@ void DSPEmitter::Compile(u16 start_addr)
 {
   // Remember the current block address for later
   m_start_address = start_addr;
-  m_unresolved_jumps[start_addr].clear();
 
   const u8* entryPoint = AlignCode16();
 
@@ -257,9 +254,6 @@ void DSPEmitter::Compile(u16 start_addr)
     m_block_size[start_addr]++;
     m_compile_pc += opcode->size;
 
-    // If the block was trying to link into itself, remove the link
-    m_unresolved_jumps[start_addr].remove(m_compile_pc);
-
     fixup_pc = true;
 
     // Handle loop condition, only if current instruction was flagged as a loop destination
@@ -285,14 +279,7 @@ void DSPEmitter::Compile(u16 start_addr)
       DSPJitRegCache c(m_gpr);
       HandleLoop();
       m_gpr.SaveRegs();
-      if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-      {
-        MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-      }
-      else
-      {
-        MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-      }
+      MOV(16, R(EAX), Imm16(GetBlockExitCycles()));
       JMP(m_return_dispatcher, Jump::Near);
       m_gpr.LoadRegs(false);
       m_gpr.FlushRegs(c, false);
@@ -321,14 +308,7 @@ void DSPEmitter::Compile(u16 start_addr)
         DSPJitRegCache c(m_gpr);
         // don't update g_dsp.pc -- the branch insn already did
         m_gpr.SaveRegs();
-        if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-        {
-          MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-        }
-        else
-        {
-          MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-        }
+        MOV(16, R(EAX), Imm16(GetBlockExitCycles()));
         JMP(m_return_dispatcher, Jump::Near);
         m_gpr.LoadRegs(false);
         m_gpr.FlushRegs(c, false);
@@ -347,33 +327,15 @@ void DSPEmitter::Compile(u16 start_addr)
   if (fixup_pc)
   {
     MOV(16, M_SDSP_pc(), Imm16(m_compile_pc));
+
+    // Run on into the next block without going through the dispatcher.
+    WriteBlockLink(m_compile_pc);
   }
 
   m_blocks[start_addr] = (DSPCompiledCode)entryPoint;
 
-  // Mark this block as a linkable destination if it does not contain
-  // any unresolved CALL's
-  if (m_unresolved_jumps[start_addr].empty())
-  {
-    m_block_links[start_addr] = m_block_link_entry;
-
-    for (size_t i = 0; i < 0xffff; ++i)
-    {
-      if (!m_unresolved_jumps[i].empty())
-      {
-        // Check if there were any blocks waiting for this block to be linkable
-        size_t size = m_unresolved_jumps[i].size();
-        m_unresolved_jumps[i].remove(start_addr);
-        if (m_unresolved_jumps[i].size() < size)
-        {
-          // Mark the block to be recompiled again
-          m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
-          m_block_links[i] = nullptr;
-          m_block_size[i] = 0;
-        }
-      }
-    }
-  }
+  // Links to this block written by other blocks, before or after, go live now.
+  m_block_links[start_addr] = m_block_link_entry;
 
   if (m_block_size[start_addr] == 0)
   {
@@ -384,37 +346,23 @@ void DSPEmitter::Compile(u16 start_addr)
   }
 
   m_gpr.SaveRegs();
-  if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-  {
-    MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-  }
-  else
-  {
-    MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-  }
+  MOV(16, R(EAX), Imm16(GetBlockExitCycles()));
   JMP(m_return_dispatcher, Jump::Near);
 }
 
-void DSPEmitter::CompileCurrent(DSPEmitter& emitter)
+u16 DSPEmitter::GetBlockExitCycles() const
 {
-  emitter.Compile(emitter.m_dsp_core.DSPState().pc);
+  // Idle loops give up the rest of their slice, there's nothing for them to do until the CPU
+  // side catches up.
+  if (m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
+    return DSP_IDLE_SKIP_CYCLES;
 
-  bool retry = true;
+  return m_block_size[m_start_address];
+}
 
-  while (retry)
-  {
-    retry = false;
-    for (size_t i = 0; i < 0xffff; ++i)
-    {
-      if (!emitter.m_unresolved_jumps[i].empty())
-      {
-        const u16 address_to_compile = emitter.m_unresolved_jumps[i].front();
-        emitter.Compile(address_to_compile);
-        if (!emitter.m_unresolved_jumps[i].empty())
-          retry = true;
-      }
-    }
-  }
+void DSPEmitter::CompileCurrent(DSPEmitter& emitter)
+{
+  emitter.Compile(emitter.m_dsp_core.DSPState().pc);
 }
 
 const u8* DSPEmitter::CompileStub()
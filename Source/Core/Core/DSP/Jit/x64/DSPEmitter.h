@@ -3,9 +3,7 @@
 
 #pragma once
 
-#include <array>
 #include <cstddef>
-#include <list>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -211,6 +209,7 @@ private:
 
   void FallBackToInterpreter(UDSPInstruction inst);
 
+  u16 GetBlockExitCycles() const;
   void WriteBranchExit();
   void WriteBlockLink(u16 dest);
 
@@ -321,8 +320,6 @@ private:
   std::vector<Block> m_block_links;
   Block m_block_link_entry;
 
-  std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
-
   u16 m_cycles_left = 0;
 
   // The index of the last stored ext value (compile time).
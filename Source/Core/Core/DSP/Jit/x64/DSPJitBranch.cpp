@@ -3,10 +3,13 @@
 
 #include "Core/DSP/Jit/x64/DSPEmitter.h"
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
 
 #include "Core/DSP/DSPAnalyzer.h"
 #include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
 #include "Core/DSP/DSPTables.h"
 
 using namespace Gen;
@@ -101,14 +104,7 @@ void DSPEmitter::WriteBranchExit()
 {
   DSPJitRegCache c(m_gpr);
   m_gpr.SaveRegs();
-  if (m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
-  {
-    MOV(16, R(EAX), Imm16(0x1000));
-  }
-  else
-  {
-    MOV(16, R(EAX), Imm16(m_block_size[m_start_address]));
-  }
+  MOV(16, R(EAX), Imm16(GetBlockExitCycles()));
   JMP(m_return_dispatcher, Jump::Near);
   m_gpr.LoadRegs(false);
   m_gpr.FlushRegs(c, false);
@@ -116,40 +112,50 @@ void DSPEmitter::WriteBranchExit()
 
 void DSPEmitter::WriteBlockLink(u16 dest)
 {
-  // Jump directly to the called block if it has already been compiled.
-  if (!(dest >= m_start_address && dest <= m_compile_pc))
+  // Idle loops have to go back to the dispatcher to give up the rest of their slice.
+  if (m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
+    return;
+
+  m_gpr.FlushRegs();
+
+  // Links go through m_block_links rather than jumping to the block directly, so they start
+  // working once the destination has been compiled (this block included, for loops) and stop
+  // when it gets thrown away, without this block having to be recompiled.
+  MOV(64, R(RAX), ImmPtr(&m_block_links[dest]));
+  MOV(64, R(RAX), MatR(RAX));
+  TEST(64, R(RAX), R(RAX));
+  FixupBranch notCompiled = J_CC(CC_Z);
+
+  FixupBranch interruptWaiting;
+  if (Host::OnThread())
   {
-    if (m_block_links[dest] != nullptr)
-    {
-      m_gpr.FlushRegs();
-      // Check if we have enough cycles to execute the next block
-      MOV(64, R(RAX), ImmPtr(&m_cycles_left));
-      MOV(16, R(ECX), MatR(RAX));
-      CMP(16, R(ECX), Imm16(m_block_size[m_start_address] + m_block_size[dest]));
-      FixupBranch notEnoughCycles = J_CC(CC_BE);
-
-      SUB(16, R(ECX), Imm16(m_block_size[m_start_address]));
-      MOV(16, MatR(RAX), R(ECX));
-      JMP(m_block_links[dest], Jump::Near);
-      SetJumpTarget(notEnoughCycles);
-    }
-    else
-    {
-      // The destination has not been compiled yet.  Add it to the list
-      // of blocks that this block is waiting on.
-      m_unresolved_jumps[m_start_address].push_back(dest);
-    }
+    CMP(8, M_SDSP_external_interrupt_waiting(), Imm8(0));
+    interruptWaiting = J_CC(CC_NE);
   }
+
+  // Check if we have enough cycles left to keep going, the same way the dispatcher does. A block
+  // that jumps back to itself from its first instruction still has to use some up.
+  const u16 cycles = std::max<u16>(m_block_size[m_start_address], 1);
+  MOV(64, R(RCX), ImmPtr(&m_cycles_left));
+  CMP(16, MatR(RCX), Imm16(cycles));
+  FixupBranch notEnoughCycles = J_CC(CC_BE);
+
+  SUB(16, MatR(RCX), Imm16(cycles));
+  JMPptr(R(RAX));
+
+  SetJumpTarget(notCompiled);
+  if (Host::OnThread())
+    SetJumpTarget(interruptWaiting);
+  SetJumpTarget(notEnoughCycles);
 }
 
 void DSPEmitter::r_jcc(const UDSPInstruction opc)
 {
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
-  const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
-    WriteBlockLink(dest);
+  // Conditional jumps are linked too, ReJitConditional restores the register cache for the path
+  // that doesn't branch.
+  WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
 }
@@ -192,11 +198,8 @@ void DSPEmitter::r_call(const UDSPInstruction opc)
   MOV(16, R(DX), Imm16(m_compile_pc + 2));
   dsp_reg_store_stack(StackRegister::Call);
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
-  const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
-    WriteBlockLink(dest);
+  WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
 }
@@ -32,6 +32,10 @@ public:
   virtual u16 DSP_WriteControlRegister(u16 value) = 0;
   virtual void DSP_Update(int cycles) = 0;
   virtual void DSP_StopSoundStream() = 0;
+
+  // Returns the number of CPU cycles until the next DSP_Update. Emulators may adapt it to what
+  // happened since the previous call, so it must only be called once per update, by the DSP
+  // timeslicing event in SystemTimers.
   virtual u32 DSP_UpdateRate() = 0;
 
 protected:
@@ -133,7 +133,8 @@ void DolphinAnalytics::ReportGameStart()
   Send(builder);
 
   // Reset per-game state.
-  m_reported_quirks.fill(false);
+  for (auto& reported_quirk : m_reported_quirks)
+    reported_quirk.store(false, std::memory_order_relaxed);
   InitializePerformanceSampling();
 }
 
@@ -180,10 +181,9 @@ void DolphinAnalytics::ReportGameQuirk(GameQuirk quirk)
 {
   u32 quirk_idx = static_cast<u32>(quirk);
 
-  // Only report once per run.
-  if (m_reported_quirks[quirk_idx])
+  // Only report once per run. This can be called from more than one thread at a time.
+  if (m_reported_quirks[quirk_idx].exchange(true, std::memory_order_relaxed))
     return;
-  m_reported_quirks[quirk_idx] = true;
 
   Common::AnalyticsReportBuilder builder(m_per_game_builder);
   builder.AddData("type", "quirk");
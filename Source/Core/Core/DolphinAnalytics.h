@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -186,7 +187,7 @@ private:
   std::vector<PerformanceSample> m_performance_samples;
 
   // What quirks have already been reported about the current game.
-  std::array<bool, static_cast<size_t>(GameQuirk::COUNT)> m_reported_quirks;
+  std::array<std::atomic<bool>, static_cast<size_t>(GameQuirk::COUNT)> m_reported_quirks{};
 
   // Builder that contains all non variable data that should be sent with all
   // reports.
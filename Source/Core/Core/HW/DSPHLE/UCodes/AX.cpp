@@ -15,6 +15,7 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
@@ -50,6 +51,10 @@ void AXUCode::InitializeShared()
   m_mail_handler.PushMail(DSP_INIT, true);
 
   LoadResamplingCoefficients(false, 0);
+
+  const int voice_worker_count = Config::Get(Config::MAIN_DSP_HLE_VOICE_THREADS);
+  if (voice_worker_count > 0)
+    m_voice_workers.Start("AX Voice Worker", static_cast<u32>(voice_worker_count));
 }
 
 bool AXUCode::LoadResamplingCoefficients(bool require_same_checksum, u32 desired_checksum)
@@ -461,31 +466,58 @@ void AXUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
-  AXPB pb;
-
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  while (pb_addr)
-  {
-    AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
-
-    ReadPB(memory, pb_addr, pb);
-
-    PBUpdateData updates = LoadPBUpdates(memory, pb);
+  const AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+                              m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                              m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
 
+  // Processes a whole frame of a voice. Only thread safe as long as the accelerators differ.
+  const auto process_voice = [this](HLEAccelerator* accelerator, AXPB& pb,
+                                    const PBUpdateData* updates, AXBuffers voice_buffers) {
     for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
     {
-      ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
+      if (updates)
+        ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, *updates);
 
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
-                   ConvertMixerControl(pb.mixer_control),
+      ProcessVoice(accelerator, pb, voice_buffers, spms, ConvertMixerControl(pb.mixer_control),
                    m_coeffs_checksum ? m_coeffs.data() : nullptr, false);
 
       // Forward the buffers
-      for (auto& ptr : buffers.ptrs)
+      for (auto& ptr : voice_buffers.ptrs)
         ptr += spms;
     }
+  };
+
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  auto* const accelerator = static_cast<HLEAccelerator*>(m_accelerator.get());
+
+  if (m_voice_workers.GetThreadCount() > 1)
+  {
+    std::vector<QueuedVoice> voices;
+    const auto read_pb = [&](u32 addr, AXPB& pb) { ReadPB(memory, addr, pb); };
+    if (QueuePBList(memory, pb_addr, true, read_pb, voices))
+    {
+      ProcessQueuedVoices(m_voice_workers, m_dsphle->GetSystem().GetDSP(), voices, accelerator,
+                          buffers, m_worker_accelerators, m_worker_samples,
+                          [&](HLEAccelerator* thread_accelerator, QueuedVoice& voice,
+                              const AXBuffers& thread_buffers) {
+                            process_voice(thread_accelerator, voice.pb,
+                                          voice.has_updates ? &voice.updates : nullptr,
+                                          thread_buffers);
+                          });
+
+      for (const QueuedVoice& voice : voices)
+        WritePB(memory, voice.addr, voice.pb);
+      return;
+    }
+  }
+
+  AXPB pb;
+  while (pb_addr)
+  {
+    ReadPB(memory, pb_addr, pb);
+
+    PBUpdateData updates = LoadPBUpdates(memory, pb);
+    process_voice(accelerator, pb, &updates, buffers);
 
     WritePB(memory, pb_addr, pb);
     pb_addr = HILO_TO_32(pb.next_pb);
@@ -14,9 +14,11 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
+#include "Common/ForkJoinPool.h"
 #include "Common/Swap.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -111,6 +113,12 @@ protected:
 
   std::unique_ptr<Accelerator> m_accelerator;
 
+  // Threads helping to process the voices of PB lists, if enabled, with an accelerator and mixing
+  // buffers for each of them. The emulation thread processes voices as well, with the state above.
+  Common::ForkJoinPool m_voice_workers;
+  std::vector<std::unique_ptr<Accelerator>> m_worker_accelerators;
+  std::vector<std::vector<int>> m_worker_samples;
+
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
   AXUCode(DSPHLE* dsphle, u32 crc, bool dummy);
 
@@ -12,16 +12,22 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <functional>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/ForkJoinPool.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceSamples.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
@@ -117,9 +123,20 @@ union AXBuffers
     int* regular_ptrs[12];
     int* wiimote_ptrs[8];
   };
+  int* ptrs[20];
 #endif
 };
 
+// Number of samples each of the buffers in AXBuffers holds for a whole frame.
+constexpr u32 GetFrameBufferSize(size_t index)
+{
+#ifdef AX_GC
+  return 32 * 5;
+#else
+  return index < 12 ? 32 * 3 : 6 * 3;
+#endif
+}
+
 // Simulated accelerator state.
 class HLEAccelerator final : public Accelerator
 {
@@ -187,146 +204,6 @@ void AcceleratorSetup(HLEAccelerator* accelerator, PB_TYPE* pb)
   accelerator->SetPredScale(pb->adpcm.pred_scale);
 }
 
-// Reads a sample from the accelerator. Also handles looping and
-// disabling streams that reached the end (this is done by an exception raised
-// by the accelerator on real hardware).
-u16 AcceleratorGetSample(HLEAccelerator* accelerator)
-{
-  return accelerator->ReadSample(accelerator->acc_pb->adpcm.coefs);
-}
-
-// Reads samples from the input callback, resamples them to <count> samples at
-// the wanted sample rate (computed from the ratio, see below).
-//
-// If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
-// (or the srctype will automatically be changed to LINEAR).
-//
-// Returns the current position after resampling (including fractional part).
-//
-// The input to output ratio is set in <ratio>, which is a floating point num
-// stored as a 32b integer:
-//  * Upper 16 bits of the ratio are the integer part
-//  * Lower 16 bits are the decimal part
-//
-// <curr_pos> is a 32b integer structured in the same way as the ratio: the
-// upper 16 bits are the integer part of the current position in the input
-// stream, and the lower 16 bits are the decimal part.
-//
-// We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
-// avoids discontinuities in the audio stream, especially with very low ratios
-// which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
-                  u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
-{
-  int read_samples_count = 0;
-
-  // If DSP DROM coefficients are available, support polyphase resampling.
-  if (coeffs && srctype == SRCTYPE_POLYPHASE)
-  {
-    s16 temp[4];
-    u32 idx = 0;
-
-    temp[idx++ & 3] = last_samples[0];
-    temp[idx++ & 3] = last_samples[1];
-    temp[idx++ & 3] = last_samples[2];
-    temp[idx++ & 3] = last_samples[3];
-
-    for (u32 i = 0; i < count; ++i)
-    {
-      curr_pos += ratio;
-      while (curr_pos >= 0x10000)
-      {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
-        curr_pos -= 0x10000;
-      }
-
-      u16 curr_pos_frac = ((curr_pos & 0xFFFF) >> 9) << 2;
-      const s16* c = &coeffs[curr_pos_frac];
-
-      s64 t0 = temp[idx++ & 3];
-      s64 t1 = temp[idx++ & 3];
-      s64 t2 = temp[idx++ & 3];
-      s64 t3 = temp[idx++ & 3];
-
-      s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
-
-      output[i] = MathUtil::SaturatingCast<s16>(samp);
-    }
-
-    last_samples[3] = temp[--idx & 3];
-    last_samples[2] = temp[--idx & 3];
-    last_samples[1] = temp[--idx & 3];
-    last_samples[0] = temp[--idx & 3];
-  }
-  else if (srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE)
-  {
-    // This is the circular buffer containing samples to use for the
-    // interpolation. It is initialized with the values from the PB, and it
-    // will be stored back to the PB at the end.
-    s16 temp[4];
-    u32 idx = 0;
-
-    temp[idx++ & 3] = last_samples[0];
-    temp[idx++ & 3] = last_samples[1];
-    temp[idx++ & 3] = last_samples[2];
-    temp[idx++ & 3] = last_samples[3];
-
-    for (u32 i = 0; i < count; ++i)
-    {
-      curr_pos += ratio;
-
-      // While our current position is >= 1.0, push new samples to the
-      // circular buffer.
-      while (curr_pos >= 0x10000)
-      {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
-        curr_pos -= 0x10000;
-      }
-
-      // Get our current fractional position, used to know how much of
-      // curr0 and how much of curr1 the output sample should be.
-      u16 curr_frac = curr_pos & 0xFFFF;
-      u16 inv_curr_frac = -curr_frac;
-
-      // Interpolate! If curr_frac is 0, we can simply take the last
-      // sample without any multiplying.
-      s16 sample;
-      if (curr_frac)
-      {
-        s32 s0 = temp[idx++ & 3];
-        s32 s1 = temp[idx++ & 3];
-
-        sample = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
-        idx += 2;
-      }
-      else
-      {
-        sample = temp[idx++ & 3];
-        idx += 3;
-      }
-
-      output[i] = sample;
-    }
-
-    // Update the four last_samples values.
-    last_samples[3] = temp[--idx & 3];
-    last_samples[2] = temp[--idx & 3];
-    last_samples[1] = temp[--idx & 3];
-    last_samples[0] = temp[--idx & 3];
-  }
-  else  // SRCTYPE_NEAREST
-  {
-    // No sample rate conversion here: simply read samples from the
-    // accelerator to the output buffer.
-    for (u32 i = 0; i < count; ++i)
-      output[i] = input_callback(i);
-
-    memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
-  }
-
-  return curr_pos;
-}
-
 // Read <count> input samples from ARAM, decoding and converting rate
 // if required.
 void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
@@ -336,9 +213,13 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+  // Looping and disabling streams that reached the end are handled by the accelerator's end
+  // exception, like on real hardware.
+  const auto read_input = [accelerator](s16* input, u32 input_count) {
+    accelerator->ReadSamples(accelerator->acc_pb->adpcm.coefs, input, input_count);
+  };
+  u32 curr_pos = ResampleAudio(read_input, samples, count, pb.src.last_samples,
+                               pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -357,27 +238,8 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
-  // mixing loop can avoid testing if volume ramping is enabled at each step,
-  // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
-
-    out[i] += sample16;
-    volume += volume_delta;
-
-    *dpop = sample16;
-  }
+  // If volume ramping is disabled, use a volume_delta of 0.
+  MixAddSamples(out, input, count, vd->volume, ramp ? vd->volume_delta : 0, *dpop);
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -430,19 +292,15 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  pb.vol_env.cur_volume = static_cast<s16>(ApplyVolumeRamp(
+      samples, count, pb.vol_env.cur_volume, pb.vol_env.cur_volume_delta, signed_volume));
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
@@ -566,9 +424,13 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 
     // We use ratio 0x55555 == (5 * 65536 + 21845) / 65536 == 5.3333 which
     // is the nearest we can get to 96/18
-    u32 curr_pos = ResampleAudio([&samples](u32 i) { return samples[i]; }, wm_samples, wm_count,
-                                 pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
-                                 SRCTYPE_POLYPHASE, coeffs);
+    const s16* wm_input = samples;
+    const auto read_input = [&wm_input](s16* input, u32 input_count) {
+      std::copy_n(wm_input, input_count, input);
+      wm_input += input_count;
+    };
+    u32 curr_pos = ResampleAudio(read_input, wm_samples, wm_count, pb.remote_src.last_samples,
+                                 pb.remote_src.cur_addr_frac, 0x55555, SRCTYPE_POLYPHASE, coeffs);
     pb.remote_src.cur_addr_frac = curr_pos & 0xFFFF;
 
 // Mix to main[0-3] and aux[0-3]
@@ -605,6 +467,154 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #endif
 }
 
+// A voice read from a PB list ahead of processing it, so that the voices of a list can be
+// processed on several threads.
+struct QueuedVoice
+{
+  u32 addr;
+  PB_TYPE pb;
+  bool has_updates;
+  PBUpdateData updates;
+};
+
+// PB lists with more voices than this are always processed one voice after another.
+constexpr size_t MAX_QUEUED_VOICES = 256;
+
+// Reads the PB list starting at pb_addr into voices, using read_pb(addr, pb) to read each PB, and
+// loads the updates of the PBs which have some if apply_updates is set.
+//
+// Returns false if the list can't be processed this way and has to be processed one voice after
+// another: when it is too long, or when writing a PB back to memory could change another PB or the
+// updates of a voice.
+template <typename ReadPB>
+bool QueuePBList(Memory::MemoryManager& memory, u32 pb_addr, bool apply_updates, ReadPB&& read_pb,
+                 std::vector<QueuedVoice>& voices)
+{
+  voices.clear();
+  while (pb_addr)
+  {
+    if (voices.size() == MAX_QUEUED_VOICES)
+      return false;
+
+    QueuedVoice& voice = voices.emplace_back();
+    voice.addr = pb_addr;
+    read_pb(pb_addr, voice.pb);
+
+    u32 update_count = 0;
+    if (apply_updates)
+    {
+      for (u16 num_updates : voice.pb.updates.num_updates)
+        update_count += num_updates;
+      if (update_count > voice.updates.size())
+        return false;
+    }
+
+    voice.has_updates = update_count != 0;
+    if (voice.has_updates)
+      voice.updates = LoadPBUpdates(memory, voice.pb);
+
+    // The address of the next PB is only read once all updates have been applied.
+    auto next_pb = std::array<u16, 2>{voice.pb.next_pb_hi, voice.pb.next_pb_lo};
+    if (voice.has_updates)
+    {
+      constexpr u16 next_pb_offset = offsetof(PB_TYPE, next_pb_hi) / sizeof(u16);
+      for (u32 i = 0; i < update_count; ++i)
+      {
+        const u16 offset = voice.updates[i].pb_offset - next_pb_offset;
+        if (offset < next_pb.size())
+          next_pb[offset] = voice.updates[i].new_value;
+      }
+    }
+    pb_addr = (u32(next_pb[0]) << 16) | next_pb[1];
+  }
+
+  std::vector<u32> pb_addrs(voices.size());
+  std::transform(voices.begin(), voices.end(), pb_addrs.begin(),
+                 [](const QueuedVoice& voice) { return voice.addr; });
+  std::sort(pb_addrs.begin(), pb_addrs.end());
+  for (size_t i = 1; i < pb_addrs.size(); ++i)
+  {
+    if (pb_addrs[i] - pb_addrs[i - 1] < sizeof(PB_TYPE))
+      return false;
+  }
+
+  for (const QueuedVoice& voice : voices)
+  {
+    if (!voice.has_updates)
+      continue;
+
+    // Since PBs don't overlap, only the last one starting before the end of the updates can.
+    const u32 updates_addr = HILO_TO_32(voice.pb.updates.data);
+    const auto next = std::upper_bound(pb_addrs.begin(), pb_addrs.end(),
+                                       updates_addr + u32(sizeof(PBUpdateData)) - 1);
+    if (next != pb_addrs.begin() && *std::prev(next) + sizeof(PB_TYPE) > updates_addr)
+      return false;
+  }
+
+  return true;
+}
+
+// Processes the queued voices with process_voice(accelerator, voice, buffers), spread over the
+// threads of the pool. The calling thread uses the given accelerator and mixes to the given
+// buffers, while the other threads have an accelerator and buffers of their own. What they mixed
+// is added to the given buffers afterwards, which gives the same samples as processing the voices
+// one after another since mixing only ever adds to the buffers.
+template <typename ProcessQueuedVoice>
+void ProcessQueuedVoices(Common::ForkJoinPool& pool, DSPManager& dsp,
+                         std::vector<QueuedVoice>& voices, HLEAccelerator* accelerator,
+                         const AXBuffers& buffers,
+                         std::vector<std::unique_ptr<Accelerator>>& worker_accelerators,
+                         std::vector<std::vector<int>>& worker_samples,
+                         ProcessQueuedVoice&& process_voice)
+{
+  constexpr size_t BUFFER_COUNT = std::extent_v<decltype(AXBuffers::ptrs)>;
+  constexpr u32 FRAME_SAMPLES = [] {
+    u32 total = 0;
+    for (size_t i = 0; i < BUFFER_COUNT; ++i)
+      total += GetFrameBufferSize(i);
+    return total;
+  }();
+
+  const u32 thread_count = pool.GetThreadCount();
+  while (worker_accelerators.size() < thread_count - 1)
+    worker_accelerators.push_back(std::make_unique<HLEAccelerator>(dsp));
+  worker_samples.resize(thread_count - 1);
+
+  std::vector<AXBuffers> thread_buffers(thread_count, buffers);
+  for (u32 thread = 1; thread < thread_count; ++thread)
+  {
+    std::vector<int>& samples = worker_samples[thread - 1];
+    if (samples.size() != FRAME_SAMPLES)
+      samples.assign(FRAME_SAMPLES, 0);
+
+    int* ptr = samples.data();
+    for (size_t i = 0; i < BUFFER_COUNT; ++i)
+    {
+      thread_buffers[thread].ptrs[i] = ptr;
+      ptr += GetFrameBufferSize(i);
+    }
+  }
+
+  pool.ParallelFor(static_cast<u32>(voices.size()), [&](u32 thread, u32 item) {
+    HLEAccelerator* const thread_accelerator =
+        thread == 0 ? accelerator :
+                      static_cast<HLEAccelerator*>(worker_accelerators[thread - 1].get());
+    process_voice(thread_accelerator, voices[item], thread_buffers[thread]);
+  });
+
+  // Add what the other threads mixed, and clear their buffers for the next list.
+  for (u32 thread = 1; thread < thread_count; ++thread)
+  {
+    for (size_t i = 0; i < BUFFER_COUNT; ++i)
+    {
+      int* const thread_buffer = thread_buffers[thread].ptrs[i];
+      for (u32 j = 0; j < GetFrameBufferSize(i); ++j)
+        buffers.ptrs[i][j] += thread_buffer[j];
+    }
+    std::fill(worker_samples[thread - 1].begin(), worker_samples[thread - 1].end(), 0);
+  }
+}
+
 }  // namespace
 }  // inline namespace AXGC/AXWii
 }  // namespace DSP::HLE
@@ -0,0 +1,190 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXVoiceSamples.h"
+
+#include <algorithm>
+
+#if defined(_M_X86_64)
+#include <immintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE
+{
+static s16 ClampS16(s64 sample)
+{
+  return static_cast<s16>(std::clamp<s64>(sample, -0x8000, 0x7FFF));
+}
+
+// The vector code handles 8 samples at a time. Each sample is multiplied by its volume into 32
+// bits, shifted right by 15 and saturated to 16 bits, which is what the scalar code does as well.
+#if defined(_M_X86_64)
+static __m128i GetVolumes(u16 volume, u16 volume_delta)
+{
+  return _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(volume)),
+                       _mm_mullo_epi16(_mm_set1_epi16(static_cast<s16>(volume_delta)),
+                                       _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7)));
+}
+
+static __m128i MultiplyByVolumes(__m128i samples, __m128i volumes, bool signed_volume)
+{
+  const __m128i low = _mm_mullo_epi16(samples, volumes);
+  __m128i high = _mm_mulhi_epi16(samples, volumes);
+  // The high half of the product by an unsigned volume of 0x8000 or more is the signed one plus
+  // the sample.
+  if (!signed_volume)
+    high = _mm_add_epi16(high, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+
+  const __m128i first = _mm_srai_epi32(_mm_unpacklo_epi16(low, high), 15);
+  const __m128i second = _mm_srai_epi32(_mm_unpackhi_epi16(low, high), 15);
+  return _mm_packs_epi32(first, second);
+}
+#elif defined(_M_ARM_64)
+static uint16x8_t GetVolumes(u16 volume, u16 volume_delta)
+{
+  static constexpr u16 lanes[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  return vmlaq_n_u16(vdupq_n_u16(volume), vld1q_u16(lanes), volume_delta);
+}
+
+static int16x8_t MultiplyByVolumes(int16x8_t samples, uint16x8_t volumes, bool signed_volume)
+{
+  int32x4_t first, second;
+  if (signed_volume)
+  {
+    const int16x8_t signed_volumes = vreinterpretq_s16_u16(volumes);
+    first = vmull_s16(vget_low_s16(samples), vget_low_s16(signed_volumes));
+    second = vmull_high_s16(samples, signed_volumes);
+  }
+  else
+  {
+    first = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                      vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volumes))));
+    second = vmulq_s32(vmovl_high_s16(samples), vreinterpretq_s32_u32(vmovl_high_u16(volumes)));
+  }
+  return vcombine_s16(vqshrn_n_s32(first, 15), vqshrn_n_s32(second, 15));
+}
+#endif
+
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  __m128i volumes = GetVolumes(volume, volume_delta);
+  const __m128i volumes_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i),
+                     MultiplyByVolumes(input, volumes, signed_volume));
+    volumes = _mm_add_epi16(volumes, volumes_step);
+  }
+#elif defined(_M_ARM_64)
+  uint16x8_t volumes = GetVolumes(volume, volume_delta);
+  const uint16x8_t volumes_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_s16(samples + i, MultiplyByVolumes(vld1q_s16(samples + i), volumes, signed_volume));
+    volumes = vaddq_u16(volumes, volumes_step);
+  }
+#endif
+  volume += static_cast<u16>(volume_delta * i);
+
+  for (; i < count; ++i)
+  {
+    const s32 sample_volume = signed_volume ? s32(s16(volume)) : s32(volume);
+    samples[i] = ClampS16((s32(samples[i]) * sample_volume) >> 15);
+    volume += volume_delta;
+  }
+
+  return volume;
+}
+
+void MixAddSamples(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                   s16& last_sample)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  __m128i volumes = GetVolumes(volume, volume_delta);
+  const __m128i volumes_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = MultiplyByVolumes(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), volumes, false);
+    volumes = _mm_add_epi16(volumes, volumes_step);
+
+    __m128i* const out_vector = reinterpret_cast<__m128i*>(out + i);
+    const __m128i first = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+    const __m128i second = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+    _mm_storeu_si128(out_vector, _mm_add_epi32(_mm_loadu_si128(out_vector), first));
+    _mm_storeu_si128(out_vector + 1, _mm_add_epi32(_mm_loadu_si128(out_vector + 1), second));
+
+    last_sample = static_cast<s16>(_mm_extract_epi16(samples, 7));
+  }
+#elif defined(_M_ARM_64)
+  uint16x8_t volumes = GetVolumes(volume, volume_delta);
+  const uint16x8_t volumes_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t samples = MultiplyByVolumes(vld1q_s16(input + i), volumes, false);
+    volumes = vaddq_u16(volumes, volumes_step);
+
+    vst1q_s32(out + i, vaddw_s16(vld1q_s32(out + i), vget_low_s16(samples)));
+    vst1q_s32(out + i + 4, vaddw_high_s16(vld1q_s32(out + i + 4), samples));
+
+    last_sample = vgetq_lane_s16(samples, 7);
+  }
+#endif
+  volume += static_cast<u16>(volume_delta * i);
+
+  for (; i < count; ++i)
+  {
+    const s16 sample = ClampS16((s32(input[i]) * s32(volume)) >> 15);
+    out[i] += sample;
+    volume += volume_delta;
+    last_sample = sample;
+  }
+}
+
+void ResampleLinear(const s16* input, const u16* positions, const u16* fracs, s16* output,
+                    u32 count)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s16* const window = input + positions[i];
+
+    // Interpolate between the two oldest samples of the window. If the fractional position is 0,
+    // we can simply take the oldest sample without any multiplying.
+    const u16 curr_frac = fracs[i];
+    const u16 inv_curr_frac = -curr_frac;
+    if (curr_frac)
+    {
+      const s32 s0 = window[0];
+      const s32 s1 = window[1];
+      output[i] = static_cast<s16>((s0 * inv_curr_frac + s1 * curr_frac) >> 16);
+    }
+    else
+    {
+      output[i] = window[0];
+    }
+  }
+}
+
+void ResamplePolyphase(const s16* input, const u16* positions, const u16* fracs, s16* output,
+                       u32 count, const s16* coeffs)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s16* const window = input + positions[i];
+    const s16* const c = &coeffs[(fracs[i] >> 9) << 2];
+
+    const s64 sample = (s64(window[0]) * c[0] + s64(window[1]) * c[1] + s64(window[2]) * c[2] +
+                        s64(window[3]) * c[3]) >>
+                       15;
+    output[i] = ClampS16(sample);
+  }
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Sample processing shared by the GC and Wii versions of AX. These work on a block of samples at
+// a time, using SIMD where the computation allows it, and give the same results as handling each
+// sample in turn like the DSP does.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+
+namespace DSP::HLE
+{
+// Multiplies the samples by a volume which changes by volume_delta after each sample, saturating
+// the results. The volume is signed on GameCube and unsigned on Wii. Returns the volume after the
+// last sample.
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume);
+
+// Adds the samples, multiplied by a volume which changes by volume_delta after each sample, to
+// out. Updates volume, and stores the last sample that was added to last_sample.
+void MixAddSamples(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                   s16& last_sample);
+
+// Compute output samples from windows of input, starting at input[positions[i]] for output[i] and
+// weighted by the fractional position fracs[i].
+void ResampleLinear(const s16* input, const u16* positions, const u16* fracs, s16* output,
+                    u32 count);
+void ResamplePolyphase(const s16* input, const u16* positions, const u16* fracs, s16* output,
+                       u32 count, const s16* coeffs);
+
+// Reads samples with read_input(s16* samples, u32 count) and resamples them to <count> samples at
+// the wanted sample rate (computed from the ratio, see below).
+//
+// If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
+// (or the srctype will automatically be changed to LINEAR).
+//
+// Returns the current position after resampling (including fractional part).
+//
+// The input to output ratio is set in <ratio>, which is a floating point num
+// stored as a 32b integer:
+//  * Upper 16 bits of the ratio are the integer part
+//  * Lower 16 bits are the decimal part
+//
+// <curr_pos> is a 32b integer structured in the same way as the ratio: the
+// upper 16 bits are the integer part of the current position in the input
+// stream, and the lower 16 bits are the decimal part.
+//
+// We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
+// avoids discontinuities in the audio stream, especially with very low ratios
+// which interpolate a lot of values between two "real" samples.
+template <typename ReadInput>
+u32 ResampleAudio(ReadInput&& read_input, s16* output, u32 count, s16* last_samples, u32 curr_pos,
+                  u32 ratio, int srctype, const s16* coeffs)
+{
+  // If DSP DROM coefficients are available, support polyphase resampling.
+  const bool polyphase = coeffs && srctype == SRCTYPE_POLYPHASE;
+  if (!polyphase && srctype != SRCTYPE_LINEAR && srctype != SRCTYPE_POLYPHASE)
+  {
+    // SRCTYPE_NEAREST: No sample rate conversion here, simply read samples to the output buffer.
+    read_input(output, count);
+    std::copy_n(output + count - 4, 4, last_samples);
+    return curr_pos;
+  }
+
+  // Input samples are read in blocks of up to this many, and the positions within them of up to
+  // this many output samples are worked out at once.
+  constexpr u32 BLOCK_SIZE = 256;
+
+  // The four last samples of the previous block (initially from the PB), followed by the block.
+  std::array<s16, 4 + BLOCK_SIZE> input;
+  std::array<u16, BLOCK_SIZE> positions;
+  std::array<u16, BLOCK_SIZE> fracs;
+  std::copy_n(last_samples, 4, input.begin());
+
+  u32 done = 0;
+  while (done < count)
+  {
+    u32 read_count = 0;
+    u32 block_count = 0;
+    while (done + block_count < count && block_count < BLOCK_SIZE)
+    {
+      const u32 next_pos = curr_pos + ratio;
+      u32 step = next_pos >> 16;
+      if (read_count + step > BLOCK_SIZE)
+      {
+        if (block_count != 0)
+          break;
+
+        // Only the last four of the samples skipped over here are used.
+        while (step > BLOCK_SIZE)
+        {
+          const u32 skipped = std::min(step - BLOCK_SIZE, BLOCK_SIZE);
+          read_input(&input[4], skipped);
+          std::copy_n(&input[skipped], 4, input.begin());
+          step -= skipped;
+        }
+      }
+
+      curr_pos = next_pos & 0xFFFF;
+      read_count += step;
+      positions[block_count] = static_cast<u16>(read_count);
+      fracs[block_count] = static_cast<u16>(curr_pos);
+      ++block_count;
+    }
+
+    read_input(&input[4], read_count);
+    if (polyphase)
+    {
+      ResamplePolyphase(input.data(), positions.data(), fracs.data(), output + done, block_count,
+                        coeffs);
+    }
+    else
+    {
+      ResampleLinear(input.data(), positions.data(), fracs.data(), output + done, block_count);
+    }
+
+    std::copy_n(&input[read_count], 4, input.begin());
+    done += block_count;
+  }
+
+  std::copy_n(input.begin(), 4, last_samples);
+  return curr_pos;
+}
+}  // namespace DSP::HLE
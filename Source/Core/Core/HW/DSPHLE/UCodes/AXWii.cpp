@@ -437,45 +437,80 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   // 32KHz to 48KHz, but AX always process at 32KHz.
   constexpr u32 spms = 32;
 
-  AXPBWii pb;
-
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  while (pb_addr)
-  {
-    AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
-                          m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
-                          m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
-                          m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
-                          m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
-                          m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
-                          m_samples_wm3,       m_samples_aux3}};
-
-    ReadPB(memory, pb_addr, pb);
-
-    if (m_old_axwii &&
-        (pb.updates.num_updates[0] | pb.updates.num_updates[1] | pb.updates.num_updates[2]))
+  const AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+                              m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                              m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
+                              m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
+                              m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
+                              m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
+                              m_samples_wm3,       m_samples_aux3}};
+
+  // Processes a whole frame of a voice. Only thread safe as long as the accelerators differ.
+  const auto process_voice = [this](HLEAccelerator* accelerator, AXPBWii& pb,
+                                    const PBUpdateData* updates, AXBuffers voice_buffers) {
+    if (updates)
     {
-      PBUpdateData updates = LoadPBUpdates(memory, pb);
       for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
       {
-        ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
-        ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, spms,
+        ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, *updates);
+        ProcessVoice(accelerator, pb, voice_buffers, spms,
                      ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
                      m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
 
         // Forward the buffers
-        for (auto& ptr : buffers.regular_ptrs)
+        for (auto& ptr : voice_buffers.regular_ptrs)
           ptr += spms;
-        for (auto& ptr : buffers.wiimote_ptrs)
+        for (auto& ptr : voice_buffers.wiimote_ptrs)
           ptr += 6;
       }
     }
     else
     {
-      ProcessVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), pb, buffers, 96,
+      ProcessVoice(accelerator, pb, voice_buffers, 96,
                    ConvertMixerControl(HILO_TO_32(pb.mixer_control)),
                    m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
     }
+  };
+
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  auto* const accelerator = static_cast<HLEAccelerator*>(m_accelerator.get());
+
+  if (m_voice_workers.GetThreadCount() > 1)
+  {
+    std::vector<QueuedVoice> voices;
+    const auto read_pb = [&](u32 addr, AXPBWii& pb) { ReadPB(memory, addr, pb); };
+    if (QueuePBList(memory, pb_addr, m_old_axwii, read_pb, voices))
+    {
+      ProcessQueuedVoices(m_voice_workers, m_dsphle->GetSystem().GetDSP(), voices, accelerator,
+                          buffers, m_worker_accelerators, m_worker_samples,
+                          [&](HLEAccelerator* thread_accelerator, QueuedVoice& voice,
+                              const AXBuffers& thread_buffers) {
+                            process_voice(thread_accelerator, voice.pb,
+                                          voice.has_updates ? &voice.updates : nullptr,
+                                          thread_buffers);
+                          });
+
+      for (const QueuedVoice& voice : voices)
+        WritePB(memory, voice.addr, voice.pb);
+      return;
+    }
+  }
+
+  AXPBWii pb;
+  while (pb_addr)
+  {
+    ReadPB(memory, pb_addr, pb);
+
+    if (m_old_axwii &&
+        (pb.updates.num_updates[0] | pb.updates.num_updates[1] | pb.updates.num_updates[2]))
+    {
+      PBUpdateData updates = LoadPBUpdates(memory, pb);
+      process_voice(accelerator, pb, &updates, buffers);
+    }
+    else
+    {
+      process_voice(accelerator, pb, nullptr, buffers);
+    }
 
     WritePB(memory, pb_addr, pb);
     pb_addr = HILO_TO_32(pb.next_pb);
@@ -3,6 +3,7 @@
 
 #include "Core/HW/DSPLLE/DSPLLE.h"
 
+#include <algorithm>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -10,7 +11,6 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
-#include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
@@ -30,6 +30,14 @@
 
 namespace DSP::LLE
 {
+// How many CPU cycles pass between DSP updates. The DSP runs at 1/6th of the CPU clock.
+constexpr u32 DEFAULT_UPDATE_RATE = 12600;  // TO BE TWEAKED
+constexpr u32 MIN_UPDATE_RATE = DEFAULT_UPDATE_RATE / 4;
+constexpr u32 MAX_UPDATE_RATE = DEFAULT_UPDATE_RATE * 4;
+
+// More mailbox reads than this between two updates means the game is waiting for the DSP.
+constexpr u32 BUSY_MAILBOX_POLLS = 4;
+
 DSPLLE::DSPLLE() = default;
 
 DSPLLE::~DSPLLE()
@@ -60,7 +68,7 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 
   while (dsp_lle->m_is_running.IsSet())
   {
-    const int cycles = static_cast<int>(dsp_lle->m_cycle_count.load());
+    const u32 cycles = dsp_lle->m_cycle_count.load(std::memory_order_acquire);
     if (cycles > 0)
     {
       std::unique_lock dsp_thread_lock(dsp_lle->m_dsp_thread_mutex, std::try_to_lock);
@@ -68,13 +76,16 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
       {
         if (dsp_lle->m_dsp_core.IsJITCreated())
         {
-          dsp_lle->m_dsp_core.RunCycles(cycles);
+          dsp_lle->m_dsp_core.RunCycles(static_cast<int>(cycles));
         }
         else
         {
-          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
+          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(static_cast<int>(cycles));
         }
-        dsp_lle->m_cycle_count.store(0);
+
+        // Cycles the CPU thread added in the meantime are left for the next iteration.
+        dsp_lle->m_cycle_count.fetch_sub(cycles, std::memory_order_acq_rel);
+        dsp_lle->m_ppc_event.Set();
         continue;
       }
     }
@@ -150,6 +161,11 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   m_wii = wii;
   m_is_dsp_on_thread = dsp_thread;
+  m_update_rate = DEFAULT_UPDATE_RATE;
+  m_mailbox_polls = 0;
+  m_handoff_count = 0;
+  m_stall_count = 0;
+  m_stall_time = {};
 
   m_dsp_core.Reset();
 
@@ -174,6 +190,15 @@ void DSPLLE::DSP_StopSoundStream()
   m_ppc_event.Set();
   m_dsp_event.Set();
   m_dsp_thread.join();
+
+  LogThreadStats();
+}
+
+void DSPLLE::LogThreadStats() const
+{
+  INFO_LOG_FMT(DSPLLE,
+               "DSP thread: {} handoffs, the CPU thread waited for it {} times for {:.2f} ms",
+               m_handoff_count, m_stall_count, DT_ms(m_stall_time).count());
 }
 
 void DSPLLE::Shutdown()
@@ -212,6 +237,7 @@ u16 DSPLLE::DSP_ReadControlRegister()
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  ++m_mailbox_polls;
   return m_dsp_core.ReadMailboxHigh(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
@@ -276,16 +302,56 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
-    m_cycle_count.fetch_add(dsp_cycles);
+    // Hand the cycles over to the DSP thread, only waiting for it if it's more than an update
+    // behind, like when the game just polled a mailbox and is waiting for a reply.
+    const u32 pending_cycles =
+        m_cycle_count.fetch_add(dsp_cycles, std::memory_order_acq_rel) + dsp_cycles;
     m_dsp_event.Set();
+    ++m_handoff_count;
+
+    const u32 max_pending_cycles = m_update_rate / 6;
+    if (pending_cycles > max_pending_cycles)
+      WaitForDSPThread(max_pending_cycles);
   }
 }
 
+void DSPLLE::WaitForDSPThread(u32 max_pending_cycles)
+{
+  const TimePoint start = Clock::now();
+
+  while (m_cycle_count.load(std::memory_order_acquire) > max_pending_cycles &&
+         m_is_running.IsSet())
+  {
+    m_ppc_event.Wait();
+  }
+
+  ++m_stall_count;
+  m_stall_time += Clock::now() - start;
+}
+
+// Only called by SystemTimers' DSPCallback, once per slice, since it consumes the mailbox polls
+// counted during the previous slice.
 u32 DSPLLE::DSP_UpdateRate()
 {
-  return 12600;  // TO BE TWEAKED
+  // Single core timing stays as it always was. So does deterministic timing (NetPlay, movies),
+  // even for the updates left before DSP_Update notices it and takes the DSP off its thread, as the
+  // number of mailbox polls depends on how far the DSP thread got.
+  if (!m_is_dsp_on_thread || Core::WantsDeterminism())
+  {
+    m_update_rate = DEFAULT_UPDATE_RATE;
+    m_mailbox_polls = 0;
+    return m_update_rate;
+  }
+
+  // Each handoff to the DSP thread has a cost, so give it larger slices while nothing is waiting
+  // for it, and smaller ones while the game keeps polling for mail.
+  if (m_mailbox_polls > BUSY_MAILBOX_POLLS)
+    m_update_rate = std::max(m_update_rate / 2, MIN_UPDATE_RATE);
+  else if (m_mailbox_polls == 0)
+    m_update_rate = std::min(m_update_rate * 2, MAX_UPDATE_RATE);
+  m_mailbox_polls = 0;
+
+  return m_update_rate;
 }
 
 void DSPLLE::PauseAndLock(bool do_lock)
@@ -301,7 +367,6 @@ void DSPLLE::PauseAndLock(bool do_lock)
     if (m_is_dsp_on_thread)
     {
       // Signal the DSP thread so it can perform any outstanding work now (if any)
-      m_ppc_event.Wait();
       m_dsp_event.Set();
     }
   }
@@ -7,6 +7,7 @@
 #include <mutex>
 #include <thread>
 
+#include "Common/AdaptiveEvent.h"
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Core/DSP/DSPCore.h"
@@ -41,15 +42,33 @@ public:
 private:
   static void DSPThread(DSPLLE* dsp_lle);
 
+  void WaitForDSPThread(u32 max_pending_cycles);
+  void LogThreadStats() const;
+
   DSPCore m_dsp_core;
   std::thread m_dsp_thread;
   std::mutex m_dsp_thread_mutex;
   bool m_is_dsp_on_thread = false;
   Common::Flag m_is_running;
+
+  // Cycles the DSP thread has yet to run. The CPU thread adds to it without waiting for the DSP
+  // thread, unless the DSP thread is too far behind, and the DSP thread subtracts what it ran.
   std::atomic<u32> m_cycle_count{};
 
-  Common::Event m_dsp_event;
-  Common::Event m_ppc_event;
+  // Set when there are cycles to run, and when the DSP thread made progress, respectively.
+  Common::AdaptiveEvent m_dsp_event;
+  Common::AdaptiveEvent m_ppc_event;
   bool m_request_disable_thread = false;
+
+  // With the DSP on a thread, the CPU hands cycles over less often while the game isn't polling
+  // the mailboxes, and more often while it is waiting for mail.
+  u32 m_update_rate = 0;
+  u32 m_mailbox_polls = 0;
+
+  // How often cycles were handed to the DSP thread, and how long the CPU thread had to wait for
+  // it to catch up.
+  u64 m_handoff_count = 0;
+  u64 m_stall_count = 0;
+  DT m_stall_time{};
 };
 }  // namespace DSP::LLE
@@ -3,6 +3,7 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <optional>
@@ -16,6 +17,7 @@
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -26,11 +28,18 @@
 #include "Core/IOS/ES/Formats.h"
 #include "Core/System.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
 
 namespace DVD
 {
+// Read-ahead blocks hold at least this much, so that formats with small chunks aren't read ahead
+// one chunk at a time.
+constexpr u64 MIN_READ_AHEAD_BLOCK_SIZE = 128 * 1024;
+constexpr u64 READ_AHEAD_CACHE_SIZE = 64 * 1024 * 1024;
+
 DVDThread::DVDThread(Core::System& system) : m_system(system)
 {
 }
@@ -56,6 +65,7 @@ void DVDThread::Stop()
   m_result_queue.Clear();
   m_result_map.clear();
 
+  StopReadAhead();
   m_disc.reset();
 }
 
@@ -103,7 +113,72 @@ void DVDThread::DoState(PointerWrap& p)
 void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
+  StopReadAhead();
   m_disc = std::move(disc);
+  StartReadAhead();
+}
+
+void DVDThread::StartReadAhead()
+{
+  if (!m_disc)
+    return;
+
+  // Only formats that decompress whole chunks at a time are slow to seek into.
+  const DiscIO::BlobType blob_type = m_disc->GetBlobType();
+  if (blob_type != DiscIO::BlobType::GCZ && blob_type != DiscIO::BlobType::WIA &&
+      blob_type != DiscIO::BlobType::RVZ)
+  {
+    return;
+  }
+
+  const int worker_count = Config::Get(Config::MAIN_DVD_READ_AHEAD_THREADS);
+  const u64 chunk_size = m_disc->GetBlobReader().GetBlockSize();
+  if (worker_count <= 0 || chunk_size == 0)
+    return;
+
+  // Most Wii reads are from decrypted partition data, which has less data per chunk than the disc.
+  u64 block_size = chunk_size;
+  if (m_disc->GetVolumeType() == DiscIO::Platform::WiiDisc &&
+      chunk_size % DiscIO::VolumeWii::BLOCK_TOTAL_SIZE == 0)
+  {
+    block_size = chunk_size / DiscIO::VolumeWii::BLOCK_TOTAL_SIZE *
+                 DiscIO::VolumeWii::BLOCK_DATA_SIZE;
+  }
+  block_size *= std::max<u64>(MIN_READ_AHEAD_BLOCK_SIZE / chunk_size, 1);
+
+  m_read_ahead.Start(
+      static_cast<u32>(worker_count), block_size, READ_AHEAD_CACHE_SIZE,
+      [this](u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition) {
+        return m_disc->Read(offset, length, out_ptr, partition);
+      },
+      [this]() -> ReadAheadCache::ReadFunction {
+        // Called on the DVD thread, which owns m_disc at that point.
+        std::shared_ptr<const DiscIO::VolumeDisc> volume =
+            DiscIO::CreateDisc(m_disc->GetBlobReader().CopyReader());
+        if (!volume)
+          return {};
+        return [volume](u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition) {
+          return volume->Read(offset, length, out_ptr, partition);
+        };
+      });
+}
+
+void DVDThread::StopReadAhead()
+{
+  if (!m_read_ahead.IsActive())
+    return;
+
+  const ReadAheadCache::Stats stats = m_read_ahead.GetStats();
+  const u64 reads = stats.hits + stats.misses;
+  if (reads != 0)
+  {
+    INFO_LOG_FMT(DVDINTERFACE,
+                 "Read-ahead cache: {} of {} reads hit ({:.1f}%), {} blocks read ahead, {} unused",
+                 stats.hits, reads, 100.0 * stats.hits / reads, stats.blocks_read_ahead,
+                 stats.blocks_wasted);
+  }
+
+  m_read_ahead.Reset();
 }
 
 bool DVDThread::HasDisc() const
@@ -298,7 +373,11 @@ void DVDThread::ProcessReadRequest(ReadRequest&& request)
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
   std::vector<u8> buffer(request.length);
-  if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+  const bool success =
+      m_read_ahead.IsActive() ?
+          m_read_ahead.Read(request.dvd_offset, request.length, buffer.data(), request.partition) :
+          m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition);
+  if (!success)
     buffer.resize(0);
 
   request.realtime_done_us = Common::Timer::NowUs();
@@ -15,6 +15,7 @@
 #include "Common/WorkQueueThread.h"
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/DVD/FileMonitor.h"
+#include "Core/HW/DVD/ReadAheadCache.h"
 
 #include "DiscIO/Volume.h"
 
@@ -84,9 +85,14 @@ public:
                               const DiscIO::Partition& partition, DVD::ReplyType reply_type,
                               s64 ticks_until_completion);
 
+  ReadAheadCache::Stats GetReadAheadStats() const { return m_read_ahead.GetStats(); }
+
 private:
   void WaitUntilIdle();
 
+  void StartReadAhead();
+  void StopReadAhead();
+
   void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offset, u32 length,
                          const DiscIO::Partition& partition, DVD::ReplyType reply_type,
                          s64 ticks_until_completion);
@@ -132,6 +138,7 @@ private:
   std::map<u64, ReadResult> m_result_map;
 
   std::unique_ptr<DiscIO::Volume> m_disc;
+  ReadAheadCache m_read_ahead;
 
   FileMonitor::FileLogger m_file_logger;
 
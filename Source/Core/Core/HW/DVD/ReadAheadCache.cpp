@@ -0,0 +1,226 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DVD/ReadAheadCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace DVD
+{
+namespace
+{
+// How far ahead of a sequential run to read, at most.
+constexpr u64 READ_AHEAD_SIZE = 4 * 1024 * 1024;
+// How many reads in a row have to continue the previous one before reading ahead.
+constexpr u32 SEQUENTIAL_READS_BEFORE_READ_AHEAD = 1;
+}  // namespace
+
+void ReadAheadCache::Start(u32 worker_count, u64 block_size, u64 capacity, ReadFunction read,
+                           std::function<ReadFunction()> create_worker_reader)
+{
+  Reset();
+  if (worker_count == 0 || block_size == 0)
+    return;
+
+  m_block_size = block_size;
+  m_capacity_blocks = std::max<u64>(capacity / block_size, 2);
+  // Reading further ahead than half of the cache would evict blocks before they get used.
+  m_read_ahead_blocks = std::max<u64>(
+      std::min<u64>(std::max<u64>(READ_AHEAD_SIZE / block_size, worker_count),
+                    m_capacity_blocks / 2),
+      1);
+  m_worker_count = worker_count;
+  m_read = std::move(read);
+  m_create_worker_reader = std::move(create_worker_reader);
+}
+
+void ReadAheadCache::Reset()
+{
+  // The workers have to be gone before the blocks they are reading into.
+  for (auto& worker : m_workers)
+  {
+    worker->thread.Cancel();
+    worker->thread.Shutdown();
+  }
+  m_workers.clear();
+  m_workers_failed = false;
+  m_next_worker = 0;
+
+  m_block_size = 0;
+  m_capacity_blocks = 0;
+  m_read_ahead_blocks = 0;
+  m_worker_count = 0;
+  m_read = {};
+  m_create_worker_reader = {};
+
+  m_last_partition = {};
+  m_last_end = 0;
+  m_sequential_reads = 0;
+
+  std::lock_guard lk(m_mutex);
+  m_blocks.clear();
+  m_lru.clear();
+  m_stats = {};
+}
+
+bool ReadAheadCache::Read(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition)
+{
+  if (length == 0)
+    return m_read(offset, length, out_ptr, partition);
+
+  if (partition == m_last_partition && offset >= m_last_end && offset - m_last_end <= m_block_size)
+    ++m_sequential_reads;
+  else
+    m_sequential_reads = 0;
+  m_last_partition = partition;
+  m_last_end = offset + length;
+
+  // Get the workers going first, so that they run while this read is being served.
+  if (m_sequential_reads >= SEQUENTIAL_READS_BEFORE_READ_AHEAD)
+    ReadAhead((offset + length - 1) / m_block_size + 1, partition);
+
+  const bool hit = ReadFromCache(offset, length, out_ptr, partition);
+  {
+    std::lock_guard lk(m_mutex);
+    ++(hit ? m_stats.hits : m_stats.misses);
+  }
+
+  return hit || m_read(offset, length, out_ptr, partition);
+}
+
+bool ReadAheadCache::ReadFromCache(u64 offset, u64 length, u8* out_ptr,
+                                   const DiscIO::Partition& partition)
+{
+  const u64 first_block = offset / m_block_size;
+  const u64 last_block = (offset + length - 1) / m_block_size;
+
+  std::unique_lock lk(m_mutex);
+
+  for (u64 i = first_block; i <= last_block; ++i)
+  {
+    if (!m_blocks.contains({partition.offset, i}))
+      return false;
+  }
+
+  for (u64 i = first_block; i <= last_block; ++i)
+  {
+    // Blocks that are still being read ahead are waited for rather than read a second time.
+    const BlockKey key{partition.offset, i};
+    auto it = m_blocks.find(key);
+    m_block_ready.wait(lk, [&] {
+      it = m_blocks.find(key);
+      return it == m_blocks.end() || it->second->ready;
+    });
+    if (it == m_blocks.end())
+      return false;
+
+    Block& block = *it->second;
+    block.used = true;
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+
+    const u64 block_start = i * m_block_size;
+    const u64 start = std::max(offset, block_start);
+    const u64 end = std::min(offset + length, block_start + m_block_size);
+    std::memcpy(out_ptr + (start - offset), block.data.data() + (start - block_start),
+                end - start);
+  }
+
+  return true;
+}
+
+void ReadAheadCache::ReadAhead(u64 first_block, const DiscIO::Partition& partition)
+{
+  if (m_workers.empty() && !m_workers_failed)
+    m_workers_failed = !StartWorkers();
+  if (m_workers.empty())
+    return;
+
+  std::lock_guard lk(m_mutex);
+
+  for (u64 i = first_block; i < first_block + m_read_ahead_blocks; ++i)
+  {
+    const BlockKey key{partition.offset, i};
+    if (m_blocks.contains(key))
+      continue;
+
+    m_lru.push_front(Block{.key = key});
+    m_blocks.emplace(key, m_lru.begin());
+    ++m_stats.blocks_read_ahead;
+
+    // Consecutive blocks go to different workers, so that they get decompressed in parallel.
+    m_workers[m_next_worker]->thread.Push(key);
+    m_next_worker = (m_next_worker + 1) % m_workers.size();
+  }
+
+  Evict();
+}
+
+bool ReadAheadCache::StartWorkers()
+{
+  for (u32 i = 0; i < m_worker_count; ++i)
+  {
+    ReadFunction read = m_create_worker_reader();
+    if (!read)
+      break;
+
+    Worker& worker = *m_workers.emplace_back(std::make_unique<Worker>());
+    worker.read = std::move(read);
+    worker.thread.Reset(fmt::format("DVD read-ahead {}", i),
+                        [this, &worker](BlockKey key) { WorkerRead(worker, key); });
+  }
+
+  return !m_workers.empty();
+}
+
+void ReadAheadCache::WorkerRead(Worker& worker, BlockKey key)
+{
+  std::vector<u8> data(m_block_size);
+  const bool success = worker.read(key.second * m_block_size, m_block_size, data.data(),
+                                   DiscIO::Partition(key.first));
+
+  std::lock_guard lk(m_mutex);
+  const auto it = m_blocks.find(key);
+  if (it != m_blocks.end())
+  {
+    // Reads past the end of the disc or partition fail, and are left to the reading thread.
+    if (success)
+    {
+      it->second->data = std::move(data);
+      it->second->ready = true;
+    }
+    else
+    {
+      m_lru.erase(it->second);
+      m_blocks.erase(it);
+    }
+  }
+  m_block_ready.notify_all();
+}
+
+void ReadAheadCache::Evict()
+{
+  // Blocks that are still being read can't go anywhere.
+  auto it = m_lru.end();
+  while (m_lru.size() > m_capacity_blocks && it != m_lru.begin())
+  {
+    --it;
+    if (!it->ready)
+      continue;
+
+    if (!it->used)
+      ++m_stats.blocks_wasted;
+    m_blocks.erase(it->key);
+    it = m_lru.erase(it);
+  }
+}
+
+ReadAheadCache::Stats ReadAheadCache::GetStats() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_stats;
+}
+}  // namespace DVD
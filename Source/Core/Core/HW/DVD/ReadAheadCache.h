@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+#include "DiscIO/Volume.h"
+
+namespace DVD
+{
+// Caches disc reads in blocks, and reads the blocks after a sequential run of reads ahead of time
+// on worker threads. Every worker reads through its own copy of the volume, so the chunks of
+// compressed formats get decompressed in parallel instead of when the emulated read needs them.
+class ReadAheadCache final
+{
+public:
+  using ReadFunction =
+      std::function<bool(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition)>;
+
+  struct Stats
+  {
+    // Reads that were served from the cache or had to go to the disc.
+    u64 hits = 0;
+    u64 misses = 0;
+    u64 blocks_read_ahead = 0;
+    // Blocks that were read ahead but evicted before being used.
+    u64 blocks_wasted = 0;
+  };
+
+  ReadAheadCache() = default;
+  ReadAheadCache(const ReadAheadCache&) = delete;
+  ReadAheadCache& operator=(const ReadAheadCache&) = delete;
+  ~ReadAheadCache() { Reset(); }
+
+  // read is used for reads the cache can't serve. create_worker_reader is called once for each of
+  // the worker_count workers when read-ahead is first needed, from the thread calling Read, and may
+  // return an empty function if it fails.
+  void Start(u32 worker_count, u64 block_size, u64 capacity, ReadFunction read,
+             std::function<ReadFunction()> create_worker_reader);
+  // Stops the workers and drops everything cached, along with the stats.
+  void Reset();
+  bool IsActive() const { return m_block_size != 0; }
+
+  // Must only be called from one thread at a time.
+  bool Read(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition);
+
+  Stats GetStats() const;
+
+private:
+  // The partition offset and the block index within it.
+  using BlockKey = std::pair<u64, u64>;
+
+  struct Block
+  {
+    BlockKey key;
+    std::vector<u8> data;
+    bool ready = false;
+    bool used = false;
+  };
+
+  struct Worker
+  {
+    ReadFunction read;
+    Common::WorkQueueThreadSP<BlockKey> thread;
+  };
+
+  bool ReadFromCache(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition);
+  void ReadAhead(u64 first_block, const DiscIO::Partition& partition);
+  bool StartWorkers();
+  void WorkerRead(Worker& worker, BlockKey key);
+  void Evict();
+
+  u64 m_block_size = 0;
+  u64 m_capacity_blocks = 0;
+  u64 m_read_ahead_blocks = 0;
+  u32 m_worker_count = 0;
+  ReadFunction m_read;
+  std::function<ReadFunction()> m_create_worker_reader;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  bool m_workers_failed = false;
+  size_t m_next_worker = 0;
+
+  // Where the last read ended, and how many reads in a row each started where the last one ended.
+  DiscIO::Partition m_last_partition;
+  u64 m_last_end = 0;
+  u32 m_sequential_reads = 0;
+
+  // The most recently used block is at the front.
+  mutable std::mutex m_mutex;
+  std::condition_variable m_block_ready;
+  std::list<Block> m_lru;
+  std::map<BlockKey, std::list<Block>::iterator> m_blocks;
+  Stats m_stats;
+};
+}  // namespace DVD
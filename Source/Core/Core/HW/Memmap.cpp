@@ -14,6 +14,8 @@
 #include <memory>
 #include <span>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -29,6 +31,7 @@
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/MemoryInterface.h"
+#include "Core/HW/MemorySnapshot.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/VideoInterface.h"
@@ -41,7 +44,8 @@
 
 namespace Memory
 {
-MemoryManager::MemoryManager(Core::System& system) : m_system(system)
+MemoryManager::MemoryManager(Core::System& system)
+    : m_snapshot(std::make_unique<MemorySnapshot>()), m_system(system)
 {
 }
 
@@ -235,6 +239,9 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new mappings wouldn't be write protected.
+  m_snapshot->Finish();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -294,7 +301,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, position});
           }
 
           m_logical_page_mappings[i] =
@@ -343,19 +350,48 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
+  p.DoPageAlignment();
+  DoRegionState(p, m_physical_regions[0]);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
-    p.DoArray(m_fake_vmem, current_fake_vmem_size);
+  {
+    p.DoPageAlignment();
+    DoRegionState(p, m_physical_regions[2]);
+  }
   p.DoMarker("Memory FakeVMEM");
   if (current_have_exram)
-    p.DoArray(m_exram, current_exram_size);
+  {
+    p.DoPageAlignment();
+    DoRegionState(p, m_physical_regions[3]);
+  }
   p.DoMarker("Memory EXRAM");
 }
 
+void MemoryManager::DoRegionState(PointerWrap& p, const PhysicalMemoryRegion& region)
+{
+  // A snapshot has to catch writes through the fastmem mappings of the region too.
+  std::vector<MemorySnapshot::View> aliases;
+  if (m_is_fastmem_arena_initialized)
+  {
+    aliases.push_back({m_physical_base + region.physical_address, 0, region.size});
+    for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+    {
+      if (entry.shm_position >= region.shm_position &&
+          entry.shm_position - region.shm_position < region.size)
+      {
+        aliases.push_back({static_cast<u8*>(entry.mapped_pointer),
+                           entry.shm_position - region.shm_position, entry.mapped_size});
+      }
+    }
+  }
+
+  m_snapshot->DoArray(p, *region.out_pointer, region.size, std::move(aliases));
+}
+
 void MemoryManager::Shutdown()
 {
+  m_snapshot->Finish();
   ShutdownFastmemArena();
 
   m_is_initialized = false;
@@ -377,6 +413,8 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  m_snapshot->Finish();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -432,6 +470,10 @@ u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
     return nullptr;
   }
 
+  // The returned pointer may be handed to the kernel, which can't write to memory that a snapshot
+  // has write protected.
+  m_snapshot->ReleaseRange(span.data(), size);
+
   return span.data();
 }
 
@@ -54,8 +54,11 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 shm_position;
 };
 
+class MemorySnapshot;
+
 class MemoryManager
 {
 public:
@@ -90,6 +93,7 @@ public:
   u8*& GetFakeVMEM() { return m_fake_vmem; }
 
   MMIO::Mapping* GetMMIOMapping() const { return m_mmio_mapping.get(); }
+  MemorySnapshot& GetSnapshot() const { return *m_snapshot; }
 
   // Init and Shutdown
   bool IsInitialized() const { return m_is_initialized; }
@@ -204,6 +208,9 @@ private:
   // MMIO mapping object.
   std::unique_ptr<MMIO::Mapping> m_mmio_mapping;
 
+  // Copy-on-write snapshot used for capturing savestates.
+  std::unique_ptr<MemorySnapshot> m_snapshot;
+
   // The MemArena class
   Common::MemArena m_arena;
 
@@ -255,5 +262,6 @@ private:
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  void DoRegionState(PointerWrap& p, const PhysicalMemoryRegion& region);
 };
 }  // namespace Memory
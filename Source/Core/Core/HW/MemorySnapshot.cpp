@@ -0,0 +1,252 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/MemorySnapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Common/ChunkFile.h"
+#include "Common/Logging/Log.h"
+#include "Core/MemTools.h"
+
+namespace Memory
+{
+// Granularity of the write protection. Protecting individual 4 KiB pages would make the kernel
+// split the mappings into so many pieces that it could run into its limit on the mapping count.
+constexpr size_t BLOCK_SIZE = 0x10000;
+
+#ifdef __linux__
+static bool SetWritable(u8* address, size_t size, bool writable)
+{
+  return mprotect(address, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ) == 0;
+}
+#else
+static bool SetWritable(u8*, size_t, bool)
+{
+  return false;
+}
+#endif
+
+MemorySnapshot::MemorySnapshot() = default;
+
+MemorySnapshot::~MemorySnapshot()
+{
+  Finish();
+}
+
+bool MemorySnapshot::IsSupported()
+{
+#ifdef __linux__
+  const long page_size = sysconf(_SC_PAGESIZE);
+  return page_size > 0 && BLOCK_SIZE % static_cast<size_t>(page_size) == 0 &&
+         EMM::IsExceptionHandlerSupported();
+#else
+  return false;
+#endif
+}
+
+u64 MemorySnapshot::BeginCapture()
+{
+  std::lock_guard lk(m_mutex);
+  FinishLocked();
+  ++m_id;
+
+  m_state.store(State::Idle, std::memory_order_release);
+  for (Region& region : m_regions)
+    region = {};
+  m_region_count.store(0, std::memory_order_release);
+  m_blocks_copied_on_write.store(0, std::memory_order_relaxed);
+  m_block_count = 0;
+
+  m_state.store(State::Active, std::memory_order_release);
+  m_capturing = true;
+  return m_id;
+}
+
+void MemorySnapshot::EndCapture()
+{
+  m_capturing = false;
+}
+
+void MemorySnapshot::DoArray(PointerWrap& p, u8* data, u32 size, std::vector<View> aliases)
+{
+  if (!m_capturing || !p.IsWriteMode())
+  {
+    p.DoArray(data, size);
+    return;
+  }
+
+  u8* const dest = p.ReserveBytes(size);
+  if (!dest)
+    return;
+
+  std::vector<View> views;
+  views.reserve(aliases.size() + 1);
+  views.push_back({data, 0, size});
+  views.insert(views.end(), aliases.begin(), aliases.end());
+  if (!AddRegion(dest, std::move(views), size))
+    std::memcpy(dest, data, size);
+}
+
+bool MemorySnapshot::AddRegion(u8* dest, std::vector<View> views, size_t size)
+{
+  const size_t index = m_region_count.load(std::memory_order_relaxed);
+  if (index == MAX_REGIONS || !IsActive())
+    return false;
+
+  const size_t block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  Region& region = m_regions[index];
+  region.dest = dest;
+  region.size = size;
+  region.views = std::move(views);
+  region.blocks = std::make_unique<std::atomic<BlockState>[]>(block_count);
+  for (size_t i = 0; i < block_count; ++i)
+    region.blocks[i].store(BlockState::Protected, std::memory_order_relaxed);
+  m_block_count += block_count;
+
+  // Publish the region before protecting it, so that the exception handler knows about it by the
+  // time the first write faults.
+  m_region_count.store(index + 1, std::memory_order_release);
+
+  for (const View& view : region.views)
+  {
+    if (!SetWritable(view.base, view.size, false))
+    {
+      ERROR_LOG_FMT(MEMMAP, "Failed to write protect memory for snapshot, copying it instead");
+      // Copying also removes the protection from the views which were already protected.
+      for (size_t i = 0; i < block_count; ++i)
+        CopyBlock(region, i);
+      break;
+    }
+  }
+
+  return true;
+}
+
+MemorySnapshot::Region* MemorySnapshot::FindBlock(uintptr_t address, size_t* block)
+{
+  const size_t region_count = m_region_count.load(std::memory_order_acquire);
+  for (size_t i = 0; i < region_count; ++i)
+  {
+    Region& region = m_regions[i];
+    for (const View& view : region.views)
+    {
+      const uintptr_t base = reinterpret_cast<uintptr_t>(view.base);
+      if (address >= base && address - base < view.size)
+      {
+        *block = (address - base + view.region_offset) / BLOCK_SIZE;
+        return &region;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+// Only uses memcpy, mprotect and atomics, as this runs in the exception handler.
+bool MemorySnapshot::CopyBlock(Region& region, size_t block)
+{
+  std::atomic<BlockState>& state = region.blocks[block];
+  BlockState expected = BlockState::Protected;
+  if (!state.compare_exchange_strong(expected, BlockState::Copying, std::memory_order_acquire))
+  {
+    // Another thread is copying the block. The write has to wait until the old data is saved.
+    while (state.load(std::memory_order_acquire) != BlockState::Copied)
+    {
+    }
+    return false;
+  }
+
+  const size_t offset = block * BLOCK_SIZE;
+  const size_t end = std::min(offset + BLOCK_SIZE, region.size);
+  std::memcpy(region.dest + offset, region.views[0].base + offset, end - offset);
+
+  for (const View& view : region.views)
+  {
+    const size_t view_start = std::max(offset, view.region_offset);
+    const size_t view_end = std::min(end, view.region_offset + view.size);
+    if (view_start < view_end)
+      SetWritable(view.base + (view_start - view.region_offset), view_end - view_start, true);
+  }
+
+  state.store(BlockState::Copied, std::memory_order_release);
+  return true;
+}
+
+void MemorySnapshot::Finish(u64 id)
+{
+  std::lock_guard lk(m_mutex);
+  if (id == m_id)
+    FinishLocked();
+}
+
+void MemorySnapshot::Finish()
+{
+  std::lock_guard lk(m_mutex);
+  FinishLocked();
+}
+
+void MemorySnapshot::FinishLocked()
+{
+  if (m_state.load(std::memory_order_acquire) != State::Active)
+    return;
+
+  const size_t region_count = m_region_count.load(std::memory_order_acquire);
+  for (size_t i = 0; i < region_count; ++i)
+  {
+    Region& region = m_regions[i];
+    const size_t block_count = (region.size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    for (size_t block = 0; block < block_count; ++block)
+      CopyBlock(region, block);
+  }
+
+  // The regions are kept until the next capture starts, so that faults which were raised just
+  // before the protection was removed are still recognized.
+  m_state.store(State::Finished, std::memory_order_release);
+
+  INFO_LOG_FMT(MEMMAP, "Memory snapshot: {} of {} blocks were copied on write",
+               m_blocks_copied_on_write.load(std::memory_order_relaxed), m_block_count);
+}
+
+void MemorySnapshot::ReleaseRange(const u8* address, size_t size)
+{
+  if (!IsActive() || size == 0)
+    return;
+
+  const uintptr_t start = reinterpret_cast<uintptr_t>(address);
+  size_t first_block;
+  size_t last_block;
+  Region* region = FindBlock(start, &first_block);
+  if (!region || FindBlock(start + size - 1, &last_block) != region)
+    return;
+
+  for (size_t block = first_block; block <= last_block; ++block)
+    CopyBlock(*region, block);
+}
+
+bool MemorySnapshot::HandleFault(uintptr_t address)
+{
+  const State state = m_state.load(std::memory_order_acquire);
+  if (state == State::Idle)
+    return false;
+
+  size_t block;
+  Region* region = FindBlock(address, &block);
+  if (!region)
+    return false;
+
+  if (state == State::Active && CopyBlock(*region, block))
+    m_blocks_copied_on_write.fetch_add(1, std::memory_order_relaxed);
+
+  // The block is writable now, either because it was just copied or because another thread copied
+  // it in the meantime.
+  return true;
+}
+}  // namespace Memory
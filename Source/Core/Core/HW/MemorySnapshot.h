@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Copy-on-write snapshots of emulated memory, which let savestates be captured without pausing
+// emulation until all of MEM1, MEM2 and ARAM have been copied.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class PointerWrap;
+
+namespace Memory
+{
+// While a snapshot is active, every host mapping of the captured memory is write protected. The
+// first write to a block copies it into the savestate buffer and makes it writable again, and
+// whatever hasn't been written to is copied by Finish() on the thread which writes out the state.
+//
+// A private remap or fork of the shared memory backing emulated memory wouldn't work here: pages
+// of a MAP_PRIVATE mapping which haven't been written to through it still see writes made through
+// the MAP_SHARED views that the emulator uses, and a forked child shares those views as well.
+class MemorySnapshot
+{
+public:
+  // A host mapping of (part of) a captured region. Emulated memory is mapped several times, e.g.
+  // into the fastmem arenas, and writes through any of the mappings must be caught.
+  struct View
+  {
+    u8* base;
+    size_t region_offset;
+    size_t size;
+  };
+
+  MemorySnapshot();
+  ~MemorySnapshot();
+
+  MemorySnapshot(const MemorySnapshot&) = delete;
+  MemorySnapshot& operator=(const MemorySnapshot&) = delete;
+
+  // Snapshots rely on the exception handler to catch writes, which is only used for this on Linux.
+  static bool IsSupported();
+
+  // Starts capturing a snapshot, finishing the previous one first. Must be called on the CPU
+  // thread, followed by DoState in write mode and then EndCapture(). Returns an ID for Finish().
+  u64 BeginCapture();
+  void EndCapture();
+
+  // Serializes a large memory array. While capturing, only space for the data is reserved in the
+  // state and the data is copied into it lazily. The first view must map the whole region.
+  void DoArray(PointerWrap& p, u8* data, u32 size, std::vector<View> aliases = {});
+
+  // Copies everything which hasn't been copied yet and removes the write protection. May be called
+  // from any thread, and must be called before the state buffer is used or freed. Does nothing if
+  // the given snapshot was already finished.
+  void Finish(u64 id);
+  // Finishes the current snapshot, if any.
+  void Finish();
+
+  bool IsActive() const { return m_state.load(std::memory_order_acquire) == State::Active; }
+
+  // Copies the blocks overlapping the given range and makes them writable. Needed before the
+  // kernel writes to emulated memory, e.g. when reading a file into it, as that fails with EFAULT
+  // rather than raising a fault that could be handled.
+  void ReleaseRange(const u8* address, size_t size);
+
+  // Called by the exception handler on any thread. Returns whether the fault was caused by the
+  // write protection of the snapshot, in which case the faulting access can be retried.
+  bool HandleFault(uintptr_t address);
+
+private:
+  enum class State : u8
+  {
+    Idle,
+    Active,
+    Finished,
+  };
+
+  enum class BlockState : u8
+  {
+    Protected,
+    Copying,
+    Copied,
+  };
+
+  struct Region
+  {
+    u8* dest = nullptr;
+    size_t size = 0;
+    std::vector<View> views;
+    std::unique_ptr<std::atomic<BlockState>[]> blocks;
+  };
+
+  // MEM1, FakeVMEM, MEM2 and ARAM.
+  static constexpr size_t MAX_REGIONS = 4;
+
+  bool AddRegion(u8* dest, std::vector<View> views, size_t size);
+  Region* FindBlock(uintptr_t address, size_t* block);
+  bool CopyBlock(Region& region, size_t block);
+  void FinishLocked();
+
+  std::mutex m_mutex;
+  u64 m_id = 0;
+  std::atomic<State> m_state{State::Idle};
+  bool m_capturing = false;
+
+  // Regions below m_region_count are never modified while the snapshot isn't idle, which lets the
+  // exception handler access them without locking.
+  std::array<Region, MAX_REGIONS> m_regions;
+  std::atomic<size_t> m_region_count{0};
+
+  std::atomic<size_t> m_blocks_copied_on_write{0};
+  size_t m_block_count = 0;
+};
+}  // namespace Memory
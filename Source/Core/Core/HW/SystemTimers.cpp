@@ -73,9 +73,11 @@ void SystemTimersManager::DSPCallback(Core::System& system, u64 userdata, s64 cy
 {
   // splits up the cycle budget in case lle is used
   // for hle, just gives all of the slice to hle
+  // The rate can change from one update to the next, so it has to be queried only once.
   auto& dsp = system.GetDSP();
-  dsp.UpdateDSPSlice(static_cast<int>(dsp.GetDSPEmulator()->DSP_UpdateRate() - cycles_late));
-  system.GetCoreTiming().ScheduleEvent(dsp.GetDSPEmulator()->DSP_UpdateRate() - cycles_late,
+  const s64 update_rate = dsp.GetDSPEmulator()->DSP_UpdateRate();
+  dsp.UpdateDSPSlice(static_cast<int>(update_rate - cycles_late));
+  system.GetCoreTiming().ScheduleEvent(update_rate - cycles_late,
                                        system.GetSystemTimers().m_event_type_dsp);
 }
 
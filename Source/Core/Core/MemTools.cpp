@@ -14,6 +14,8 @@
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 
+#include "Core/HW/Memmap.h"
+#include "Core/HW/MemorySnapshot.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
@@ -276,6 +278,10 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
   }
   uintptr_t bad_address = (uintptr_t)info->si_addr;
 
+  // Writes to memory captured by a copy-on-write snapshot are retried once the old data is saved.
+  if (Core::System::GetInstance().GetMemory().GetSnapshot().HandleFault(bad_address))
+    return;
+
 // Get all the information we can out of the context.
 #ifdef __OpenBSD__
   ucontext_t* ctx = context;
@@ -185,6 +185,14 @@ void MovieManager::FrameUpdate()
   }
 
   m_polled = false;
+
+  // Presentation is suppressed from the first frame of playback until the movie ends.
+  const bool verify_playback = IsPlayingInput() && Config::Get(Config::MAIN_MOVIE_VERIFY_PLAYBACK);
+  if (verify_playback != m_verifying_playback)
+  {
+    m_verifying_playback = verify_playback;
+    Core::SetIsPresentationSuppressed(verify_playback);
+  }
 }
 
 // called when game is booting up, even if no movie is active,
@@ -198,6 +206,7 @@ void MovieManager::Init(const BootParameters& boot)
     m_current_file_name.clear();
 
   m_polled = false;
+  m_verifying_playback = false;
   m_save_config = false;
   if (IsPlayingInput())
   {
@@ -548,7 +557,7 @@ bool MovieManager::BeginRecordingInput(const ControllerTypeArray& controllers,
 
     m_play_mode = PlayMode::Recording;
     m_author = Config::Get(Config::MAIN_MOVIE_MOVIE_AUTHOR);
-    m_temp_input.clear();
+    m_input_log.Clear();
 
     m_current_byte = 0;
 
@@ -826,8 +835,8 @@ void MovieManager::RecordInput(const GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
-  m_temp_input.resize(m_current_byte + sizeof(ControllerState));
-  memcpy(&m_temp_input[m_current_byte], &m_pad_state, sizeof(ControllerState));
+  m_input_log.Write(m_current_byte, reinterpret_cast<const u8*>(&m_pad_state),
+                    sizeof(ControllerState));
   m_current_byte += sizeof(ControllerState);
 }
 
@@ -855,10 +864,11 @@ void MovieManager::RecordWiimote(int wiimote, const SerializedWiimoteState& seri
   InputUpdate();
 
   const u8 size = serialized_state.length;
-  m_temp_input.resize(m_current_byte + size + 1);
-  m_temp_input[m_current_byte++] = size;
-  std::copy_n(serialized_state.data.data(), size, m_temp_input.data() + m_current_byte);
-  m_current_byte += size;
+  std::array<u8, sizeof(serialized_state.data) + 1> record;
+  record[0] = size;
+  std::copy_n(serialized_state.data.data(), size, record.data() + 1);
+  m_input_log.Write(m_current_byte, record.data(), size + 1);
+  m_current_byte += size + 1;
 }
 
 // NOTE: EmuThread / Host Thread
@@ -922,6 +932,15 @@ bool MovieManager::PlayInput(const std::string& movie_path,
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return false;
 
+  if (!m_input_log.Load(recording_file, static_cast<InputFormat>(m_temp_header.inputFormat)))
+  {
+    PanicAlertFmtT("Invalid recording file");
+    m_input_log.Clear();
+    return false;
+  }
+  m_current_byte = 0;
+  recording_file.Close();
+
   m_total_frames = m_temp_header.frameCount;
   m_total_lag_count = m_temp_header.lagCount;
   m_total_input_count = m_temp_header.inputCount;
@@ -937,11 +956,6 @@ bool MovieManager::PlayInput(const std::string& movie_path,
 
   Core::UpdateWantDeterminism(m_system);
 
-  m_temp_input.resize(recording_file.GetSize() - 256);
-  recording_file.ReadBytes(m_temp_input.data(), m_temp_input.size());
-  m_current_byte = 0;
-  recording_file.Close();
-
   // Load savestate (and skip to frame data)
   if (m_temp_header.bFromSaveState && savestate_path)
   {
@@ -1015,7 +1029,14 @@ void MovieManager::LoadInput(const std::string& movie_path)
   if (m_system.IsWii())
     ChangeWiiPads(true);
 
-  u64 totalSavedBytes = t_record.GetSize() - 256;
+  InputLog saved_input;
+  if (!saved_input.Load(t_record, static_cast<InputFormat>(m_temp_header.inputFormat)))
+  {
+    PanicAlertFmtT("Savestate movie {0} is corrupted, movie recording stopping...", movie_path);
+    EndPlayInput(false);
+    return;
+  }
+  const u64 totalSavedBytes = saved_input.GetSize();
 
   bool afterEnd = false;
   // This can only happen if the user manually deletes data from the dtm.
@@ -1028,49 +1049,44 @@ void MovieManager::LoadInput(const std::string& movie_path)
     afterEnd = true;
   }
 
-  if (!m_read_only || m_temp_input.empty())
+  if (!m_read_only || m_input_log.IsEmpty())
   {
     m_total_frames = m_temp_header.frameCount;
     m_total_lag_count = m_temp_header.lagCount;
     m_total_input_count = m_temp_header.inputCount;
     m_total_tick_count = m_tick_count_at_last_input = m_temp_header.tickCount;
 
-    m_temp_input.resize(static_cast<size_t>(totalSavedBytes));
-    t_record.ReadBytes(m_temp_input.data(), m_temp_input.size());
+    m_input_log = std::move(saved_input);
   }
   else if (m_current_byte > 0)
   {
     if (m_current_byte > totalSavedBytes)
     {
     }
-    else if (m_current_byte > m_temp_input.size())
+    else if (m_current_byte > m_input_log.GetSize())
     {
       afterEnd = true;
       PanicAlertFmtT(
           "Warning: You loaded a save that's after the end of the current movie. (byte {0} "
           "> {1}) (input {2} > {3}). You should load another save before continuing, or load "
           "this state with read-only mode off.",
-          m_current_byte + 256, m_temp_input.size() + 256, m_current_input_count,
+          m_current_byte + 256, m_input_log.GetSize() + 256, m_current_input_count,
           m_total_input_count);
     }
-    else if (m_current_byte > 0 && !m_temp_input.empty())
+    else if (m_current_byte > 0 && !m_input_log.IsEmpty())
     {
       // verify identical from movie start to the save's current frame
-      std::vector<u8> movInput(m_current_byte);
-      t_record.ReadArray(movInput.data(), movInput.size());
-
-      const auto mismatch_result = std::ranges::mismatch(movInput, m_temp_input);
+      const std::optional<u64> mismatch_index =
+          m_input_log.FindMismatch(saved_input, m_current_byte);
 
-      if (mismatch_result.in1 != movInput.end())
+      if (mismatch_index)
       {
-        const ptrdiff_t mismatch_index = std::distance(movInput.begin(), mismatch_result.in1);
-
         // this is a "you did something wrong" alert for the user's benefit.
         // we'll try to say what's going on in excruciating detail, otherwise the user might not
         // believe us.
         if (IsUsingWiimote(0))
         {
-          const size_t byte_offset = static_cast<size_t>(mismatch_index) + sizeof(DTMHeader);
+          const u64 byte_offset = *mismatch_index + sizeof(DTMHeader);
 
           // TODO: more detail
           PanicAlertFmtT("Warning: You loaded a save whose movie mismatches on byte {0} ({1:#x}). "
@@ -1078,16 +1094,17 @@ void MovieManager::LoadInput(const std::string& movie_path)
                          "read-only mode off. Otherwise you'll probably get a desync.",
                          byte_offset, byte_offset);
 
-          std::ranges::copy(movInput, m_temp_input.begin());
+          m_input_log.CopyPrefix(saved_input, m_current_byte);
         }
         else
         {
-          const ptrdiff_t frame = mismatch_index / sizeof(ControllerState);
-          ControllerState curPadState;
-          memcpy(&curPadState, &m_temp_input[frame * sizeof(ControllerState)],
-                 sizeof(ControllerState));
-          ControllerState movPadState;
-          memcpy(&movPadState, &movInput[frame * sizeof(ControllerState)], sizeof(ControllerState));
+          const u64 frame = *mismatch_index / sizeof(ControllerState);
+          ControllerState curPadState{};
+          m_input_log.Read(frame * sizeof(ControllerState), reinterpret_cast<u8*>(&curPadState),
+                           sizeof(ControllerState));
+          ControllerState movPadState{};
+          saved_input.Read(frame * sizeof(ControllerState), reinterpret_cast<u8*>(&movPadState),
+                           sizeof(ControllerState));
           PanicAlertFmtT(
               "Warning: You loaded a save whose movie mismatches on frame {0}. You should load "
               "another save before continuing, or load this state with read-only mode off. "
@@ -1152,7 +1169,7 @@ void MovieManager::LoadInput(const std::string& movie_path)
 // NOTE: CPU Thread
 void MovieManager::CheckInputEnd()
 {
-  if (m_current_byte >= m_temp_input.size() ||
+  if (m_current_byte >= m_input_log.GetSize() ||
       (m_system.GetCoreTiming().GetTicks() > m_total_tick_count &&
        !IsRecordingInputFromSaveState()))
   {
@@ -1165,18 +1182,24 @@ void MovieManager::PlayController(GCPadStatus* PadStatus, int controllerID)
 {
   // Correct playback is entirely dependent on the emulator polling the controllers
   // in the same order done during recording
-  if (!IsPlayingInput() || !IsUsingPad(controllerID) || m_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingPad(controllerID) || m_input_log.IsEmpty())
     return;
 
-  if (m_current_byte + sizeof(ControllerState) > m_temp_input.size())
+  if (m_current_byte + sizeof(ControllerState) > m_input_log.GetSize())
   {
     PanicAlertFmtT("Premature movie end in PlayController. {0} + {1} > {2}", m_current_byte,
-                   sizeof(ControllerState), m_temp_input.size());
+                   sizeof(ControllerState), m_input_log.GetSize());
     EndPlayInput(!m_read_only);
     return;
   }
 
-  memcpy(&m_pad_state, &m_temp_input[m_current_byte], sizeof(ControllerState));
+  if (!m_input_log.Read(m_current_byte, reinterpret_cast<u8*>(&m_pad_state),
+                        sizeof(ControllerState)))
+  {
+    PanicAlertFmtT("Failed to read movie input in PlayController. byte:{0}", m_current_byte);
+    EndPlayInput(!m_read_only);
+    return;
+  }
   m_current_byte += sizeof(ControllerState);
 
   PadStatus->isConnected = m_pad_state.is_connected;
@@ -1255,19 +1278,24 @@ void MovieManager::PlayController(GCPadStatus* PadStatus, int controllerID)
 // NOTE: CPU Thread
 bool MovieManager::PlayWiimote(int wiimote, DesiredWiimoteState* desired_state)
 {
-  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || m_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || m_input_log.IsEmpty())
     return false;
 
-  if (m_current_byte + sizeof(u8) > m_temp_input.size())
+  if (m_current_byte + sizeof(u8) > m_input_log.GetSize())
   {
     PanicAlertFmtT("Premature movie end in PlayWiimote. {0} + 1 > {1}", m_current_byte,
-                   m_temp_input.size());
+                   m_input_log.GetSize());
     EndPlayInput(!m_read_only);
     return false;
   }
 
   SerializedWiimoteState serialized;
-  serialized.length = m_temp_input[m_current_byte];
+  if (!m_input_log.Read(m_current_byte, &serialized.length, sizeof(u8)))
+  {
+    PanicAlertFmtT("Failed to read movie input in PlayWiimote. byte:{0}", m_current_byte);
+    EndPlayInput(!m_read_only);
+    return false;
+  }
 
   if (serialized.length > serialized.data.size())
   {
@@ -1278,15 +1306,21 @@ bool MovieManager::PlayWiimote(int wiimote, DesiredWiimoteState* desired_state)
   }
 
   ++m_current_byte;
-  if (m_current_byte + serialized.length > m_temp_input.size())
+  if (m_current_byte + serialized.length > m_input_log.GetSize())
   {
     PanicAlertFmtT("Premature movie end in PlayWiimote. {0} + {1} > {2}", m_current_byte,
-                   int(serialized.length), m_temp_input.size());
+                   int(serialized.length), m_input_log.GetSize());
+    EndPlayInput(!m_read_only);
+    return false;
+  }
+
+  if (!m_input_log.Read(m_current_byte, serialized.data.data(), serialized.length))
+  {
+    PanicAlertFmtT("Failed to read movie input in PlayWiimote. byte:{0}", m_current_byte);
     EndPlayInput(!m_read_only);
     return false;
   }
 
-  std::copy_n(m_temp_input.data() + m_current_byte, serialized.length, serialized.data.data());
   if (!WiimoteEmu::DeserializeDesiredState(desired_state, serialized))
   {
     PanicAlertFmtT("Aborting playback. Error in DeserializeDesiredState. byte:{0}{1}",
@@ -1387,13 +1421,18 @@ void MovieManager::SaveRecording(const std::string& filename)
   header.DSPcoefHash = m_dsp_coef_hash;
   header.tickCount = m_total_tick_count;
 
+  // Raw input stays the default, as that is what other programs parsing DTM files expect.
+  const InputFormat input_format =
+      Config::Get(Config::MAIN_MOVIE_COMPRESS_INPUT) ? InputFormat::Compressed : InputFormat::Raw;
+  header.inputFormat = static_cast<u8>(input_format);
+
   // TODO
   header.uniqueID = 0;
   // header.audioEmulator;
 
   save_record.WriteArray(&header, 1);
 
-  bool success = save_record.WriteBytes(m_temp_input.data(), m_temp_input.size());
+  bool success = m_input_log.Save(save_record, input_format);
 
   if (success && m_recording_from_save_state)
   {
@@ -1523,6 +1562,6 @@ void MovieManager::GetMD5()
 void MovieManager::Shutdown()
 {
   m_current_input_count = m_total_input_count = m_total_frames = m_tick_count_at_last_input = 0;
-  m_temp_input.clear();
+  m_input_log.Clear();
 }
 }  // namespace Movie
@@ -13,6 +13,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/WiimoteEmu/DesiredWiimoteState.h"
+#include "Core/MovieInputLog.h"
 
 struct BootParameters;
 
@@ -140,7 +141,8 @@ struct DTMHeader
   u32 DSPiromHash;
   u32 DSPcoefHash;
   u64 tickCount;                 // Number of ticks in the recording
-  std::array<u8, 11> reserved2;  // Make heading 256 bytes, just because we can
+  u8 inputFormat;                // See InputFormat, the input is stored as it is if 0
+  std::array<u8, 10> reserved2;  // Make heading 256 bytes, just because we can
 };
 static_assert(sizeof(DTMHeader) == 256, "DTMHeader should be 256 bytes");
 
@@ -239,7 +241,7 @@ private:
   std::array<bool, 4> m_wiimotes{};
   ControllerState m_pad_state{};
   DTMHeader m_temp_header{};
-  std::vector<u8> m_temp_input;
+  InputLog m_input_log;
   u64 m_current_byte = 0;
   u64 m_current_frame = 0;
   u64 m_total_frames = 0;  // VI
@@ -266,6 +268,7 @@ private:
 
   bool m_recording_from_save_state = false;
   bool m_polled = false;
+  bool m_verifying_playback = false;
 
   std::string m_current_file_name;
 
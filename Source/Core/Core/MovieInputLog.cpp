@@ -0,0 +1,343 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/MovieInputLog.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <zstd.h>
+
+#include "Common/Logging/Log.h"
+
+namespace Movie
+{
+constexpr u32 CHUNK_MAGIC = 0x434D5444;  // "DTMC"
+constexpr int COMPRESSION_LEVEL = 3;
+
+#pragma pack(push, 1)
+struct ChunkHeader
+{
+  u32 magic;
+  u32 raw_size;
+  u32 compressed_size;
+  u64 raw_offset;
+};
+static_assert(sizeof(ChunkHeader) == 20, "ChunkHeader should be 20 bytes");
+#pragma pack(pop)
+
+InputLog::InputLog() : m_storage(std::tmpfile())
+{
+  if (!m_storage.IsOpen())
+    WARN_LOG_FMT(CORE, "Failed to create a temporary file for movie input, keeping it in memory");
+}
+
+InputLog::~InputLog() = default;
+
+void InputLog::Clear()
+{
+  if (m_storage.IsOpen())
+    m_storage.Resize(0);
+  m_memory_storage.clear();
+  m_storage_size = 0;
+
+  m_chunks.clear();
+  m_tail.clear();
+  m_tail_offset = 0;
+  m_size = 0;
+  m_read_cache_index.reset();
+}
+
+void InputLog::Write(u64 offset, const u8* data, size_t size)
+{
+  Truncate(offset);
+  Append(data, size);
+}
+
+bool InputLog::Read(u64 offset, u8* data, size_t size)
+{
+  if (offset > m_size || size > m_size - offset)
+    return false;
+
+  while (size > 0)
+  {
+    const u8* source;
+    size_t available;
+    if (offset >= m_tail_offset)
+    {
+      source = m_tail.data() + (offset - m_tail_offset);
+      available = m_tail.size() - (offset - m_tail_offset);
+    }
+    else
+    {
+      const size_t index = FindChunk(offset);
+      if (!DecompressChunk(index))
+        return false;
+
+      const Chunk& chunk = m_chunks[index];
+      source = m_read_cache.data() + (offset - chunk.raw_offset);
+      available = chunk.raw_size - (offset - chunk.raw_offset);
+    }
+
+    const size_t count = std::min(size, available);
+    std::memcpy(data, source, count);
+    data += count;
+    offset += count;
+    size -= count;
+  }
+
+  return true;
+}
+
+bool InputLog::Load(File::IOFile& file, InputFormat format)
+{
+  Clear();
+
+  const u64 file_size = file.GetSize();
+  if (format == InputFormat::Raw)
+  {
+    std::vector<u8> buffer(CHUNK_SIZE);
+    while (file.Tell() < file_size)
+    {
+      const u64 remaining = file_size - file.Tell();
+      const size_t count = static_cast<size_t>(std::min<u64>(CHUNK_SIZE, remaining));
+      if (!file.ReadBytes(buffer.data(), count))
+        return false;
+      Append(buffer.data(), count);
+    }
+    return true;
+  }
+
+  if (format != InputFormat::Compressed)
+    return false;
+
+  // The compressed data is stored as it is, only the chunk headers have to be looked at.
+  while (file.Tell() < file_size)
+  {
+    ChunkHeader header;
+    if (!file.ReadArray(&header, 1) || header.magic != CHUNK_MAGIC ||
+        header.raw_offset != m_size || header.raw_size == 0 || header.raw_size > CHUNK_SIZE ||
+        header.compressed_size > ZSTD_compressBound(CHUNK_SIZE))
+    {
+      ERROR_LOG_FMT(CORE, "Invalid movie input chunk at input byte {}", m_size);
+      return false;
+    }
+
+    m_compressed.resize(header.compressed_size);
+    if (!file.ReadBytes(m_compressed.data(), m_compressed.size()))
+      return false;
+
+    AddChunk(header.raw_size);
+    m_size += header.raw_size;
+    m_tail_offset = m_size;
+  }
+
+  return true;
+}
+
+bool InputLog::Save(File::IOFile& file, InputFormat format)
+{
+  if (format == InputFormat::Raw)
+  {
+    for (size_t i = 0; i < m_chunks.size(); ++i)
+    {
+      if (!DecompressChunk(i) || !file.WriteBytes(m_read_cache.data(), m_read_cache.size()))
+        return false;
+    }
+    return file.WriteBytes(m_tail.data(), m_tail.size());
+  }
+
+  for (const Chunk& chunk : m_chunks)
+  {
+    const ChunkHeader header{CHUNK_MAGIC, chunk.raw_size, chunk.compressed_size, chunk.raw_offset};
+    if (!LoadCompressed(chunk) || !file.WriteArray(&header, 1) ||
+        !file.WriteBytes(m_compressed.data(), m_compressed.size()))
+    {
+      return false;
+    }
+  }
+
+  // The tail is saved as a smaller chunk, but stays in memory so that more can be appended to it.
+  if (m_tail.empty())
+    return true;
+  if (!Compress(m_tail.data(), m_tail.size()))
+    return false;
+  const ChunkHeader header{CHUNK_MAGIC, static_cast<u32>(m_tail.size()),
+                           static_cast<u32>(m_compressed.size()), m_tail_offset};
+  return file.WriteArray(&header, 1) && file.WriteBytes(m_compressed.data(), m_compressed.size());
+}
+
+std::optional<u64> InputLog::FindMismatch(InputLog& other, u64 size)
+{
+  std::vector<u8> buffer(CHUNK_SIZE);
+  std::vector<u8> other_buffer(CHUNK_SIZE);
+  for (u64 offset = 0; offset < size; offset += CHUNK_SIZE)
+  {
+    const size_t count = static_cast<size_t>(std::min<u64>(CHUNK_SIZE, size - offset));
+    if (!Read(offset, buffer.data(), count) || !other.Read(offset, other_buffer.data(), count))
+      return offset;
+
+    const auto end = buffer.begin() + count;
+    const auto mismatch = std::mismatch(buffer.begin(), end, other_buffer.begin());
+    if (mismatch.first != end)
+      return offset + (mismatch.first - buffer.begin());
+  }
+
+  return std::nullopt;
+}
+
+void InputLog::CopyPrefix(InputLog& other, u64 size)
+{
+  InputLog result;
+  std::vector<u8> buffer(CHUNK_SIZE);
+  u64 offset = 0;
+  while (offset < m_size)
+  {
+    InputLog& source = offset < size ? other : *this;
+    const u64 end = offset < size ? size : m_size;
+    const size_t count = static_cast<size_t>(std::min<u64>(CHUNK_SIZE, end - offset));
+    if (!source.Read(offset, buffer.data(), count))
+      return;
+
+    result.Append(buffer.data(), count);
+    offset += count;
+  }
+
+  *this = std::move(result);
+}
+
+void InputLog::Append(const u8* data, size_t size)
+{
+  m_tail.insert(m_tail.end(), data, data + size);
+  m_size += size;
+
+  while (m_tail.size() >= CHUNK_SIZE && FlushChunk())
+  {
+  }
+}
+
+void InputLog::Truncate(u64 size)
+{
+  if (size >= m_size)
+    return;
+
+  if (size < m_tail_offset)
+  {
+    // The chunk containing the new end becomes the tail again, and everything after it is dropped.
+    const size_t index = FindChunk(size);
+    const Chunk chunk = m_chunks[index];
+    m_tail.clear();
+    if (DecompressChunk(index))
+      m_tail.assign(m_read_cache.begin(), m_read_cache.begin() + (size - chunk.raw_offset));
+    else
+      size = chunk.raw_offset;
+
+    m_chunks.resize(index);
+    m_storage_size = chunk.storage_offset;
+    m_tail_offset = chunk.raw_offset;
+    m_read_cache_index.reset();
+  }
+  else
+  {
+    m_tail.resize(size - m_tail_offset);
+  }
+
+  m_size = size;
+}
+
+bool InputLog::FlushChunk()
+{
+  if (!Compress(m_tail.data(), CHUNK_SIZE))
+  {
+    // The data stays in the tail rather than being lost.
+    ERROR_LOG_FMT(CORE, "Failed to compress movie input");
+    return false;
+  }
+
+  AddChunk(CHUNK_SIZE);
+  m_tail_offset += CHUNK_SIZE;
+  m_tail.erase(m_tail.begin(), m_tail.begin() + CHUNK_SIZE);
+  return true;
+}
+
+bool InputLog::Compress(const u8* data, size_t size)
+{
+  m_compressed.resize(ZSTD_compressBound(size));
+  const size_t result =
+      ZSTD_compress(m_compressed.data(), m_compressed.size(), data, size, COMPRESSION_LEVEL);
+  if (ZSTD_isError(result))
+    return false;
+
+  m_compressed.resize(result);
+  return true;
+}
+
+// Stores the contents of m_compressed as the chunk following the last one.
+void InputLog::AddChunk(u32 raw_size)
+{
+  const Chunk chunk{m_tail_offset, raw_size, m_storage_size, static_cast<u32>(m_compressed.size())};
+
+  if (m_storage.IsOpen())
+  {
+    m_storage.Seek(static_cast<s64>(m_storage_size), File::SeekOrigin::Begin);
+    if (!m_storage.WriteBytes(m_compressed.data(), m_compressed.size()))
+      ERROR_LOG_FMT(CORE, "Failed to write movie input to temporary file");
+  }
+  else
+  {
+    m_memory_storage.resize(m_storage_size);
+    m_memory_storage.insert(m_memory_storage.end(), m_compressed.begin(), m_compressed.end());
+  }
+
+  m_storage_size += chunk.compressed_size;
+  m_chunks.push_back(chunk);
+}
+
+size_t InputLog::FindChunk(u64 offset) const
+{
+  const auto it = std::ranges::upper_bound(m_chunks, offset, {}, &Chunk::raw_offset);
+  return static_cast<size_t>(it - m_chunks.begin()) - 1;
+}
+
+bool InputLog::LoadCompressed(const Chunk& chunk)
+{
+  m_compressed.resize(chunk.compressed_size);
+  if (!m_storage.IsOpen())
+  {
+    std::copy_n(m_memory_storage.begin() + chunk.storage_offset, chunk.compressed_size,
+                m_compressed.begin());
+    return true;
+  }
+
+  return m_storage.Seek(static_cast<s64>(chunk.storage_offset), File::SeekOrigin::Begin) &&
+         m_storage.ReadBytes(m_compressed.data(), m_compressed.size());
+}
+
+bool InputLog::DecompressChunk(size_t index)
+{
+  if (m_read_cache_index == index)
+    return true;
+
+  m_read_cache_index.reset();
+  const Chunk& chunk = m_chunks[index];
+  if (!LoadCompressed(chunk))
+  {
+    ERROR_LOG_FMT(CORE, "Failed to read movie input from temporary file");
+    return false;
+  }
+
+  m_read_cache.resize(chunk.raw_size);
+  const size_t result = ZSTD_decompress(m_read_cache.data(), m_read_cache.size(),
+                                        m_compressed.data(), m_compressed.size());
+  if (ZSTD_isError(result) || result != chunk.raw_size)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to decompress movie input at byte {}", chunk.raw_offset);
+    return false;
+  }
+
+  m_read_cache_index = index;
+  return true;
+}
+}  // namespace Movie
@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace Movie
+{
+// How the input data following the DTMHeader is stored.
+enum class InputFormat : u8
+{
+  // The input records as they are, which is what other programs parsing DTM files expect.
+  Raw = 0,
+  // A sequence of chunks, each made of a ChunkHeader followed by the zstd compressed records. The
+  // headers only give the byte offset of each chunk, there is no index by frame, so loading walks
+  // through all of them.
+  Compressed = 1,
+};
+
+// The input records of a movie. Only the chunk being appended to and the chunk last read from are
+// kept in memory, all others are compressed and kept in a temporary file. This keeps the memory
+// usage of long recordings bounded. The movie file itself is only written when the recording is
+// saved, and loading or saving still goes through every record, though the compressed format
+// copies the chunks without compressing them again.
+class InputLog
+{
+public:
+  InputLog();
+  ~InputLog();
+
+  InputLog(const InputLog&) = delete;
+  InputLog& operator=(const InputLog&) = delete;
+  InputLog(InputLog&&) = default;
+  InputLog& operator=(InputLog&&) = default;
+
+  void Clear();
+
+  u64 GetSize() const { return m_size; }
+  bool IsEmpty() const { return m_size == 0; }
+
+  // Discards everything after offset, which must not be past the end, and appends the data.
+  void Write(u64 offset, const u8* data, size_t size);
+  // Returns false if the range isn't within the log or the data couldn't be read back.
+  bool Read(u64 offset, u8* data, size_t size);
+
+  // Replaces the contents with input data of the given format, read from the current position of
+  // the file to its end.
+  bool Load(File::IOFile& file, InputFormat format);
+  // Writes the contents at the current position of the file.
+  bool Save(File::IOFile& file, InputFormat format);
+
+  // Returns the offset of the first byte below size which differs between the logs. Both logs must
+  // be at least size bytes long.
+  std::optional<u64> FindMismatch(InputLog& other, u64 size);
+  // Replaces the first size bytes with those of the other log.
+  void CopyPrefix(InputLog& other, u64 size);
+
+  static constexpr size_t CHUNK_SIZE = 0x10000;
+
+private:
+  struct Chunk
+  {
+    u64 raw_offset;
+    u32 raw_size;
+    u64 storage_offset;
+    u32 compressed_size;
+  };
+
+  void Append(const u8* data, size_t size);
+  void Truncate(u64 size);
+  bool FlushChunk();
+  bool Compress(const u8* data, size_t size);
+  void AddChunk(u32 raw_size);
+  size_t FindChunk(u64 offset) const;
+  bool LoadCompressed(const Chunk& chunk);
+  bool DecompressChunk(size_t index);
+
+  // Holds the compressed chunks. If no temporary file could be created, they're kept in memory.
+  File::IOFile m_storage;
+  std::vector<u8> m_memory_storage;
+  u64 m_storage_size = 0;
+
+  std::vector<Chunk> m_chunks;
+  // The data after the last chunk, which is less than CHUNK_SIZE unless compression failed.
+  std::vector<u8> m_tail;
+  u64 m_tail_offset = 0;
+  u64 m_size = 0;
+
+  std::vector<u8> m_compressed;
+  // Reads are mostly sequential, so the last decompressed chunk is kept around.
+  std::vector<u8> m_read_cache;
+  std::optional<size_t> m_read_cache_index;
+};
+}  // namespace Movie
@@ -5,7 +5,9 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <functional>
@@ -67,6 +69,7 @@
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
+#include "Core/NetPlayRollback.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/SyncIdentifier.h"
 #include "Core/System.h"
@@ -87,6 +90,19 @@ static std::mutex crit_netplay_client;
 static NetPlayClient* netplay_client = nullptr;
 static bool s_si_poll_batching = false;
 
+// Received pad data can be held back for this many milliseconds in rollback sessions, to try out
+// rollback with two instances on the same machine. Only debug builds read it, from the
+// DOLPHIN_NETPLAY_SIMULATED_LATENCY_MS environment variable, so it can't be left on by accident.
+static u32 GetSimulatedLatencyMs()
+{
+#if defined(_DEBUG) || defined(DEBUGFAST)
+  const char* value = std::getenv("DOLPHIN_NETPLAY_SIMULATED_LATENCY_MS");
+  if (value)
+    return static_cast<u32>(std::strtoul(value, nullptr, 10));
+#endif
+  return 0;
+}
+
 // called from ---GUI--- thread
 NetPlayClient::~NetPlayClient()
 {
@@ -693,12 +709,42 @@ void NetPlayClient::OnPadData(sf::Packet& packet)
     }
 
     // Trusting server for good map value (>=0 && <4)
+    const u32 simulated_latency = m_simulated_latency_ms.load(std::memory_order_relaxed);
+    if (simulated_latency != 0)
+    {
+      const auto release_time =
+          std::chrono::steady_clock::now() + std::chrono::milliseconds(simulated_latency);
+      std::lock_guard lk(m_delayed_pad_data_mutex);
+      m_delayed_pad_data.push_back({release_time, map, pad});
+      continue;
+    }
+
     // add to pad buffer
     m_pad_buffer.at(map).Push(pad);
     m_gc_pad_event.Set();
   }
 }
 
+// called from ---NETPLAY--- thread
+bool NetPlayClient::ReleaseDelayedPadData()
+{
+  std::lock_guard lk(m_delayed_pad_data_mutex);
+  const auto now = std::chrono::steady_clock::now();
+  bool released = false;
+  while (!m_delayed_pad_data.empty() && m_delayed_pad_data.front().release_time <= now)
+  {
+    const DelayedPadData& data = m_delayed_pad_data.front();
+    m_pad_buffer.at(data.map).Push(data.pad);
+    m_delayed_pad_data.pop_front();
+    released = true;
+  }
+
+  if (released)
+    m_gc_pad_event.Set();
+
+  return !m_delayed_pad_data.empty();
+}
+
 void NetPlayClient::OnPadHostData(sf::Packet& packet)
 {
   while (!packet.endOfPacket())
@@ -1605,13 +1651,16 @@ void NetPlayClient::ThreadFunc()
     }
   }
 
+  bool has_delayed_pad_data = false;
   while (m_do_loop.IsSet())
   {
     ENetEvent netEvent;
     int net;
     if (m_traversal_client)
       m_traversal_client->HandleResends();
-    net = enet_host_service(m_client, &netEvent, 250);
+    // Held back pad data has to be released on time, so don't sleep for long while there is any.
+    net = enet_host_service(m_client, &netEvent, has_delayed_pad_data ? 1 : 250);
+    has_delayed_pad_data = ReleaseDelayedPadData();
     while (!m_async_queue.Empty())
     {
       INFO_LOG_FMT(NETPLAY, "Processing async queue event.");
@@ -1765,6 +1814,15 @@ bool NetPlayClient::StartGame(const std::string& path)
 
   m_first_pad_status_received.fill(false);
 
+  // Movies are recorded from the inputs as they are polled, which would include mispredictions.
+  m_rollback.reset();
+  if (Config::Get(Config::NETPLAY_ROLLBACK) && !m_dialog->IsRecording())
+  {
+    m_rollback =
+        std::make_unique<RollbackSession>(Config::Get(Config::NETPLAY_ROLLBACK_MAX_FRAMES));
+  }
+  m_simulated_latency_ms.store(m_rollback ? GetSimulatedLatencyMs() : 0, std::memory_order_relaxed);
+
   if (m_dialog->IsRecording())
   {
     auto& movie = Core::System::GetInstance().GetMovie();
@@ -1939,6 +1997,9 @@ void NetPlayClient::ClearBuffers()
     while (m_wiimote_buffer[i].Size())
       m_wiimote_buffer[i].Pop();
   }
+
+  std::lock_guard lk(m_delayed_pad_data_mutex);
+  m_delayed_pad_data.clear();
 }
 
 // called from ---NETPLAY--- thread
@@ -2044,6 +2105,9 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     m_wait_on_input_event.Wait();
   }
 
+  if (IsRollbackActive())
+    return GetRollbackPad(pad_nb, batching, pad_status);
+
   if (IsFirstInGamePad(pad_nb) && batching)
   {
     sf::Packet packet;
@@ -2133,6 +2197,81 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
   return true;
 }
 
+// called from ---CPU--- thread
+bool NetPlayClient::GetRollbackPad(const int pad_nb, const bool batching, GCPadStatus* pad_status)
+{
+  RollbackInputs& inputs = m_rollback->GetInputs();
+
+  // Local pads are only polled for inputs which haven't been sent yet. When frames are emulated
+  // again after a rollback, the inputs which were sent the first time are used.
+  const auto poll_local_pad = [&](int local_pad, sf::Packet& packet) {
+    const int ingame_pad = LocalPadToInGamePad(local_pad);
+    return inputs.GetPollCount(ingame_pad) >= inputs.GetConfirmedCount(ingame_pad) &&
+           PollLocalPad(local_pad, packet);
+  };
+
+  if (IsFirstInGamePad(pad_nb) && batching)
+  {
+    sf::Packet packet;
+    packet << MessageID::PadData;
+
+    bool send_packet = false;
+    const int num_local_pads = NumLocalPads();
+    for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
+      send_packet = poll_local_pad(local_pad, packet) || send_packet;
+
+    if (send_packet)
+      SendAsync(std::move(packet));
+  }
+
+  if (!batching)
+  {
+    const int local_pad = InGamePadToLocalPad(pad_nb);
+    if (local_pad < 4)
+    {
+      sf::Packet packet;
+      packet << MessageID::PadData;
+      if (poll_local_pad(local_pad, packet))
+        SendAsync(std::move(packet));
+    }
+  }
+
+  // Instead of waiting for the other clients, predict their inputs unless that would go further
+  // ahead than can be rolled back.
+  ReceiveRollbackInputs();
+  while (inputs.GetPollCount(pad_nb) >= inputs.GetConfirmedCount(pad_nb) &&
+         !m_rollback->CanPredict(pad_nb))
+  {
+    if (!m_is_running.IsSet())
+      return false;
+
+    m_gc_pad_event.Wait();
+    ReceiveRollbackInputs();
+  }
+
+  *pad_status = inputs.Poll(pad_nb);
+  return true;
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::ReceiveRollbackInputs()
+{
+  RollbackInputs& inputs = m_rollback->GetInputs();
+  for (int pad = 0; pad < static_cast<int>(m_pad_buffer.size()); ++pad)
+  {
+    GCPadStatus status;
+    while (m_pad_buffer[pad].Pop(status))
+      inputs.AddConfirmedInput(pad, status);
+  }
+}
+
+bool NetPlayClient::IsRollbackActive() const
+{
+  // Wii Remote inputs aren't predicted, and host input authority already avoids waiting for the
+  // other clients.
+  return m_rollback && !m_host_input_authority && !Core::System::GetInstance().IsWii();
+}
+
 u64 NetPlayClient::GetInitialRTCValue() const
 {
   return m_initial_rtc;
@@ -2212,6 +2351,13 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
       m_first_pad_status_received[ingame_pad] = true;
     }
   }
+  else if (IsRollbackActive())
+  {
+    // Inputs are matched up with polls by their index, so every poll adds exactly one of them.
+    m_pad_buffer[ingame_pad].Push(pad_status);
+    AddPadStateToPacket(ingame_pad, pad_status, packet);
+    data_added = true;
+  }
   else
   {
     // adjust the buffer either up or down
@@ -2335,6 +2481,17 @@ bool NetPlayClient::StopGame()
 {
   InvokeStop();
 
+  {
+    // Time bases which are still waiting for inputs will never be sent, so the server shouldn't
+    // wait for them.
+    std::lock_guard lk(crit_netplay_client);
+    if (m_rollback)
+    {
+      for (const u32 frame : m_rollback->TakeUnconfirmedTimeBaseFrames())
+        SendTimeBase(frame, std::nullopt);
+    }
+  }
+
   NetPlay_Disable();
 
   // stop game
@@ -2518,19 +2675,54 @@ void NetPlayClient::SendTimeBase()
 {
   std::lock_guard lk(crit_netplay_client);
 
-  if (netplay_client->m_timebase_frame % 60 == 0)
+  const u64 timebase = Core::System::GetInstance().GetSystemTimers().GetFakeTimeBase();
+
+  // The time base of a frame which depends on predicted inputs may still change, so it is only
+  // sent from OnFrameEnd once they are confirmed.
+  if (netplay_client->IsRollbackActive())
   {
-    const u64 timebase = Core::System::GetInstance().GetSystemTimers().GetFakeTimeBase();
+    const u32 frame = netplay_client->m_rollback->CountTimeBaseFrame();
+    if (frame % 60 == 0)
+      netplay_client->m_rollback->RecordTimeBase(frame, timebase);
+    return;
+  }
 
-    sf::Packet packet;
-    packet << MessageID::TimeBase;
-    packet << timebase;
-    packet << netplay_client->m_timebase_frame;
+  if (netplay_client->m_timebase_frame % 60 == 0)
+    netplay_client->SendTimeBase(netplay_client->m_timebase_frame, timebase);
 
-    netplay_client->SendAsync(std::move(packet));
+  netplay_client->m_timebase_frame++;
+}
+
+void NetPlayClient::SendTimeBase(u32 frame, std::optional<u64> timebase)
+{
+  sf::Packet packet;
+  if (timebase)
+  {
+    packet << MessageID::TimeBase;
+    packet << *timebase;
+  }
+  else
+  {
+    packet << MessageID::TimeBaseUnavailable;
   }
+  packet << frame;
 
-  netplay_client->m_timebase_frame++;
+  SendAsync(std::move(packet));
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::OnFrameEnd(Core::System& system)
+{
+  std::lock_guard lk(crit_netplay_client);
+
+  if (!netplay_client || !netplay_client->IsRollbackActive())
+    return;
+
+  netplay_client->ReceiveRollbackInputs();
+  netplay_client->m_rollback->OnFrameEnd(system);
+
+  for (const auto& [frame, timebase] : netplay_client->m_rollback->TakeConfirmedTimeBases())
+    netplay_client->SendTimeBase(frame, timebase);
 }
 
 bool NetPlayClient::DoAllPlayersHaveGame()
@@ -5,10 +5,13 @@
 
 #include <SFML/Network/Packet.hpp>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
@@ -26,6 +29,11 @@
 
 class BootSessionData;
 
+namespace Core
+{
+class System;
+}
+
 namespace IOS::HLE::FS
 {
 class FileSystem;
@@ -43,6 +51,8 @@ struct SerializedWiimoteState;
 
 namespace NetPlay
 {
+class RollbackSession;
+
 class NetPlayUI
 {
 public:
@@ -166,6 +176,8 @@ public:
   const PlayerId& GetLocalPlayerId() const;
 
   static void SendTimeBase();
+  // Called on the CPU thread at the CoreTiming safe point after every emulated frame.
+  static void OnFrameEnd(Core::System& system);
   bool DoAllPlayersHaveGame();
 
   const PadMappingArray& GetPadMapping() const;
@@ -204,6 +216,9 @@ protected:
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
 
+  // Only set while a game is running with rollback enabled.
+  std::unique_ptr<RollbackSession> m_rollback;
+
   std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
 
   NetPlayUI* m_dialog = nullptr;
@@ -258,6 +273,14 @@ private:
 
   bool PollLocalPad(int local_pad, sf::Packet& packet);
   void SendPadHostPoll(PadIndex pad_num);
+  // Sends that the time base of a frame is unavailable if none is given.
+  void SendTimeBase(u32 frame, std::optional<u64> timebase);
+
+  bool IsRollbackActive() const;
+  bool GetRollbackPad(int pad_nb, bool batching, GCPadStatus* pad_status);
+  void ReceiveRollbackInputs();
+  // Returns whether any pad data is still held back.
+  bool ReleaseDelayedPadData();
 
   bool AddLocalWiimoteToBuffer(int local_wiimote, const WiimoteEmu::SerializedWiimoteState& state,
                                sf::Packet& packet);
@@ -344,6 +367,17 @@ private:
   bool m_sync_ar_codes_complete = false;
   std::unordered_map<u32, sf::Packet> m_chunked_data_receive_queue;
 
+  // Pad data held back by the network thread to simulate latency, see GetSimulatedLatencyMs().
+  struct DelayedPadData
+  {
+    std::chrono::steady_clock::time_point release_time;
+    PadIndex map;
+    GCPadStatus pad;
+  };
+  std::deque<DelayedPadData> m_delayed_pad_data;
+  std::mutex m_delayed_pad_data_mutex;
+  std::atomic<u32> m_simulated_latency_ms = 0;
+
   u64 m_initial_rtc = 0;
   u32 m_timebase_frame = 0;
 
@@ -174,6 +174,7 @@ enum class MessageID : u8
 
   TimeBase = 0xB0,
   DesyncDetected = 0xB1,
+  TimeBaseUnavailable = 0xB2,
 
   ComputeGameDigest = 0xC0,
   GameDigestProgress = 0xC1,
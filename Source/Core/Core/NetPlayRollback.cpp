@@ -0,0 +1,338 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayRollback.h"
+
+#include <algorithm>
+#include <iterator>
+#include <span>
+#include <utility>
+
+#include "Common/Logging/Log.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/State.h"
+#include "Core/System.h"
+
+namespace NetPlay
+{
+static bool IsSamePadStatus(const GCPadStatus& a, const GCPadStatus& b)
+{
+  return a.button == b.button && a.stickX == b.stickX && a.stickY == b.stickY &&
+         a.substickX == b.substickX && a.substickY == b.substickY &&
+         a.triggerLeft == b.triggerLeft && a.triggerRight == b.triggerRight &&
+         a.analogA == b.analogA && a.analogB == b.analogB && a.isConnected == b.isConnected;
+}
+
+void RollbackInputs::Reset()
+{
+  m_pads = {};
+}
+
+void RollbackInputs::AddConfirmedInput(int pad, const GCPadStatus& status)
+{
+  PadInputs& inputs = m_pads[pad];
+  const u64 index = inputs.confirmed++;
+  inputs.last_confirmed = status;
+
+  if (index < inputs.first + inputs.inputs.size())
+  {
+    // The input was already polled, so there is a prediction to check.
+    GCPadStatus& entry = inputs.inputs[index - inputs.first];
+    if (!inputs.first_misprediction && !IsSamePadStatus(entry, status))
+      inputs.first_misprediction = index;
+    entry = status;
+  }
+  else
+  {
+    inputs.inputs.push_back(status);
+  }
+}
+
+GCPadStatus RollbackInputs::Poll(int pad)
+{
+  PadInputs& inputs = m_pads[pad];
+  const u64 index = inputs.polled++;
+  if (index < inputs.confirmed)
+    return inputs.inputs[index - inputs.first];
+
+  // Players tend to hold the same buttons for many frames in a row, so repeating the last known
+  // input is the best guess.
+  const GCPadStatus prediction = inputs.last_confirmed;
+  if (index < inputs.first + inputs.inputs.size())
+    inputs.inputs[index - inputs.first] = prediction;
+  else
+    inputs.inputs.push_back(prediction);
+  return prediction;
+}
+
+RollbackInputs::PollCounts RollbackInputs::GetPollCounts() const
+{
+  PollCounts counts;
+  for (size_t i = 0; i < m_pads.size(); ++i)
+    counts[i] = m_pads[i].polled;
+  return counts;
+}
+
+bool RollbackInputs::HasUnconfirmedPolls() const
+{
+  return std::ranges::any_of(
+      m_pads, [](const PadInputs& inputs) { return inputs.polled > inputs.confirmed; });
+}
+
+bool RollbackInputs::HasMisprediction() const
+{
+  return std::ranges::any_of(
+      m_pads, [](const PadInputs& inputs) { return inputs.first_misprediction.has_value(); });
+}
+
+bool RollbackInputs::CanRollBackTo(const PollCounts& counts) const
+{
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    if (m_pads[i].first_misprediction && counts[i] > *m_pads[i].first_misprediction)
+      return false;
+  }
+  return true;
+}
+
+void RollbackInputs::RewindTo(const PollCounts& counts)
+{
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    PadInputs& inputs = m_pads[i];
+    inputs.polled = counts[i];
+    inputs.first_misprediction.reset();
+
+    // Predictions made after the given point are stale, they are made again when polling.
+    inputs.inputs.resize(std::max(inputs.confirmed, inputs.polled) - inputs.first);
+  }
+}
+
+void RollbackInputs::DiscardBefore(const PollCounts& counts)
+{
+  for (size_t i = 0; i < m_pads.size(); ++i)
+  {
+    PadInputs& inputs = m_pads[i];
+    const u64 limit = std::min(counts[i], inputs.confirmed);
+    while (inputs.first < limit)
+    {
+      inputs.inputs.pop_front();
+      ++inputs.first;
+    }
+  }
+}
+
+RollbackSession::RollbackSession(u32 max_frames) : m_max_frames(std::max<u32>(max_frames, 1))
+{
+}
+
+// Resuming presentation changes the speed measurement the CPU thread updates while it emulates.
+static void ResumePresentation(Core::System& system)
+{
+  Core::SetIsPresentationSuppressed(false);
+}
+
+RollbackSession::~RollbackSession()
+{
+  // Sessions are destroyed on the host or NetPlay thread, possibly while the CPU thread is still
+  // emulating frames again. Presentation is then resumed at the next safe point.
+  if (m_resimulate_until)
+  {
+    auto& system = Core::System::GetInstance();
+    Core::RunOnCPUThread(
+        system,
+        [&system] {
+          // Without a running CPU thread, this runs right away and there is nothing to race with.
+          if (Core::IsCPUThread())
+            system.GetCoreTiming().RunAtSafePoint(&ResumePresentation);
+          else
+            ResumePresentation(system);
+        },
+        false);
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Rollback: {} rollbacks, {} frames emulated again", m_rollbacks,
+               m_resimulated_frames);
+}
+
+bool RollbackSession::CanPredict(int pad) const
+{
+  return !m_frames.empty() && m_frames.size() <= m_max_frames &&
+         m_frames.front().poll_counts[pad] <= m_inputs.GetConfirmedCount(pad);
+}
+
+void RollbackSession::OnFrameEnd(Core::System& system)
+{
+  ++m_frame;
+
+  if (m_inputs.HasMisprediction() && RollBack(system))
+    return;
+
+  if (m_resimulate_until)
+  {
+    ++m_resimulated_frames;
+    if (m_frame >= *m_resimulate_until)
+      SetResimulating(std::nullopt);
+  }
+
+  SaveFrame(system);
+}
+
+bool RollbackSession::RollBack(Core::System& system)
+{
+  const auto it = std::find_if(m_frames.rbegin(), m_frames.rend(), [this](const Frame& frame) {
+    return m_inputs.CanRollBackTo(frame.poll_counts);
+  });
+  if (it == m_frames.rend())
+  {
+    // Predictions are limited to what can be rolled back, so this shouldn't happen.
+    ERROR_LOG_FMT(NETPLAY, "Rollback: No state from before the misprediction is available");
+    m_inputs.RewindTo(m_inputs.GetPollCounts());
+    return false;
+  }
+
+  const u64 live_frame = m_resimulate_until.value_or(m_frame);
+
+  LoadState(system, std::span<const u8>(it->state.data(), it->state_size));
+  if (system.GetCoreTiming().GetTicks() != it->ticks)
+  {
+    // The state didn't load, so emulation carries on from where it was.
+    ERROR_LOG_FMT(NETPLAY, "Rollback: Failed to restore the state of frame {}", it->number);
+    m_inputs.RewindTo(m_inputs.GetPollCounts());
+    return false;
+  }
+  m_inputs.RewindTo(it->poll_counts);
+  m_frame = it->number;
+  m_timebase_frame = it->timebase_frame;
+  for (TimeBase& timebase : m_timebases)
+  {
+    if (timebase.frame >= m_timebase_frame)
+      timebase.outdated = true;
+  }
+
+  // The frames after the restored one were emulated with the wrong inputs.
+  const auto first_discarded = it.base();
+  for (auto frame = first_discarded; frame != m_frames.end(); ++frame)
+  {
+    if (m_free_buffers.size() < m_max_frames)
+      m_free_buffers.push_back(std::move(frame->state));
+  }
+  m_frames.erase(first_discarded, m_frames.end());
+
+  ++m_rollbacks;
+  DEBUG_LOG_FMT(NETPLAY, "Rollback: Rolled back from frame {} to frame {}", live_frame, m_frame);
+
+  if (m_frame < live_frame)
+    SetResimulating(live_frame);
+  return true;
+}
+
+void RollbackSession::SaveFrame(Core::System& system)
+{
+  Frame frame;
+  if (!m_free_buffers.empty())
+  {
+    frame.state = std::move(m_free_buffers.back());
+    m_free_buffers.pop_back();
+  }
+
+  frame.state_size = SaveState(system, frame.state);
+  if (frame.state_size == 0)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Rollback: Failed to save state for frame {}", m_frame);
+    return;
+  }
+  frame.poll_counts = m_inputs.GetPollCounts();
+  frame.number = m_frame;
+  frame.ticks = system.GetCoreTiming().GetTicks();
+  frame.timebase_frame = m_timebase_frame;
+  m_frames.push_back(std::move(frame));
+
+  // Keep the oldest frame as long as it is the only one from before an input which hasn't been
+  // confirmed yet. CanPredict() stops predicting if this lets the ring grow too large.
+  const auto can_drop_front = [this] {
+    const RollbackInputs::PollCounts& next = m_frames[1].poll_counts;
+    for (int pad = 0; pad < static_cast<int>(next.size()); ++pad)
+    {
+      if (next[pad] > m_inputs.GetConfirmedCount(pad))
+        return false;
+    }
+    return true;
+  };
+  while (m_frames.size() > m_max_frames && can_drop_front())
+  {
+    if (m_free_buffers.size() < m_max_frames)
+      m_free_buffers.push_back(std::move(m_frames.front().state));
+    m_frames.pop_front();
+  }
+
+  m_inputs.DiscardBefore(m_frames.front().poll_counts);
+}
+
+void RollbackSession::RecordTimeBase(u32 frame, u64 timebase)
+{
+  // The inputs of this frame were confirmed before the rollback, so it came out the same again.
+  if (frame < m_first_unconfirmed_timebase)
+    return;
+
+  const auto it = std::ranges::find(m_timebases, frame, &TimeBase::frame);
+  TimeBase& entry = it != m_timebases.end() ? *it : m_timebases.emplace_back();
+  entry.frame = frame;
+  entry.value = timebase;
+  entry.poll_counts = m_inputs.GetPollCounts();
+  entry.outdated = false;
+}
+
+std::vector<std::pair<u32, u64>> RollbackSession::TakeConfirmedTimeBases()
+{
+  // A misprediction would have been rolled back before this is called, so a time base whose
+  // inputs are all confirmed was emulated with the right ones.
+  const auto is_confirmed = [this](const TimeBase& timebase) {
+    if (timebase.outdated)
+      return false;
+    for (int pad = 0; pad < static_cast<int>(timebase.poll_counts.size()); ++pad)
+    {
+      if (timebase.poll_counts[pad] > m_inputs.GetConfirmedCount(pad))
+        return false;
+    }
+    return true;
+  };
+
+  std::vector<std::pair<u32, u64>> confirmed;
+  while (!m_timebases.empty() && is_confirmed(m_timebases.front()))
+  {
+    confirmed.emplace_back(m_timebases.front().frame, m_timebases.front().value);
+    m_first_unconfirmed_timebase = m_timebases.front().frame + 1;
+    m_timebases.pop_front();
+  }
+  return confirmed;
+}
+
+std::vector<u32> RollbackSession::TakeUnconfirmedTimeBaseFrames()
+{
+  std::vector<u32> frames;
+  for (const TimeBase& timebase : m_timebases)
+    frames.push_back(timebase.frame);
+  if (!frames.empty())
+    m_first_unconfirmed_timebase = frames.back() + 1;
+  m_timebases.clear();
+  return frames;
+}
+
+size_t RollbackSession::SaveState(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+{
+  return State::SaveToReusedBuffer(system, buffer);
+}
+
+void RollbackSession::LoadState(Core::System& system, std::span<const u8> state)
+{
+  State::LoadFromReusedBuffer(system, state);
+}
+
+void RollbackSession::SetResimulating(std::optional<u64> until)
+{
+  m_resimulate_until = until;
+  Core::SetIsPresentationSuppressed(until.has_value());
+}
+}  // namespace NetPlay
@@ -0,0 +1,160 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Rollback netcode for GameCube controllers. Instead of delaying every input by the pad buffer,
+// inputs of remote players which haven't arrived yet are predicted. Once the real inputs arrive
+// and differ from the prediction, the state from before the misprediction is restored and the
+// frames since then are emulated again, as quickly as possible and without presenting them.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace Core
+{
+class System;
+}
+
+namespace NetPlay
+{
+// The inputs of each pad form a sequence with one entry per poll, which is the same for all
+// players. This tracks which of them are confirmed and which were predicted.
+class RollbackInputs
+{
+public:
+  using PollCounts = std::array<u64, 4>;
+
+  void Reset();
+
+  // Appends the next input of the pad as sent by its player. Detects a misprediction if the input
+  // was already polled with a different predicted value.
+  void AddConfirmedInput(int pad, const GCPadStatus& status);
+
+  // Returns the input for the next poll of the pad, predicting it from the last confirmed input if
+  // it hasn't arrived yet.
+  GCPadStatus Poll(int pad);
+
+  u64 GetPollCount(int pad) const { return m_pads[pad].polled; }
+  u64 GetConfirmedCount(int pad) const { return m_pads[pad].confirmed; }
+  PollCounts GetPollCounts() const;
+
+  bool HasUnconfirmedPolls() const;
+  bool HasMisprediction() const;
+
+  // Whether emulation which polled the pads counts times can be continued with correct inputs.
+  bool CanRollBackTo(const PollCounts& counts) const;
+
+  // Forgets the polls made since the given counts were reached, as emulation continues from there.
+  void RewindTo(const PollCounts& counts);
+
+  // Drops inputs which are older than the given counts and can no longer be needed.
+  void DiscardBefore(const PollCounts& counts);
+
+private:
+  struct PadInputs
+  {
+    // Inputs starting at poll index `first`. Entries below `confirmed` are confirmed, the others
+    // up to `polled` are predictions.
+    std::deque<GCPadStatus> inputs;
+    u64 first = 0;
+    u64 confirmed = 0;
+    u64 polled = 0;
+    GCPadStatus last_confirmed;
+    std::optional<u64> first_misprediction;
+  };
+
+  std::array<PadInputs, 4> m_pads;
+};
+
+// Saves a state at the end of every frame, and rolls back when a misprediction is detected.
+// Everything here runs on the CPU thread.
+class RollbackSession
+{
+public:
+  explicit RollbackSession(u32 max_frames);
+  virtual ~RollbackSession();
+
+  RollbackInputs& GetInputs() { return m_inputs; }
+
+  // Whether the next input of the pad may be predicted. Predictions are only allowed as far back
+  // as there are states to roll back to.
+  bool CanPredict(int pad) const;
+
+  bool IsResimulating() const { return m_resimulate_until.has_value(); }
+
+  // Counts the frames whose time bases are compared between players, and returns the number of
+  // the one which just finished. The count goes back when rolling back, like the emulation.
+  u32 CountTimeBaseFrame() { return m_timebase_frame++; }
+
+  // Keeps the time base of a frame until the inputs it depends on are all confirmed. Frames which
+  // were emulated again after a rollback replace their previous time base.
+  void RecordTimeBase(u32 frame, u64 timebase);
+
+  // Returns the recorded time bases which can no longer change, which are then forgotten.
+  std::vector<std::pair<u32, u64>> TakeConfirmedTimeBases();
+
+  // Returns the frames whose time bases were recorded but aren't confirmed, which are then
+  // forgotten. Called when the session ends, as they will never be confirmed.
+  std::vector<u32> TakeUnconfirmedTimeBaseFrames();
+
+  // Must be called at the CoreTiming safe point after each field, as states are saved and loaded
+  // here. See CoreTimingManager::RunAtSafePoint.
+  void OnFrameEnd(Core::System& system);
+
+protected:
+  // Returns the size of the state, or 0 on failure. Tests replace these with their own state.
+  virtual size_t SaveState(Core::System& system, Common::UniqueBuffer<u8>& buffer);
+  virtual void LoadState(Core::System& system, std::span<const u8> state);
+
+private:
+  struct Frame
+  {
+    Common::UniqueBuffer<u8> state;
+    size_t state_size = 0;
+    RollbackInputs::PollCounts poll_counts{};
+    u64 number = 0;
+    // The CoreTiming ticks the state was saved at, which restoring it has to bring back.
+    u64 ticks = 0;
+    u32 timebase_frame = 0;
+  };
+
+  struct TimeBase
+  {
+    u32 frame = 0;
+    u64 value = 0;
+    RollbackInputs::PollCounts poll_counts{};
+    // Set when the frame is rolled back, until it is emulated again.
+    bool outdated = false;
+  };
+
+  bool RollBack(Core::System& system);
+  void SaveFrame(Core::System& system);
+  void SetResimulating(std::optional<u64> until);
+
+  RollbackInputs m_inputs;
+  std::deque<Frame> m_frames;
+  std::vector<Common::UniqueBuffer<u8>> m_free_buffers;
+  size_t m_max_frames;
+
+  u64 m_frame = 0;
+  u32 m_timebase_frame = 0;
+  std::deque<TimeBase> m_timebases;
+  // Time bases of frames below this were already confirmed.
+  u32 m_first_unconfirmed_timebase = 0;
+  // Set to the frame which was being emulated when the last rollback happened, until it is reached.
+  std::optional<u64> m_resimulate_until;
+
+  u64 m_rollbacks = 0;
+  u64 m_resimulated_frames = 0;
+};
+}  // namespace NetPlay
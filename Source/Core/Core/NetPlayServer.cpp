@@ -1051,19 +1051,28 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   break;
 
   case MessageID::TimeBase:
+  case MessageID::TimeBaseUnavailable:
   {
-    u64 timebase = Common::PacketReadU64(packet);
+    std::optional<u64> reported_timebase;
+    if (mid == MessageID::TimeBase)
+      reported_timebase = Common::PacketReadU64(packet);
     u32 frame;
     packet >> frame;
 
     if (m_desync_detected)
       break;
 
-    std::vector<std::pair<PlayerId, u64>>& timebases = m_timebase_by_frame[frame];
-    timebases.emplace_back(player.pid, timebase);
-    if (timebases.size() >= m_players.size())
+    auto& reports = m_timebase_by_frame[frame];
+    reports.emplace_back(player.pid, reported_timebase);
+    if (reports.size() >= m_players.size())
     {
-      // we have all records for this frame
+      // we have all records for this frame, only the available ones can be compared
+      std::vector<std::pair<PlayerId, u64>> timebases;
+      for (const auto& [pid, timebase] : reports)
+      {
+        if (timebase)
+          timebases.emplace_back(pid, *timebase);
+      }
 
       if (!std::ranges::all_of(timebases, [&](std::pair<PlayerId, u64> pair) {
             return pair.second == timebases[0].second;
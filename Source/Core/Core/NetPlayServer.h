@@ -185,7 +185,9 @@ private:
 
   std::map<PlayerId, Client> m_players;
 
-  std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
+  // Players whose time base of a frame isn't available report it without one.
+  std::unordered_map<u32, std::vector<std::pair<PlayerId, std::optional<u64>>>>
+      m_timebase_by_frame;
   bool m_desync_detected = false;
 
   struct
@@ -0,0 +1,378 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Rewind.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <lz4.h>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Logging/Log.h"
+#include "Common/WorkQueueThread.h"
+
+#include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/Movie.h"
+#include "Core/NetPlayProto.h"
+#include "Core/State.h"
+#include "Core/StateDelta.h"
+#include "Core/System.h"
+
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
+
+namespace Rewind
+{
+namespace
+{
+// An LZ4 compressed keyframe or delta.
+struct Snapshot
+{
+  Common::UniqueBuffer<u8> data;
+  size_t uncompressed_size = 0;
+};
+
+// A keyframe followed by the deltas which were encoded against it. Deltas are never chained, so
+// restoring any snapshot costs at most decompressing one keyframe and one delta.
+struct SnapshotGroup
+{
+  Snapshot keyframe;
+  std::vector<Snapshot> deltas;
+  size_t compressed_size = 0;
+};
+
+struct Capture
+{
+  Common::UniqueBuffer<u8> buffer;
+  size_t state_size = 0;
+};
+
+// Snapshots which the encode thread hasn't processed yet. Captures are skipped while this many are
+// pending, which bounds the memory used by them if compression can't keep up.
+constexpr size_t MAX_PENDING_CAPTURES = 2;
+}  // namespace
+
+static bool s_enabled = false;
+static u32 s_frame_interval;
+static size_t s_keyframe_interval;
+static size_t s_buffer_size;
+
+// Only accessed on the CPU thread.
+static u32 s_frames_until_capture;
+static TimePoint s_last_capture_time;
+static u64 s_captures;
+static u64 s_skipped_captures;
+
+static std::atomic<bool> s_step_back_requested;
+static std::atomic<size_t> s_pending_captures;
+
+static Common::WorkQueueThread<Capture> s_encode_thread;
+
+// Capture buffers handed back by the encode thread for reuse.
+static std::mutex s_free_buffers_mutex;
+static std::vector<Common::UniqueBuffer<u8>> s_free_buffers;
+
+static std::mutex s_ring_mutex;
+static std::deque<SnapshotGroup> s_ring;
+static size_t s_ring_size;
+// Holds the uncompressed keyframe of s_ring.back(), if it is set.
+static State::StateDeltaEncoder s_encoder;
+
+static Snapshot Compress(std::span<const u8> data)
+{
+  Snapshot snapshot;
+  snapshot.uncompressed_size = data.size();
+
+  Common::UniqueBuffer<u8> compressed(LZ4_compressBound(static_cast<int>(data.size())));
+  const int compressed_size = LZ4_compress_default(
+      reinterpret_cast<const char*>(data.data()), reinterpret_cast<char*>(compressed.data()),
+      static_cast<int>(data.size()), static_cast<int>(compressed.size()));
+  if (compressed_size <= 0)
+  {
+    ERROR_LOG_FMT(CORE, "Rewind: Failed to compress {} byte snapshot", data.size());
+    return {};
+  }
+
+  // Shrink the buffer so the ring budget reflects the memory that is actually used.
+  snapshot.data.reset(compressed_size);
+  std::memcpy(snapshot.data.data(), compressed.data(), compressed_size);
+  return snapshot;
+}
+
+static bool Decompress(const Snapshot& snapshot, u8* out)
+{
+  const int size = LZ4_decompress_safe(
+      reinterpret_cast<const char*>(snapshot.data.data()), reinterpret_cast<char*>(out),
+      static_cast<int>(snapshot.data.size()), static_cast<int>(snapshot.uncompressed_size));
+  return size >= 0 && static_cast<size_t>(size) == snapshot.uncompressed_size;
+}
+
+static void RecycleBuffer(Common::UniqueBuffer<u8> buffer)
+{
+  std::lock_guard lk(s_free_buffers_mutex);
+  if (s_free_buffers.size() < MAX_PENDING_CAPTURES)
+    s_free_buffers.push_back(std::move(buffer));
+}
+
+static Common::UniqueBuffer<u8> TakeFreeBuffer()
+{
+  std::lock_guard lk(s_free_buffers_mutex);
+  if (s_free_buffers.empty())
+    return {};
+
+  Common::UniqueBuffer<u8> buffer = std::move(s_free_buffers.back());
+  s_free_buffers.pop_back();
+  return buffer;
+}
+
+// Drops the oldest groups until the ring fits into its budget. The newest group is always kept.
+static void TrimRing()
+{
+  while (s_ring_size > s_buffer_size && s_ring.size() > 1)
+  {
+    s_ring_size -= s_ring.front().compressed_size;
+    s_ring.pop_front();
+  }
+}
+
+static void EncodeCapture(Capture capture)
+{
+  const std::span<const u8> state{capture.buffer.data(), capture.state_size};
+
+  std::lock_guard lk(s_ring_mutex);
+
+  if (!s_encoder.HasKeyframe() || s_ring.empty() ||
+      s_ring.back().deltas.size() >= s_keyframe_interval)
+  {
+    SnapshotGroup group;
+    group.keyframe = Compress(state);
+    group.compressed_size = group.keyframe.data.size();
+    if (group.keyframe.data.empty())
+    {
+      s_encoder.ClearKeyframe();
+      return;
+    }
+
+    // The keyframe has to be exactly as large as the state it was compressed from.
+    if (capture.buffer.size() != capture.state_size)
+    {
+      Common::UniqueBuffer<u8> keyframe(capture.state_size);
+      std::memcpy(keyframe.data(), state.data(), state.size());
+      capture.buffer.swap(keyframe);
+    }
+
+    s_encoder.SetKeyframe(std::move(capture.buffer));
+    s_ring_size += group.compressed_size;
+    s_ring.push_back(std::move(group));
+  }
+  else
+  {
+    std::vector<u8> delta;
+    s_encoder.Encode(state, &delta);
+    RecycleBuffer(std::move(capture.buffer));
+
+    Snapshot snapshot = Compress(delta);
+    if (snapshot.data.empty())
+      return;
+
+    SnapshotGroup& group = s_ring.back();
+    group.compressed_size += snapshot.data.size();
+    s_ring_size += snapshot.data.size();
+    group.deltas.push_back(std::move(snapshot));
+  }
+
+  TrimRing();
+  g_perf_metrics.SetRewindBufferSize(s_ring_size);
+}
+
+void Init()
+{
+  s_enabled = Config::Get(Config::MAIN_REWIND_ENABLE) && !NetPlay::IsNetPlayRunning() &&
+              !AchievementManager::GetInstance().IsHardcoreModeActive();
+  if (!s_enabled)
+    return;
+
+  s_frame_interval =
+      static_cast<u32>(std::max(Config::Get(Config::MAIN_REWIND_FRAME_INTERVAL), 1));
+  s_keyframe_interval =
+      static_cast<size_t>(std::max(Config::Get(Config::MAIN_REWIND_KEYFRAME_INTERVAL), 1));
+  s_buffer_size =
+      static_cast<size_t>(std::max(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE_MB), 1)) << 20;
+
+  s_frames_until_capture = s_frame_interval;
+  s_last_capture_time = Clock::now();
+  s_captures = 0;
+  s_skipped_captures = 0;
+  s_step_back_requested = false;
+  s_pending_captures = 0;
+
+  s_encode_thread.Reset("Rewind Encoder", [](Capture capture) {
+    EncodeCapture(std::move(capture));
+    --s_pending_captures;
+  });
+}
+
+void Shutdown()
+{
+  if (!s_enabled)
+    return;
+
+  s_encode_thread.Shutdown();
+
+  {
+    std::lock_guard lk(s_ring_mutex);
+    INFO_LOG_FMT(CORE, "Rewind: {} snapshots captured, {} skipped, {} KiB in {} keyframe groups",
+                 s_captures, s_skipped_captures, s_ring_size / 1024, s_ring.size());
+    s_ring.clear();
+    s_ring_size = 0;
+    s_encoder.ClearKeyframe();
+  }
+
+  {
+    std::lock_guard lk(s_free_buffers_mutex);
+    s_free_buffers.clear();
+  }
+
+  s_enabled = false;
+}
+
+bool IsEnabled()
+{
+  return s_enabled;
+}
+
+static bool StepBack(Core::System& system);
+
+void OnFrameEnd(Core::System& system)
+{
+  if (!s_enabled)
+    return;
+
+  if (s_step_back_requested.exchange(false, std::memory_order_relaxed))
+  {
+    StepBack(system);
+    s_frames_until_capture = s_frame_interval;
+    return;
+  }
+
+  if (--s_frames_until_capture != 0)
+    return;
+  s_frames_until_capture = s_frame_interval;
+
+  if (s_pending_captures.load(std::memory_order_relaxed) >= MAX_PENDING_CAPTURES)
+  {
+    ++s_skipped_captures;
+    return;
+  }
+
+  const TimePoint capture_start = Clock::now();
+
+  Capture capture;
+  capture.buffer = TakeFreeBuffer();
+  capture.state_size = State::SaveToReusedBuffer(system, capture.buffer);
+  if (capture.state_size == 0)
+  {
+    ++s_skipped_captures;
+    return;
+  }
+
+  ++s_captures;
+  ++s_pending_captures;
+  s_encode_thread.Push(std::move(capture));
+
+  // Only the time spent on the CPU thread slows down emulation, encoding happens in the background.
+  const TimePoint capture_end = Clock::now();
+  g_perf_metrics.CountRewindCapture(capture_end - capture_start,
+                                    capture_end - s_last_capture_time);
+  s_last_capture_time = capture_end;
+}
+
+void RequestStepBack()
+{
+  if (s_enabled)
+    s_step_back_requested.store(true, std::memory_order_relaxed);
+}
+
+// Loads the most recent snapshot and removes it from the ring.
+static bool StepBack(Core::System& system)
+{
+  if (!s_enabled)
+    return false;
+
+  if (system.GetMovie().IsMovieActive())
+  {
+    OSD::AddMessage("Rewinding is disabled while a movie is active");
+    return false;
+  }
+
+  // Make sure the most recent captures are in the ring.
+  s_encode_thread.WaitForCompletion();
+
+  Common::UniqueBuffer<u8> state;
+  {
+    std::lock_guard lk(s_ring_mutex);
+    if (s_ring.empty())
+    {
+      OSD::AddMessage("No more rewind snapshots", OSD::Duration::SHORT);
+      return false;
+    }
+
+    SnapshotGroup& group = s_ring.back();
+    if (!s_encoder.HasKeyframe())
+    {
+      Common::UniqueBuffer<u8> keyframe(group.keyframe.uncompressed_size);
+      if (!Decompress(group.keyframe, keyframe.data()))
+      {
+        ERROR_LOG_FMT(CORE, "Rewind: Failed to decompress keyframe");
+        s_ring_size -= group.compressed_size;
+        s_ring.pop_back();
+        return false;
+      }
+      s_encoder.SetKeyframe(std::move(keyframe));
+    }
+
+    if (!group.deltas.empty())
+    {
+      const Snapshot snapshot = std::move(group.deltas.back());
+      group.deltas.pop_back();
+      group.compressed_size -= snapshot.data.size();
+      s_ring_size -= snapshot.data.size();
+
+      std::vector<u8> delta(snapshot.uncompressed_size);
+      if (!Decompress(snapshot, delta.data()) ||
+          !State::DecodeStateDelta(s_encoder.GetKeyframe(), delta, state))
+      {
+        ERROR_LOG_FMT(CORE, "Rewind: Failed to decode snapshot");
+        return false;
+      }
+    }
+    else
+    {
+      const std::span<const u8> keyframe = s_encoder.GetKeyframe();
+      state.reset(keyframe.size());
+      std::memcpy(state.data(), keyframe.data(), keyframe.size());
+
+      // The next capture starts a new group.
+      s_encoder.ClearKeyframe();
+      s_ring_size -= group.compressed_size;
+      s_ring.pop_back();
+    }
+
+    g_perf_metrics.SetRewindBufferSize(s_ring_size);
+  }
+
+  State::LoadFromBuffer(system, state);
+  return true;
+}
+}  // namespace Rewind
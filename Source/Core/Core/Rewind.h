@@ -0,0 +1,27 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Rewinding by periodically capturing savestates into a fixed size ring in memory.
+
+#pragma once
+
+namespace Core
+{
+class System;
+}
+
+namespace Rewind
+{
+void Init();
+void Shutdown();
+
+bool IsEnabled();
+
+// Called on the CPU thread at the CoreTiming safe point after every field. Captures a snapshot
+// every Main.Core.RewindFrameInterval fields, or steps back if that was requested.
+void OnFrameEnd(Core::System& system);
+
+// Requests stepping back by one snapshot at the end of the next field. May be called from any
+// thread, e.g. repeatedly while the rewind hotkey is held.
+void RequestStepBack();
+}  // namespace Rewind
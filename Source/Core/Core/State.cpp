@@ -4,13 +4,18 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -19,31 +24,38 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Contains.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/GeckoCode.h"
 #include "Core/HW/HW.h"
 #include "Core/HW/Memmap.h"
+#include "Core/HW/MemorySnapshot.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/StateDelta.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -77,6 +89,14 @@ struct CompressAndDumpState_args
   Common::UniqueBuffer<u8> buffer;
   std::string filename;
   std::shared_ptr<Common::Event> state_write_done_event;
+  bool incremental = false;
+  int keyframe_interval = 0;
+  CompressionType compression_type = CompressionType::Uncompressed;
+  int compression_level = 0;
+  TimePoint save_start;
+  DT serialize_time{};
+  // Set if emulated memory is still being captured by a copy-on-write snapshot.
+  std::optional<u64> snapshot_id;
 };
 
 // Protects against simultaneous reads and writes to the final savestate location from multiple
@@ -94,15 +114,25 @@ static std::mutex s_state_writes_in_queue_mutex;
 static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
+// Keyframe which incremental states are encoded against. Only accessed by the save thread.
+static StateDeltaEncoder s_delta_encoder;
+static std::string s_keyframe_filename;
+static double s_keyframe_time;
+static int s_deltas_since_keyframe;
+
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 175;  // Last changed in PR 13751
+constexpr u32 STATE_VERSION = 176;  // Last changed for page aligned memory arrays
 
 // Increase this if the StateExtendedHeader definition changes
-constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
+constexpr u32 EXTENDED_HEADER_VERSION = 2;  // Last changed for incremental states
 
 // Change this if we ever need to store more data in the extended header
 constexpr u32 COMPRESSED_DATA_OFFSET = 0;
 
+// Uncompressed size of the chunks of chunked states. Small enough to spread the state across all
+// cores, large enough for the compression ratio to not suffer noticeably.
+constexpr u32 STATE_CHUNK_SIZE = 4 * 1024 * 1024;
+
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
 // Maps savestate versions to Dolphin versions.
@@ -225,6 +255,14 @@ void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
       true);
 }
 
+void LoadFromReusedBuffer(Core::System& system, std::span<const u8> state)
+{
+  // Read mode never writes through the pointer.
+  u8* ptr = const_cast<u8*>(state.data());
+  PointerWrap p(&ptr, state.size(), PointerWrap::Mode::Read);
+  DoState(system, p);
+}
+
 void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
   Core::RunOnCPUThread(
@@ -245,6 +283,23 @@ void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
       true);
 }
 
+size_t SaveToReusedBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+{
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  DoState(system, p);
+  const size_t state_size = ptr - buffer.data();
+  if (p.IsWriteMode())
+    return state_size;
+
+  // PointerWrap switched to measuring once the buffer was full, so state_size is the full size.
+  buffer.reset(state_size);
+  ptr = buffer.data();
+  PointerWrap p_retry(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  DoState(system, p_retry);
+  return p_retry.IsWriteMode() ? state_size : 0;
+}
+
 namespace
 {
 struct SlotWithTimestamp
@@ -309,50 +364,119 @@ static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
   return result;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+static CompressionType GetConfiguredCompressionType()
 {
-  u64 total_bytes_compressed = 0;
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
 
-  while (true)
+  return Config::Get(Config::MAIN_SAVESTATE_COMPRESSION) == Config::SaveStateCompression::Zstd ?
+             CompressionType::ChunkedZstd :
+             CompressionType::ChunkedLZ4;
+}
+
+// Calls func(i) for every chunk index i, spreading the chunks across all hardware threads.
+template <typename Func>
+static void ForEachChunkInParallel(size_t chunk_count, const Func& func)
+{
+  const size_t threads =
+      std::min<size_t>(chunk_count, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+  std::vector<std::future<void>> futures(threads);
+  for (size_t i = 0; i < threads; ++i)
   {
-    const u64 bytes_left_to_compress = size - total_bytes_compressed;
+    futures[i] = std::async(
+        std::launch::async,
+        [&func](size_t start, size_t end) {
+          for (size_t j = start; j < end; ++j)
+            func(j);
+        },
+        i * chunk_count / threads, (i + 1) * chunk_count / threads);
+  }
 
-    const int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    Common::UniqueBuffer<char> compressed_buffer(LZ4_compressBound(bytes_to_compress));
-    const int compressed_len = LZ4_compress_default(
-        reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed, compressed_buffer.get(),
-        bytes_to_compress, int(compressed_buffer.size()));
+  for (std::future<void>& future : futures)
+    future.get();
+}
 
-    if (compressed_len == 0)
+static bool CompressChunksToFile(const u8* raw_buffer, u64 size, CompressionType compression_type,
+                                 int compression_level, File::IOFile& f)
+{
+  StateChunkIndex index;
+  index.chunk_size = STATE_CHUNK_SIZE;
+  index.chunk_count = static_cast<u32>((size + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE);
+
+  std::vector<Common::UniqueBuffer<u8>> chunks(index.chunk_count);
+  std::vector<u32> compressed_sizes(index.chunk_count);
+
+  ForEachChunkInParallel(index.chunk_count, [&](size_t i) {
+    const u8* const chunk = raw_buffer + i * STATE_CHUNK_SIZE;
+    const size_t chunk_size = std::min<u64>(STATE_CHUNK_SIZE, size - i * STATE_CHUNK_SIZE);
+
+    if (compression_type == CompressionType::ChunkedZstd)
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      chunks[i].reset(ZSTD_compressBound(chunk_size));
+      const size_t result =
+          ZSTD_compress(chunks[i].data(), chunks[i].size(), chunk, chunk_size, compression_level);
+      if (!ZSTD_isError(result))
+        compressed_sizes[i] = static_cast<u32>(result);
     }
+    else
+    {
+      chunks[i].reset(LZ4_compressBound(static_cast<int>(chunk_size)));
+      const int result = LZ4_compress_default(
+          reinterpret_cast<const char*>(chunk), reinterpret_cast<char*>(chunks[i].data()),
+          static_cast<int>(chunk_size), static_cast<int>(chunks[i].size()));
+      if (result > 0)
+        compressed_sizes[i] = static_cast<u32>(result);
+    }
+  });
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
-
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
+  if (std::ranges::find(compressed_sizes, 0u) != compressed_sizes.end())
+  {
+    PanicAlertFmtT("Internal compression error - compressing the state failed");
+    return false;
   }
+
+  f.WriteArray(&index, 1);
+  f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+  for (size_t i = 0; i < chunks.size(); ++i)
+    f.WriteBytes(chunks[i].data(), compressed_sizes[i]);
+
+  return true;
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void SetDeltaHeader(StateExtendedHeader& extended_header, double keyframe_time,
+                           u64 keyframe_size, std::string keyframe_filename)
+{
+  StateDeltaHeader& delta_header = extended_header.delta_header;
+  delta_header.keyframe_time = keyframe_time;
+  delta_header.keyframe_size = keyframe_size;
+  delta_header.keyframe_filename_length = static_cast<u32>(keyframe_filename.length());
+  delta_header.reserved = 0;
+  extended_header.keyframe_filename = std::move(keyframe_filename);
+
+  extended_header.base_header.payload_offset =
+      static_cast<u32>(DELTA_HEADER_SIZE + extended_header.keyframe_filename.length());
+}
+
+static bool IsIncrementalState(const StateExtendedHeader& extended_header)
+{
+  return extended_header.base_header.payload_offset != COMPRESSED_DATA_OFFSET;
+}
+
+// Returns the time stored in the written header.
+static double WriteHeadersToFile(const StateExtendedHeader& extended_header, File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -363,23 +487,47 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_string = Common::GetScmRevStr();
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
-  StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
-
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
   f.WriteString(header.version_string);
 
   f.WriteArray(&extended_header.base_header, 1);
   // If StateExtendedHeader is amended to include more than the base, add WriteBytes() calls here.
+  if (IsIncrementalState(extended_header))
+  {
+    f.WriteArray(&extended_header.delta_header, 1);
+    f.WriteString(extended_header.keyframe_filename);
+  }
+
+  return header.legacy_header.time;
 }
 
-static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
+// Returns the time stored in the written header, or nothing if the payload couldn't be written.
+static std::optional<double> WriteStateToFile(const StateExtendedHeader& extended_header,
+                                              const u8* data, size_t size, int compression_level,
+                                              File::IOFile& f)
 {
-  const u8* const buffer_data = save_args.buffer.data();
-  const size_t buffer_size = save_args.buffer.size();
-  const std::string& filename = save_args.filename;
+  const double time = WriteHeadersToFile(extended_header, f);
+
+  const auto compression_type =
+      static_cast<CompressionType>(extended_header.base_header.compression_type);
+  if (compression_type == CompressionType::Uncompressed)
+  {
+    if (!f.WriteBytes(data, size))
+      return std::nullopt;
+  }
+  else if (!CompressChunksToFile(data, size, compression_type, compression_level, f))
+  {
+    return std::nullopt;
+  }
 
+  if (!f.IsGood())
+    return std::nullopt;
+  return time;
+}
+
+static std::string GetTempFilename(const std::string& filename)
+{
   // Find free temporary filename.
   // TODO: The file exists check and the actual opening of the file should be atomic, we don't have
   // functions for that.
@@ -391,6 +539,95 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     ++temp_counter;
   } while (File::Exists(temp_filename));
 
+  return temp_filename;
+}
+
+// Writes a full state to keyframe_filename and makes it the keyframe of later incremental states.
+static bool WriteKeyframe(Common::UniqueBuffer<u8>& buffer, const std::string& keyframe_filename,
+                          CompressionType compression_type, int compression_level)
+{
+  s_delta_encoder.ClearKeyframe();
+  s_keyframe_filename.clear();
+
+  const std::string temp_filename = GetTempFilename(keyframe_filename);
+  File::IOFile f(temp_filename, "wb");
+  if (!f)
+  {
+    Core::DisplayMessage("Failed to create state keyframe file", 2000);
+    return false;
+  }
+
+  StateExtendedHeader extended_header{};
+  CreateExtendedHeader(extended_header, buffer.size(), compression_type);
+  const std::optional<double> time =
+      WriteStateToFile(extended_header, buffer.data(), buffer.size(), compression_level, f);
+
+  bool success = time.has_value() && f.Close();
+  if (success)
+  {
+    std::lock_guard lk(s_save_thread_mutex);
+    success = File::Rename(temp_filename, keyframe_filename);
+  }
+
+  if (!success)
+  {
+    Core::DisplayMessage("Failed to write state keyframe file", 2000);
+    File::Delete(temp_filename);
+    return false;
+  }
+
+  s_delta_encoder.SetKeyframe(std::move(buffer));
+  s_keyframe_filename = keyframe_filename;
+  s_keyframe_time = *time;
+  s_deltas_since_keyframe = 0;
+  return true;
+}
+
+static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
+{
+  const TimePoint snapshot_start = Clock::now();
+  if (save_args.snapshot_id)
+    system.GetMemory().GetSnapshot().Finish(*save_args.snapshot_id);
+  const DT snapshot_time = Clock::now() - snapshot_start;
+
+  // Moving the buffer into the delta encoder keeps its data where it is.
+  const std::span<const u8> state{save_args.buffer.data(), save_args.buffer.size()};
+  const std::string& filename = save_args.filename;
+
+  const TimePoint compress_start = Clock::now();
+
+  StateExtendedHeader extended_header{};
+  CreateExtendedHeader(extended_header, state.size(), save_args.compression_type);
+  std::span<const u8> payload = state;
+  std::vector<u8> delta;
+
+  if (save_args.incremental)
+  {
+    const std::string keyframe_filename = filename + ".key";
+    const bool needs_keyframe = !s_delta_encoder.HasKeyframe() ||
+                                s_keyframe_filename != keyframe_filename ||
+                                s_deltas_since_keyframe >= save_args.keyframe_interval ||
+                                !File::Exists(keyframe_filename);
+    if (needs_keyframe && !WriteKeyframe(save_args.buffer, keyframe_filename,
+                                         save_args.compression_type, save_args.compression_level))
+    {
+      return;
+    }
+
+    const size_t literal_bytes = s_delta_encoder.Encode(state, &delta);
+    ++s_deltas_since_keyframe;
+
+    // The keyframe is looked up next to the incremental state when loading it.
+    SetDeltaHeader(extended_header, s_keyframe_time, s_delta_encoder.GetKeyframe().size(),
+                   PathToString(StringToPath(keyframe_filename).filename()));
+    extended_header.base_header.uncompressed_size = delta.size();
+    payload = delta;
+
+    INFO_LOG_FMT(CORE, "Incremental state: {} of {} bytes changed since keyframe ({} deltas)",
+                 literal_bytes, state.size(), s_deltas_since_keyframe);
+  }
+
+  const std::string temp_filename = GetTempFilename(filename);
   File::IOFile f(temp_filename, "wb");
   if (!f)
   {
@@ -398,15 +635,18 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
+  const std::optional<double> written = WriteStateToFile(
+      extended_header, payload.data(), payload.size(), save_args.compression_level, f);
+  const DT compress_time = Clock::now() - compress_start;
 
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
-  else
-    f.WriteBytes(buffer_data, buffer_size);
-
-  if (!f.IsGood())
+  // Keep the existing state rather than replacing it with one that is missing its data.
+  if (!written)
+  {
     Core::DisplayMessage("Failed to write state file", 2000);
+    f.Close();
+    File::Delete(temp_filename);
+    return;
+  }
 
   const std::string last_state_filename = File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav";
   const std::string last_state_dtmname = last_state_filename + ".dtm";
@@ -453,7 +693,16 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     else
     {
       const std::filesystem::path temp_path(filename);
-      Core::DisplayMessage(fmt::format("Saved State to {}", temp_path.filename().string()), 2000);
+      const DT save_time = Clock::now() - save_args.save_start;
+      Core::DisplayMessage(fmt::format("Saved State to {} in {:.0f} ms",
+                                       temp_path.filename().string(), DT_ms(save_time).count()),
+                           2000);
+      INFO_LOG_FMT(CORE,
+                   "Saved state to {} in {:.1f} ms: {:.1f} ms serializing, {:.1f} ms copying "
+                   "memory snapshot, {:.1f} ms compressing {} bytes",
+                   temp_path.filename().string(), DT_ms(save_time).count(),
+                   DT_ms(save_args.serialize_time).count(), DT_ms(snapshot_time).count(),
+                   DT_ms(compress_time).count(), payload.size());
     }
   }
 
@@ -466,6 +715,10 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
   if (!lk)
     return;
 
+  const TimePoint save_start = Clock::now();
+  const bool copy_on_write =
+      Config::Get(Config::MAIN_COPY_ON_WRITE_SAVESTATES) && Memory::MemorySnapshot::IsSupported();
+
   Core::RunOnCPUThread(
       system,
       [&] {
@@ -474,17 +727,26 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
+        const TimePoint serialize_start = Clock::now();
+
         // Measure the size of the buffer.
         u8* ptr = nullptr;
         PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
         DoState(system, p_measure);
         const size_t buffer_size = ptr - (u8*)(nullptr);
 
-        // Then actually do the write.
+        // Then actually do the write. With a copy-on-write snapshot, emulated memory is copied
+        // into the buffer by the save thread and by whoever writes to it first.
         Common::UniqueBuffer<u8> current_buffer(buffer_size);
         ptr = current_buffer.data();
         PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+        Memory::MemorySnapshot& snapshot = system.GetMemory().GetSnapshot();
+        std::optional<u64> snapshot_id;
+        if (copy_on_write)
+          snapshot_id = snapshot.BeginCapture();
         DoState(system, p);
+        if (copy_on_write)
+          snapshot.EndCapture();
 
         if (p.IsWriteMode())
         {
@@ -495,6 +757,13 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           CompressAndDumpState_args save_args;
           save_args.buffer = std::move(current_buffer);
           save_args.filename = filename;
+          save_args.incremental = Config::Get(Config::MAIN_INCREMENTAL_SAVESTATES);
+          save_args.keyframe_interval = Config::Get(Config::MAIN_SAVESTATE_KEYFRAME_INTERVAL);
+          save_args.compression_type = GetConfiguredCompressionType();
+          save_args.compression_level = Config::Get(Config::MAIN_SAVESTATE_ZSTD_LEVEL);
+          save_args.save_start = save_start;
+          save_args.serialize_time = Clock::now() - serialize_start;
+          save_args.snapshot_id = snapshot_id;
           if (wait)
           {
             sync_event = std::make_shared<Common::Event>();
@@ -509,6 +778,8 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
         else
         {
           // someone aborted the save by changing the mode?
+          if (snapshot_id)
+            snapshot.Finish(*snapshot_id);
           {
             // Note: The worker thread takes care of this in the other branch.
             std::lock_guard lk_(s_state_writes_in_queue_mutex);
@@ -708,6 +979,81 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunks(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                             CompressionType compression_type, File::IOFile& f)
+{
+  StateChunkIndex index;
+  if (!f.ReadArray(&index, 1) || index.chunk_size == 0 ||
+      index.chunk_count != (size + index.chunk_size - 1) / index.chunk_size)
+  {
+    PanicAlertFmt("State chunk index corrupted");
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(index.chunk_count);
+  if (!f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    PanicAlertFmt("Could not read state chunk index");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(index.chunk_count);
+  u64 compressed_size = 0;
+  for (size_t i = 0; i < compressed_sizes.size(); ++i)
+  {
+    compressed_offsets[i] = compressed_size;
+    compressed_size += compressed_sizes[i];
+  }
+
+  if (compressed_size > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("State data truncated");
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> compressed_data(compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+
+  std::atomic<bool> success = true;
+  ForEachChunkInParallel(index.chunk_count, [&](size_t i) {
+    u8* const chunk = raw_buffer.data() + i * index.chunk_size;
+    const size_t chunk_size = std::min<u64>(index.chunk_size, size - i * index.chunk_size);
+    const u8* const compressed_chunk = compressed_data.data() + compressed_offsets[i];
+
+    bool chunk_success;
+    if (compression_type == CompressionType::ChunkedZstd)
+    {
+      const size_t result =
+          ZSTD_decompress(chunk, chunk_size, compressed_chunk, compressed_sizes[i]);
+      chunk_success = !ZSTD_isError(result) && result == chunk_size;
+    }
+    else
+    {
+      const int result = LZ4_decompress_safe(
+          reinterpret_cast<const char*>(compressed_chunk), reinterpret_cast<char*>(chunk),
+          static_cast<int>(compressed_sizes[i]), static_cast<int>(chunk_size));
+      chunk_success = result >= 0 && static_cast<size_t>(result) == chunk_size;
+    }
+
+    if (!chunk_success)
+      success.store(false, std::memory_order_relaxed);
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal compression error - decompressing the state failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -755,55 +1101,61 @@ static bool ValidateHeaders(const StateHeader& header)
   return success;
 }
 
-static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data)
+static bool ReadExtendedHeaderFromFile(StateExtendedHeader& extended_header, File::IOFile& f)
 {
-  File::IOFile f;
-
-  {
-    // If a state is currently saving, wait for that to end or time out.
-    std::unique_lock lk(s_state_writes_in_queue_mutex);
-    if (s_state_writes_in_queue != 0)
-    {
-      if (!s_state_write_queue_is_empty.wait_for(lk, std::chrono::seconds(3),
-                                                 [] { return s_state_writes_in_queue == 0; }))
-      {
-        Core::DisplayMessage(
-            "A previous state saving operation is still in progress, cancelling load.", 2000);
-        return;
-      }
-    }
-    f.Open(filename, "rb");
-  }
-
-  StateHeader header;
-  if (!ReadStateHeaderFromFile(header, f) || !ValidateHeaders(header))
-    return;
-
-  StateExtendedHeader extended_header;
   if (!f.ReadArray(&extended_header.base_header, 1))
   {
     PanicAlertFmt("Unable to read state header");
-    return;
+    return false;
   }
   // If StateExtendedHeader is amended to include more than the base, add ReadBytes() calls here.
 
   if (extended_header.base_header.header_version != EXTENDED_HEADER_VERSION)
   {
     PanicAlertFmt("State header corrupted");
-    return;
+    return false;
   }
 
-  Common::UniqueBuffer<u8> buffer;
+  if (!IsIncrementalState(extended_header))
+    return true;
 
+  StateDeltaHeader& delta_header = extended_header.delta_header;
+  if (!f.ReadArray(&delta_header, 1) ||
+      extended_header.base_header.payload_offset !=
+          DELTA_HEADER_SIZE + u64{delta_header.keyframe_filename_length})
+  {
+    PanicAlertFmt("State delta header corrupted");
+    return false;
+  }
+
+  std::string keyframe_filename(delta_header.keyframe_filename_length, '\0');
+  if (!f.ReadBytes(keyframe_filename.data(), keyframe_filename.size()))
+  {
+    PanicAlertFmt("Unable to read state keyframe filename");
+    return false;
+  }
+  extended_header.keyframe_filename = std::move(keyframe_filename);
+
+  return true;
+}
+
+static bool ReadStatePayloadFromFile(const StateHeader& header,
+                                     const StateExtendedHeader& extended_header,
+                                     Common::UniqueBuffer<u8>& buffer, File::IOFile& f)
+{
   switch (extended_header.base_header.compression_type)
   {
   case CompressionType::LZ4:
   {
     Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
-    if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
-      return;
-
-    break;
+    return DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f);
+  }
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+  {
+    return DecompressChunks(
+        buffer, extended_header.base_header.uncompressed_size,
+        static_cast<CompressionType>(extended_header.base_header.compression_type), f);
   }
   case CompressionType::Uncompressed:
   {
@@ -815,7 +1167,7 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
     if (file_size < header_len)
     {
       PanicAlertFmt("State header length corrupted");
-      return;
+      return false;
     }
 
     const auto size = static_cast<size_t>(file_size - header_len);
@@ -824,13 +1176,96 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
     if (!f.ReadBytes(buffer.data(), size))
     {
       PanicAlertFmt("Error reading bytes: {0}", size);
-      return;
+      return false;
     }
-    break;
+    return true;
   }
   default:
     PanicAlertFmt("Unknown compression type {0}", extended_header.base_header.compression_type);
+    return false;
+  }
+}
+
+// Loads the keyframe that the incremental state in filename was encoded against.
+static bool LoadKeyframeStateData(const std::string& filename,
+                                  const StateExtendedHeader& delta_extended_header,
+                                  Common::UniqueBuffer<u8>& keyframe)
+{
+  const std::string keyframe_filename =
+      PathToString(StringToPath(filename).parent_path() /
+                   StringToPath(delta_extended_header.keyframe_filename));
+
+  File::IOFile f(keyframe_filename, "rb");
+  StateHeader header;
+  StateExtendedHeader extended_header;
+  if (!f.IsOpen() || !ReadStateHeaderFromFile(header, f) ||
+      !ReadExtendedHeaderFromFile(extended_header, f))
+  {
+    Core::DisplayMessage(fmt::format("Failed to read state keyframe {}",
+                                     delta_extended_header.keyframe_filename),
+                         OSD::Duration::NORMAL);
+    return false;
+  }
+
+  const StateDeltaHeader& delta_header = delta_extended_header.delta_header;
+  if (IsIncrementalState(extended_header) ||
+      header.legacy_header.time != delta_header.keyframe_time ||
+      extended_header.base_header.uncompressed_size != delta_header.keyframe_size)
+  {
+    Core::DisplayMessage("The keyframe of this incremental savestate was replaced by a newer one",
+                         OSD::Duration::NORMAL);
+    return false;
+  }
+
+  return ReadStatePayloadFromFile(header, extended_header, keyframe, f);
+}
+
+static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data)
+{
+  File::IOFile f;
+
+  {
+    // If a state is currently saving, wait for that to end or time out.
+    std::unique_lock lk(s_state_writes_in_queue_mutex);
+    if (s_state_writes_in_queue != 0)
+    {
+      if (!s_state_write_queue_is_empty.wait_for(lk, std::chrono::seconds(3),
+                                                 [] { return s_state_writes_in_queue == 0; }))
+      {
+        Core::DisplayMessage(
+            "A previous state saving operation is still in progress, cancelling load.", 2000);
+        return;
+      }
+    }
+    f.Open(filename, "rb");
+  }
+
+  StateHeader header;
+  if (!ReadStateHeaderFromFile(header, f) || !ValidateHeaders(header))
     return;
+
+  StateExtendedHeader extended_header;
+  if (!ReadExtendedHeaderFromFile(extended_header, f))
+    return;
+
+  Common::UniqueBuffer<u8> buffer;
+  if (!ReadStatePayloadFromFile(header, extended_header, buffer, f))
+    return;
+
+  if (IsIncrementalState(extended_header))
+  {
+    Common::UniqueBuffer<u8> keyframe;
+    if (!LoadKeyframeStateData(filename, extended_header, keyframe))
+      return;
+
+    Common::UniqueBuffer<u8> state;
+    if (!DecodeStateDelta({keyframe.data(), keyframe.size()}, {buffer.data(), buffer.size()},
+                          state))
+    {
+      PanicAlertFmt("Incremental state data corrupted");
+      return;
+    }
+    buffer.swap(state);
   }
 
   // all good
@@ -858,6 +1293,8 @@ void LoadAs(Core::System& system, const std::string& filename)
   if (!lk)
     return;
 
+  const TimePoint load_start = Clock::now();
+
   Core::RunOnCPUThread(
       system,
       [&] {
@@ -876,19 +1313,25 @@ void LoadAs(Core::System& system, const std::string& filename)
 
         bool loaded = false;
         bool loadedSuccessfully = false;
+        DT read_time{};
+        DT deserialize_time{};
 
         // brackets here are so buffer gets freed ASAP
         {
+          const TimePoint read_start = Clock::now();
           Common::UniqueBuffer<u8> buffer;
           LoadFileStateData(filename, buffer);
+          read_time = Clock::now() - read_start;
 
           if (!buffer.empty())
           {
+            const TimePoint deserialize_start = Clock::now();
             u8* ptr = buffer.data();
             PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
             DoState(system, p);
             loaded = true;
             loadedSuccessfully = p.IsReadMode();
+            deserialize_time = Clock::now() - deserialize_start;
           }
         }
 
@@ -897,8 +1340,16 @@ void LoadAs(Core::System& system, const std::string& filename)
           if (loadedSuccessfully)
           {
             std::filesystem::path tempfilename(filename);
-            Core::DisplayMessage(
-                fmt::format("Loaded State from {}", tempfilename.filename().string()), 2000);
+            const DT load_time = Clock::now() - load_start;
+            Core::DisplayMessage(fmt::format("Loaded State from {} in {:.0f} ms",
+                                             tempfilename.filename().string(),
+                                             DT_ms(load_time).count()),
+                                 2000);
+            INFO_LOG_FMT(CORE,
+                         "Loaded state from {} in {:.1f} ms: {:.1f} ms reading and decompressing, "
+                         "{:.1f} ms deserializing",
+                         tempfilename.filename().string(), DT_ms(load_time).count(),
+                         DT_ms(read_time).count(), DT_ms(deserialize_time).count());
             if (File::Exists(filename + ".dtm"))
               movie.LoadInput(filename + ".dtm");
             else if (!movie.IsJustStartingRecordingInputFromSaveState() &&
@@ -945,6 +1396,10 @@ void Shutdown()
 {
   s_save_thread.Shutdown();
 
+  s_delta_encoder.ClearKeyframe();
+  s_keyframe_filename.clear();
+  s_deltas_since_keyframe = 0;
+
   std::lock_guard lk(s_undo_load_buffer_mutex);
   s_undo_load_buffer.reset();
 }
@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <type_traits>
 
@@ -55,10 +56,23 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // Independently compressed chunks which can be decompressed in parallel, see StateChunkIndex.
+  ChunkedLZ4 = 2,
+  ChunkedZstd = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
 
+// Starts the payload of chunked states. It is followed by the u32 compressed size of each chunk and
+// then the compressed chunks. Every chunk except for the last one decompresses to chunk_size bytes.
+struct StateChunkIndex
+{
+  u32 chunk_size;
+  u32 chunk_count;
+};
+static_assert(sizeof(StateChunkIndex) == 8);
+static_assert(std::is_trivially_copyable_v<StateChunkIndex>);
+
 struct StateExtendedBaseHeader
 {
   u16 header_version;
@@ -72,9 +86,29 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+// Follows the extended base header of incremental states, which have a nonzero payload_offset.
+// The payload of these states is a delta against the keyframe state named by keyframe_filename,
+// which is stored next to the incremental state.
+struct StateDeltaHeader
+{
+  // legacy_header.time and uncompressed size of the keyframe this state was encoded against
+  double keyframe_time;
+  u64 keyframe_size;
+  u32 keyframe_filename_length;
+  u32 reserved;
+};
+constexpr size_t DELTA_HEADER_SIZE = sizeof(StateDeltaHeader);
+static_assert(DELTA_HEADER_SIZE == 24);
+static_assert(offsetof(StateDeltaHeader, keyframe_size) == 8);
+static_assert(offsetof(StateDeltaHeader, keyframe_filename_length) == 16);
+static_assert(std::is_trivially_copyable_v<StateDeltaHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
+  // Only present for incremental states.
+  StateDeltaHeader delta_header;
+  std::string keyframe_filename;
   // Feel free to add new fields here, adjusting COMPRESSED_DATA_OFFSET accordingly, as well as
   // CreateExtendedHeader(). Add the appropriate IOFile read/write calls within LoadFileStateData()
   // and WriteHeadersToFile()
@@ -107,7 +141,14 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait = false
 void LoadAs(Core::System& system, const std::string& filename);
 
 void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
+// Like SaveToBuffer(), but only measures the state if it doesn't fit into the buffer, which makes
+// saving repeatedly into the same buffer cheaper. Returns the size of the state, which can be less
+// than the size of the buffer, or 0 on failure. Must be called on the CPU thread.
+size_t SaveToReusedBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
 void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
+// Loads a state saved by SaveToReusedBuffer(). Unlike LoadFromBuffer(), this is allowed during
+// NetPlay, as it is used to roll back. Must be called on the CPU thread.
+void LoadFromReusedBuffer(Core::System& system, std::span<const u8> state);
 
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
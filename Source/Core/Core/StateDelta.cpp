@@ -0,0 +1,237 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/StateDelta.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "Common/Hash.h"
+
+namespace State
+{
+namespace
+{
+enum class DeltaOpType : u32
+{
+  // Copy `length` bytes starting at `offset` in the keyframe.
+  Copy = 0,
+  // `length` bytes of state data follow the op.
+  Literal = 1,
+};
+
+struct DeltaHeader
+{
+  u64 state_size;
+  u64 keyframe_size;
+};
+static_assert(sizeof(DeltaHeader) == 16);
+static_assert(std::is_trivially_copyable_v<DeltaHeader>);
+
+struct DeltaOp
+{
+  DeltaOpType type;
+  u32 reserved;
+  u64 offset;
+  u64 length;
+};
+static_assert(sizeof(DeltaOp) == 24);
+static_assert(std::is_trivially_copyable_v<DeltaOp>);
+
+// How much larger than its keyframe a state may be. Only a few parts of a state change in size,
+// like the texture cache, so anything beyond this comes from a corrupted delta. Checking this
+// avoids allocating whatever size such a delta claims.
+constexpr u64 MAX_STATE_GROWTH = 256 * 1024 * 1024;
+
+u64 HashPage(const u8* page)
+{
+  return Common::GetHash64(page, static_cast<u32>(DELTA_PAGE_SIZE), 0);
+}
+
+template <typename T>
+void Append(std::vector<u8>* out, const T& value)
+{
+  const u8* const bytes = reinterpret_cast<const u8*>(&value);
+  out->insert(out->end(), bytes, bytes + sizeof(T));
+}
+
+// Merges adjacent ops of the same type before appending them to the delta.
+class DeltaWriter
+{
+public:
+  DeltaWriter(std::span<const u8> state, std::vector<u8>* out) : m_state(state), m_out(out) {}
+
+  void Copy(u64 keyframe_offset, u64 length)
+  {
+    if (m_pending.length != 0 && m_pending.type == DeltaOpType::Copy &&
+        m_pending.offset + m_pending.length == keyframe_offset)
+    {
+      m_pending.length += length;
+      return;
+    }
+
+    Flush();
+    m_pending = {DeltaOpType::Copy, 0, keyframe_offset, length};
+  }
+
+  void Literal(u64 state_offset, u64 length)
+  {
+    if (m_pending.length != 0 && m_pending.type == DeltaOpType::Literal &&
+        m_pending.offset + m_pending.length == state_offset)
+    {
+      m_pending.length += length;
+      return;
+    }
+
+    Flush();
+    m_pending = {DeltaOpType::Literal, 0, state_offset, length};
+  }
+
+  void Flush()
+  {
+    if (m_pending.length == 0)
+      return;
+
+    if (m_pending.type == DeltaOpType::Literal)
+    {
+      // The offset of literals is only needed while merging, it is implied when decoding.
+      const u64 state_offset = m_pending.offset;
+      m_pending.offset = 0;
+      Append(m_out, m_pending);
+      const u8* const data = m_state.data() + state_offset;
+      m_out->insert(m_out->end(), data, data + m_pending.length);
+    }
+    else
+    {
+      Append(m_out, m_pending);
+    }
+
+    m_pending = {};
+  }
+
+private:
+  std::span<const u8> m_state;
+  std::vector<u8>* m_out;
+  DeltaOp m_pending{};
+};
+}  // namespace
+
+void StateDeltaEncoder::SetKeyframe(Common::UniqueBuffer<u8> keyframe)
+{
+  m_keyframe = std::move(keyframe);
+  m_page_index.clear();
+  m_page_index.reserve(m_keyframe.size() / DELTA_PAGE_SIZE);
+
+  for (u64 offset = 0; offset + DELTA_PAGE_SIZE <= m_keyframe.size(); offset += DELTA_PAGE_SIZE)
+    m_page_index.try_emplace(HashPage(m_keyframe.data() + offset), offset);
+}
+
+void StateDeltaEncoder::ClearKeyframe()
+{
+  m_keyframe.reset();
+  m_page_index.clear();
+}
+
+size_t StateDeltaEncoder::Encode(std::span<const u8> state, std::vector<u8>* delta) const
+{
+  delta->clear();
+  Append(delta, DeltaHeader{state.size(), m_keyframe.size()});
+
+  DeltaWriter writer(state, delta);
+  size_t literal_bytes = 0;
+
+  // Difference between the state offset and the keyframe offset of the last matching page. Data
+  // which moved relative to the keyframe usually moved as a whole, so checking the same shift first
+  // avoids most hash lookups.
+  s64 shift = 0;
+
+  for (u64 offset = 0; offset < state.size(); offset += DELTA_PAGE_SIZE)
+  {
+    const u64 length = std::min<u64>(DELTA_PAGE_SIZE, state.size() - offset);
+    const u8* const page = state.data() + offset;
+
+    const s64 expected = static_cast<s64>(offset) - shift;
+    if (expected >= 0 && static_cast<u64>(expected) + length <= m_keyframe.size() &&
+        std::memcmp(page, m_keyframe.data() + expected, length) == 0)
+    {
+      writer.Copy(static_cast<u64>(expected), length);
+      continue;
+    }
+
+    if (length == DELTA_PAGE_SIZE)
+    {
+      const auto it = m_page_index.find(HashPage(page));
+      if (it != m_page_index.end() &&
+          std::memcmp(page, m_keyframe.data() + it->second, DELTA_PAGE_SIZE) == 0)
+      {
+        writer.Copy(it->second, DELTA_PAGE_SIZE);
+        shift = static_cast<s64>(offset) - static_cast<s64>(it->second);
+        continue;
+      }
+    }
+
+    writer.Literal(offset, length);
+    literal_bytes += length;
+  }
+
+  writer.Flush();
+  return literal_bytes;
+}
+
+bool DecodeStateDelta(std::span<const u8> keyframe, std::span<const u8> delta,
+                      Common::UniqueBuffer<u8>& state)
+{
+  DeltaHeader header;
+  if (delta.size() < sizeof(header))
+    return false;
+  std::memcpy(&header, delta.data(), sizeof(header));
+  if (header.keyframe_size != keyframe.size() ||
+      header.state_size > keyframe.size() + MAX_STATE_GROWTH)
+  {
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> buffer(header.state_size);
+  u64 read_offset = sizeof(header);
+  u64 write_offset = 0;
+
+  while (read_offset < delta.size())
+  {
+    DeltaOp op;
+    if (delta.size() - read_offset < sizeof(op))
+      return false;
+    std::memcpy(&op, delta.data() + read_offset, sizeof(op));
+    read_offset += sizeof(op);
+
+    if (op.length > header.state_size - write_offset)
+      return false;
+
+    switch (op.type)
+    {
+    case DeltaOpType::Copy:
+      if (op.offset > keyframe.size() || op.length > keyframe.size() - op.offset)
+        return false;
+      std::memcpy(buffer.data() + write_offset, keyframe.data() + op.offset, op.length);
+      break;
+    case DeltaOpType::Literal:
+      if (op.length > delta.size() - read_offset)
+        return false;
+      std::memcpy(buffer.data() + write_offset, delta.data() + read_offset, op.length);
+      read_offset += op.length;
+      break;
+    default:
+      return false;
+    }
+
+    write_offset += op.length;
+  }
+
+  if (write_offset != header.state_size)
+    return false;
+
+  state.swap(buffer);
+  return true;
+}
+}  // namespace State
@@ -0,0 +1,47 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Delta encoding of savestates against a previously saved keyframe state.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// Granularity at which states are compared. Large arrays such as MEM1, MEM2 and ARAM are aligned to
+// this size within the state, so unchanged pages of emulated memory line up with the keyframe.
+constexpr size_t DELTA_PAGE_SIZE = PointerWrap::PAGE_ALIGNMENT;
+
+// Encodes states as a list of pages copied from a keyframe state plus the bytes which differ from
+// it. Only the pages which were written to since the keyframe end up in the delta.
+class StateDeltaEncoder
+{
+public:
+  void SetKeyframe(Common::UniqueBuffer<u8> keyframe);
+  void ClearKeyframe();
+
+  bool HasKeyframe() const { return !m_keyframe.empty(); }
+  std::span<const u8> GetKeyframe() const { return {m_keyframe.data(), m_keyframe.size()}; }
+
+  // Returns the number of bytes of state that had to be stored literally.
+  size_t Encode(std::span<const u8> state, std::vector<u8>* delta) const;
+
+private:
+  Common::UniqueBuffer<u8> m_keyframe;
+
+  // Page hash -> offset of the first keyframe page with that hash.
+  std::unordered_map<u64, u64> m_page_index;
+};
+
+// Reconstructs a state from a delta created by StateDeltaEncoder::Encode() with the same keyframe.
+bool DecodeStateDelta(std::span<const u8> keyframe, std::span<const u8> delta,
+                      Common::UniqueBuffer<u8>& state);
+}  // namespace State
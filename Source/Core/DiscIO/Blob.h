@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -87,6 +88,11 @@ public:
     return Common::FromBigEndian(temp);
   }
 
+  // Returns the given range of the data as memory owned by the reader, or an empty span if the
+  // reader can't hand out its data without copying it. The span stays valid until the reader is
+  // destroyed. Like Read, this must not be called from multiple threads.
+  virtual std::span<const u8> GetSpan(u64 offset, u64 size) { return {}; }
+
   virtual bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const
   {
     return false;
@@ -9,6 +9,7 @@
 #include <cstring>
 #include <functional>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -63,6 +64,18 @@ bool ExportData(const Volume& volume, const Partition& partition, u64 offset, u6
     // Limit read size to 128 MB
     const size_t read_size = static_cast<size_t>(std::min<u64>(size, 0x08000000));
 
+    // Write straight out of the blob reader's memory when it lets us, skipping the copy.
+    const std::span<const u8> span = volume.GetSpan(offset, read_size, partition);
+    if (span.size() == read_size)
+    {
+      if (!f.WriteBytes(span.data(), read_size))
+        return false;
+
+      size -= read_size;
+      offset += read_size;
+      continue;
+    }
+
     std::vector<u8> buffer(read_size);
 
     if (!volume.Read(offset, read_size, buffer.data(), partition))
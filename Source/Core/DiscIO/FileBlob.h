@@ -5,10 +5,12 @@
 
 #include <cstdio>
 #include <memory>
+#include <span>
 #include <string>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -31,11 +33,13 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  std::span<const u8> GetSpan(u64 offset, u64 size) override;
 
 private:
   PlainFileReader(File::IOFile file);
 
   File::IOFile m_file;
+  File::MappedFile m_mapping;
   u64 m_size;
 };
 
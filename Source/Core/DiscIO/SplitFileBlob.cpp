@@ -3,7 +3,9 @@
 
 #include "DiscIO/SplitFileBlob.h"
 
+#include <cstring>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -11,9 +13,11 @@
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 
 namespace DiscIO
 {
@@ -21,8 +25,13 @@ SplitPlainFileReader::SplitPlainFileReader(std::vector<SingleFile> files)
     : m_files(std::move(files))
 {
   m_size = 0;
-  for (const auto& f : m_files)
+  const bool map_files = Config::Get(Config::MAIN_MAP_DISC_IMAGES);
+  for (auto& f : m_files)
+  {
     m_size += f.size;
+    if (map_files)
+      f.mapping.Map(f.file);
+  }
 }
 
 std::unique_ptr<SplitPlainFileReader> SplitPlainFileReader::Create(std::string_view first_file_path)
@@ -82,7 +91,12 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
-      if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
+      if (file.mapping.IsMapped())
+      {
+        file.mapping.AdviseRead(seek_offset, current_read);
+        std::memcpy(out, file.mapping.GetSpan().data() + seek_offset, current_read);
+      }
+      else if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
       {
         f.ClearError();
         return false;
@@ -98,4 +112,22 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 
   return rest == 0;
 }
+
+std::span<const u8> SplitPlainFileReader::GetSpan(u64 offset, u64 size)
+{
+  for (auto& file : m_files)
+  {
+    if (offset >= file.offset && offset < file.offset + file.size)
+    {
+      const u64 file_offset = offset - file.offset;
+      if (!file.mapping.IsMapped() || size > file.size - file_offset)
+        return {};
+
+      file.mapping.AdviseRead(file_offset, size);
+      return file.mapping.GetSpan().subspan(file_offset, size);
+    }
+  }
+
+  return {};
+}
 }  // namespace DiscIO
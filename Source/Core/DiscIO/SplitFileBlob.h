@@ -5,12 +5,14 @@
 
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -33,6 +35,8 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  // Only works for ranges that don't cross from one file into the next.
+  std::span<const u8> GetSpan(u64 offset, u64 size) override;
 
 private:
   struct SingleFile
@@ -40,6 +44,7 @@ private:
     File::IOFile file;
     u64 offset;
     u64 size;
+    File::MappedFile mapping{};
   };
 
   SplitPlainFileReader(std::vector<SingleFile> m_files);
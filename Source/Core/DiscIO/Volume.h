@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,13 @@ public:
   Volume() {}
   virtual ~Volume() {}
   virtual bool Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const = 0;
+  // Like Read, but returns memory owned by the blob reader instead of copying into a buffer.
+  // Returns an empty span if the data can't be accessed like that, for instance because it
+  // has to be decrypted first, in which case the caller has to fall back to Read.
+  virtual std::span<const u8> GetSpan(u64 offset, u64 length, const Partition& partition) const
+  {
+    return {};
+  }
   template <typename T>
   std::optional<T> ReadSwapped(u64 offset, const Partition& partition) const
   {
@@ -82,7 +90,7 @@ public:
   virtual std::vector<u8> GetContent(u16 index) const { return {}; }
   virtual std::vector<u64> GetContentOffsets() const { return {}; }
   virtual bool CheckContentIntegrity(const IOS::ES::Content& content,
-                                     const std::vector<u8>& encrypted_data,
+                                     std::span<const u8> encrypted_data,
                                      const IOS::ES::TicketReader& ticket) const
   {
     return false;
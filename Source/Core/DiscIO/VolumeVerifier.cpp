@@ -4,13 +4,20 @@
 #include "DiscIO/VolumeVerifier.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <mbedtls/md5.h>
 #include <mz.h>
@@ -361,7 +368,10 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
   return {Status::Unknown, Common::GetStringT("Unknown disc")};
 }
 
-constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+// The size of a Wii group, so that discs without groups also get large sequential reads
+constexpr u64 DEFAULT_READ_SIZE = 0x200000;
+// How much data that has been read can be waiting for the worker threads at once
+constexpr u64 MAX_BYTES_IN_FLIGHT = 0x4000000;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -377,7 +387,14 @@ VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
 
 VolumeVerifier::~VolumeVerifier()
 {
-  WaitForAsyncOperations();
+  // Skip whatever is still queued up, since nobody is going to look at the result
+  for (Common::AsyncWorkThreadSP* worker :
+       {&m_crc32_worker, &m_md5_worker, &m_sha1_worker, &m_check_worker})
+  {
+    worker->Cancel();
+    worker->Shutdown();
+  }
+  m_last_chunk.reset();
 }
 
 Hashes<bool> VolumeVerifier::GetDefaultHashesToCalculate()
@@ -1075,43 +1092,149 @@ void VolumeVerifier::SetUpHashing()
   {
     m_sha1_context = Common::SHA1::CreateContext();
   }
+
+  if (m_hashes_to_calculate.crc32)
+    m_crc32_worker.Reset("Verifier CRC32");
+  if (m_hashes_to_calculate.md5)
+    m_md5_worker.Reset("Verifier MD5");
+  if (m_hashes_to_calculate.sha1)
+    m_sha1_worker.Reset("Verifier SHA1");
+  m_check_worker.Reset("Verifier Checks");
+
+  if (!m_groups.empty())
+  {
+    // Blocks get checked on several threads at once, so the lazily loaded partition keys and H3
+    // tables they use must not be loaded for the first time by one of those threads.
+    std::optional<Partition> last_partition;
+    for (const GroupToVerify& group : m_groups)
+    {
+      if (group.partition != last_partition)
+        m_volume.CheckBlockIntegrity(group.block_index_start, group.partition);
+      last_partition = group.partition;
+    }
+
+    // Leave a thread each for reading and for the hashes
+    const u32 hash_threads = m_hashes_to_calculate.crc32 + m_hashes_to_calculate.md5 +
+                             m_hashes_to_calculate.sha1;
+    const u32 threads = std::max<u32>(1, std::thread::hardware_concurrency());
+    const u32 check_threads = std::max<u32>(1, threads - std::min(threads, hash_threads + 1));
+    m_block_workers.Start("Verifier Blocks", check_threads - 1);
+  }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  m_crc32_worker.WaitForCompletion();
+  m_md5_worker.WaitForCompletion();
+  m_sha1_worker.WaitForCompletion();
+  m_check_worker.WaitForCompletion();
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+VolumeVerifier::ChunkPtr VolumeVerifier::ReadChunk(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  const TimePoint start_time = Clock::now();
 
-  const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
-  if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
-  bytes_to_read -= bytes_to_copy;
-
-  if (bytes_to_read > 0)
+  // If the blob reader can hand out the data as it is, there's no need to read it anywhere
+  std::vector<u8> buffer;
+  std::span<const u8> data = m_volume.GetSpan(m_progress, bytes_to_read, PARTITION_NONE);
+  u64 bytes_to_copy = 0;
+  if (data.size() != bytes_to_read)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
-                       PARTITION_NONE))
+    buffer.resize(bytes_to_read);
+
+    if (m_last_chunk)
     {
-      return false;
+      bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
+      const std::span<const u8> last_data = m_last_chunk->data;
+      std::memcpy(buffer.data(), last_data.data() + last_data.size() - m_excess_bytes,
+                  bytes_to_copy);
     }
   }
+  m_last_chunk.reset();
 
-  WaitForAsyncOperations();
-  m_data = std::move(data);
-  return true;
+  {
+    std::unique_lock lk(m_chunks_lock);
+    const TimePoint wait_start_time = Clock::now();
+    m_chunk_released.wait(lk, [this, bytes_to_read] {
+      return m_bytes_in_flight == 0 || m_bytes_in_flight + bytes_to_read <= MAX_BYTES_IN_FLIGHT;
+    });
+    m_bytes_in_flight += bytes_to_read;
+
+    const TimePoint now = Clock::now();
+    m_pipeline_stats.waiting += now - wait_start_time;
+    m_pipeline_stats.reading += wait_start_time - start_time;
+  }
+
+  std::shared_ptr<Chunk> chunk(new Chunk{std::move(buffer), {}},
+                               [this](Chunk* released_chunk) { ReleaseChunk(released_chunk); });
+  chunk->data = chunk->buffer.empty() ? data : std::span<const u8>(chunk->buffer);
+
+  if (!chunk->buffer.empty() && bytes_to_read > bytes_to_copy)
+  {
+    const TimePoint read_start_time = Clock::now();
+    const bool success =
+        m_volume.Read(m_progress + bytes_to_copy, bytes_to_read - bytes_to_copy,
+                      chunk->buffer.data() + bytes_to_copy, PARTITION_NONE);
+
+    std::lock_guard lk(m_chunks_lock);
+    m_pipeline_stats.reading += Clock::now() - read_start_time;
+    if (!success)
+      return nullptr;
+  }
+
+  return chunk;
+}
+
+void VolumeVerifier::ReleaseChunk(Chunk* chunk)
+{
+  {
+    std::lock_guard lk(m_chunks_lock);
+    m_bytes_in_flight -= chunk->data.size();
+  }
+  m_chunk_released.notify_one();
+
+  delete chunk;
+}
+
+void VolumeVerifier::VerifyGroup(const GroupToVerify& group, const Chunk* chunk)
+{
+  const u32 blocks = static_cast<u32>(group.block_index_end - group.block_index_start);
+
+  // Decrypting and hashing the blocks is where the time goes, and they don't depend on each other
+  std::vector<u8> blocks_valid(blocks, false);
+  if (chunk)
+  {
+    m_block_workers.ParallelFor(blocks, [&](u32, u32 i) {
+      blocks_valid[i] =
+          m_volume.CheckBlockIntegrity(group.block_index_start + i,
+                                       chunk->data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                       group.partition);
+    });
+  }
+
+  for (u32 i = 0; i < blocks; ++i)
+  {
+    const u64 block_offset = group.offset + i * VolumeWii::BLOCK_TOTAL_SIZE;
+
+    if (blocks_valid[i])
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        m_unused_block_errors[group.partition]++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        m_block_errors[group.partition]++;
+      }
+    }
+  }
 }
 
 void VolumeVerifier::Process()
@@ -1185,7 +1308,8 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  const ChunkPtr chunk = is_data_needed ? ReadChunk(bytes_to_read) : nullptr;
+  const bool read_failed = is_data_needed && !chunk;
 
   if (read_failed)
   {
@@ -1196,37 +1320,38 @@ void VolumeVerifier::Process()
   }
 
   m_excess_bytes = excess_bytes;
+  m_last_chunk = excess_bytes != 0 ? chunk : nullptr;
   const u64 byte_increment = bytes_to_read - excess_bytes;
 
   if (m_calculating_any_hash)
   {
     if (m_hashes_to_calculate.crc32)
     {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
+      m_crc32_worker.Push([this, chunk, byte_increment] {
+        m_crc32_context = Common::UpdateCRC32(m_crc32_context, chunk->data.data(),
                                               static_cast<size_t>(byte_increment));
       });
     }
 
     if (m_hashes_to_calculate.md5)
     {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
+      m_md5_worker.Push([this, chunk, byte_increment] {
+        mbedtls_md5_update_ret(&m_md5_context, chunk->data.data(), byte_increment);
       });
     }
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
+      m_sha1_worker.Push([this, chunk, byte_increment] {
+        m_sha1_context->Update(chunk->data.data(), byte_increment);
       });
     }
   }
 
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
+    m_check_worker.Push([this, chunk, content] {
+      if (!chunk || !m_volume.CheckContentIntegrity(content, chunk->data, m_ticket))
       {
         AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
       }
@@ -1237,35 +1362,8 @@ void VolumeVerifier::Process()
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
+    m_check_worker.Push([this, chunk, group_index = m_group_index] {
+      VerifyGroup(m_groups[group_index], chunk.get());
     });
 
     m_group_index++;
@@ -1284,6 +1382,12 @@ u64 VolumeVerifier::GetTotalBytes() const
   return m_max_progress;
 }
 
+VolumeVerifier::PipelineStats VolumeVerifier::GetPipelineStats() const
+{
+  std::lock_guard lk(m_chunks_lock);
+  return m_pipeline_stats;
+}
+
 void VolumeVerifier::Finish()
 {
   if (m_done)
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -14,6 +17,8 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/ForkJoinPool.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -27,7 +32,8 @@
 // verifier.Finish();
 // auto result = verifier.GetResult();
 //
-// Start, Process and Finish may take some time to run.
+// Start, Process and Finish may take some time to run. Process only reads the data, hands it
+// off to worker threads for hashing and integrity checks, and returns.
 //
 // GetResult() can be called before the processing is finished, but the result will be incomplete.
 
@@ -124,6 +130,15 @@ public:
     RedumpVerifier::Result redump;
   };
 
+  // Where Process has spent its time, which tells whether reading or the worker threads are
+  // what limits how fast verification goes.
+  struct PipelineStats
+  {
+    DT reading{};
+    // Waiting for the worker threads to catch up
+    DT waiting{};
+  };
+
   VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
   ~VolumeVerifier();
 
@@ -134,6 +149,7 @@ public:
   u64 GetTotalBytes() const;
   void Finish();
   const Result& GetResult() const;
+  PipelineStats GetPipelineStats() const;
 
 private:
   struct GroupToVerify
@@ -144,6 +160,15 @@ private:
     size_t block_index_end;
   };
 
+  // The data read by one call of Process, shared by all of the worker threads that need it.
+  struct Chunk
+  {
+    std::vector<u8> buffer;
+    // Points either into buffer or into memory owned by the volume's blob reader
+    std::span<const u8> data;
+  };
+  using ChunkPtr = std::shared_ptr<const Chunk>;
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -156,8 +181,10 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void WaitForAsyncOperations();
+  ChunkPtr ReadChunk(u64 bytes_to_read);
+  void ReleaseChunk(Chunk* chunk);
+  void VerifyGroup(const GroupToVerify& group, const Chunk* chunk);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -179,13 +206,24 @@ private:
   mbedtls_md5_context m_md5_context{};
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
+  // Chunks that have been read but not yet released by every worker thread use up this budget,
+  // which keeps reading from getting arbitrarily far ahead of the rest.
+  mutable std::mutex m_chunks_lock;
+  std::condition_variable m_chunk_released;
+  u64 m_bytes_in_flight = 0;
+  PipelineStats m_pipeline_stats;
+
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  // Only kept around when the next chunk starts with the last m_excess_bytes of it
+  ChunkPtr m_last_chunk;
+
+  // None of the hashes can be split up, so each gets a thread of its own. Integrity checks run
+  // on m_check_worker, which spreads the blocks of each group over m_block_workers.
+  Common::AsyncWorkThreadSP m_crc32_worker;
+  Common::AsyncWorkThreadSP m_md5_worker;
+  Common::AsyncWorkThreadSP m_sha1_worker;
+  Common::ForkJoinPool m_block_workers;
+  Common::AsyncWorkThreadSP m_check_worker;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
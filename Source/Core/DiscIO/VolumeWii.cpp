@@ -7,10 +7,12 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
-#include <future>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -21,6 +23,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/ForkJoinPool.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
 
@@ -35,6 +38,34 @@
 
 namespace DiscIO
 {
+namespace
+{
+// Calls func for every cluster index below count, spread over a pool of threads which is shared
+// by every volume. Whoever finds the pool busy runs their clusters on their own thread instead,
+// since the pool is keeping the CPU busy already.
+void ForEachBlock(u32 count, const std::function<void(u32 block)>& func)
+{
+  static Common::ForkJoinPool s_pool;
+  static std::mutex s_pool_lock;
+  static std::once_flag s_pool_started;
+
+  std::call_once(s_pool_started, [] {
+    const u32 threads = std::max<u32>(1, std::thread::hardware_concurrency());
+    s_pool.Start("Wii Crypto", std::min(threads, VolumeWii::BLOCKS_PER_GROUP) - 1);
+  });
+
+  std::unique_lock lk(s_pool_lock, std::try_to_lock);
+  if (!lk.owns_lock())
+  {
+    for (u32 i = 0; i < count; ++i)
+      func(i);
+    return;
+  }
+
+  s_pool.ParallelFor(count, [&func](u32, u32 block) { func(block); });
+}
+}  // namespace
+
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
     : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE),
       m_last_decrypted_block(UINT64_MAX)
@@ -200,6 +231,31 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
     u64 block_offset_on_disc = partition_data_offset + offset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
 
+    // Whole clusters are read all at once and decrypted in parallel, straight into the buffer
+    if (m_has_encryption && data_offset_in_block == 0 && length >= 2 * BLOCK_DATA_SIZE)
+    {
+      const u32 blocks =
+          static_cast<u32>(std::min<u64>(length / BLOCK_DATA_SIZE, BLOCKS_PER_GROUP));
+      const u64 read_size = blocks * BLOCK_TOTAL_SIZE;
+
+      std::span<const u8> encrypted_data = m_reader->GetSpan(block_offset_on_disc, read_size);
+      if (encrypted_data.size() != read_size)
+      {
+        m_encrypted_blocks.resize(read_size);
+        if (!m_reader->Read(block_offset_on_disc, read_size, m_encrypted_blocks.data()))
+          return false;
+        encrypted_data = m_encrypted_blocks;
+      }
+
+      DecryptBlocks(encrypted_data.data(), buffer, blocks, aes_context);
+
+      const u64 copy_size = blocks * BLOCK_DATA_SIZE;
+      length -= copy_size;
+      buffer += copy_size;
+      offset += copy_size;
+      continue;
+    }
+
     if (m_last_decrypted_block != block_offset_on_disc)
     {
       if (m_has_encryption)
@@ -238,6 +294,22 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   return true;
 }
 
+std::span<const u8> VolumeWii::GetSpan(u64 offset, u64 length, const Partition& partition) const
+{
+  if (partition == PARTITION_NONE)
+    return m_reader->GetSpan(offset, length);
+
+  // Partition data interleaved with hashes, let alone encrypted, is never stored as it is read.
+  if (m_has_hashes)
+    return {};
+
+  auto it = m_partitions.find(partition);
+  if (it == m_partitions.end())
+    return {};
+
+  return m_reader->GetSpan(partition.offset + *it->second.data_offset + offset, length);
+}
+
 bool VolumeWii::HasWiiHashes() const
 {
   return m_has_hashes;
@@ -510,71 +582,50 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
                           HashBlock out[BLOCKS_PER_GROUP],
                           const std::function<bool(size_t block)>& read_function)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
-  bool success = true;
-
-  for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
+  if (read_function)
   {
-    if (read_function && success)
-      success = read_function(i);
-
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i] {
-      const size_t h1_base = Common::AlignDown(i, 8);
-
-      if (success)
-      {
-        // H0 hashes
-        for (size_t j = 0; j < 31; ++j)
-          out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
-
-        // H0 padding
-        out[i].padding_0 = {};
-
-        // H1 hash
-        out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
-      }
+    for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
+    {
+      if (!read_function(i))
+        return false;
+    }
+  }
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
+  ForEachBlock(BLOCKS_PER_GROUP, [&in, &out](u32 i) {
+    const size_t h1_base = Common::AlignDown(i, 8);
 
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
+    // H0 hashes
+    for (size_t j = 0; j < 31; ++j)
+      out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
 
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
+    // H0 padding
+    out[i].padding_0 = {};
 
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
+    // H1 hash
+    out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
+  });
 
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
+  for (size_t h1_base = 0; h1_base < BLOCKS_PER_GROUP; h1_base += 8)
+  {
+    // H1 padding
+    out[h1_base].padding_1 = {};
 
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
+    // H1 copies
+    for (size_t j = 1; j < 8; ++j)
+      out[h1_base + j].h1 = out[h1_base].h1;
 
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
-    });
+    // H2 hash
+    out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[h1_base].h1);
   }
 
-  // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  // H2 padding
+  out[0].padding_2 = {};
+
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
 
-  return success;
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
@@ -609,34 +660,17 @@ bool VolumeWii::EncryptGroup(
   if (hash_exception_callback)
     hash_exception_callback(unencrypted_hashes.data());
 
-  const unsigned int threads =
-      std::min(BLOCKS_PER_GROUP, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
-
-  std::vector<std::future<void>> encryption_futures(threads);
-
   auto aes_context = Common::AES::CreateContextEncrypt(key.data());
 
-  for (size_t i = 0; i < threads; ++i)
-  {
-    encryption_futures[i] = std::async(
-        std::launch::async,
-        [&unencrypted_data, &unencrypted_hashes, &aes_context, &out](size_t start, size_t end) {
-          for (size_t j = start; j < end; ++j)
-          {
-            u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
-
-            aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[j]), out_ptr,
-                                     BLOCK_HEADER_SIZE);
+  ForEachBlock(BLOCKS_PER_GROUP, [&](u32 i) {
+    u8* out_ptr = out->data() + i * BLOCK_TOTAL_SIZE;
 
-            aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[j].data(),
-                               out_ptr + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE);
-          }
-        },
-        i * BLOCKS_PER_GROUP / threads, (i + 1) * BLOCKS_PER_GROUP / threads);
-  }
+    aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[i]), out_ptr,
+                             BLOCK_HEADER_SIZE);
 
-  for (std::future<void>& future : encryption_futures)
-    future.get();
+    aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[i].data(), out_ptr + BLOCK_HEADER_SIZE,
+                       BLOCK_DATA_SIZE);
+  });
 
   return true;
 }
@@ -651,4 +685,11 @@ void VolumeWii::DecryptBlockData(const u8* in, u8* out, Common::AES::Context* ae
   aes_context->Crypt(&in[0x3d0], &in[sizeof(HashBlock)], out, BLOCK_DATA_SIZE);
 }
 
+void VolumeWii::DecryptBlocks(const u8* in, u8* out, u32 count, Common::AES::Context* aes_context)
+{
+  ForEachBlock(count, [in, out, aes_context](u32 i) {
+    DecryptBlockData(in + i * BLOCK_TOTAL_SIZE, out + i * BLOCK_DATA_SIZE, aes_context);
+  });
+}
+
 }  // namespace DiscIO
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -60,6 +61,7 @@ public:
   VolumeWii(std::unique_ptr<BlobReader> reader);
   ~VolumeWii() override;
   bool Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const override;
+  std::span<const u8> GetSpan(u64 offset, u64 length, const Partition& partition) const override;
   bool HasWiiHashes() const override;
   bool HasWiiEncryption() const override;
   std::vector<Partition> GetPartitions() const override;
@@ -94,7 +96,8 @@ public:
 
   // The in parameter can either contain all the data to begin with,
   // or read_function can write data into the in parameter when called.
-  // The latter lets reading run in parallel with hashing.
+  // read_function is called for every block before any hashing starts, and the hashing is then
+  // spread over multiple threads.
   // This function returns false iff read_function returns false.
   static bool HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GROUP],
                         HashBlock out[BLOCKS_PER_GROUP],
@@ -108,6 +111,9 @@ public:
 
   static void DecryptBlockHashes(const u8* in, HashBlock* out, Common::AES::Context* aes_context);
   static void DecryptBlockData(const u8* in, u8* out, Common::AES::Context* aes_context);
+  // Decrypts the data of count consecutive blocks from in into count * BLOCK_DATA_SIZE bytes of
+  // out, spread over multiple threads.
+  static void DecryptBlocks(const u8* in, u8* out, u32 count, Common::AES::Context* aes_context);
 
 protected:
   u32 GetOffsetShift() const override { return 2; }
@@ -133,6 +139,7 @@ private:
 
   mutable u64 m_last_decrypted_block;
   mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE]{};
+  mutable std::vector<u8> m_encrypted_blocks;
 };
 
 }  // namespace DiscIO
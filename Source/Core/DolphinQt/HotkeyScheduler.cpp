@@ -30,6 +30,7 @@
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/USB/Bluetooth/BTBase.h"
 #include "Core/IOS/USB/Bluetooth/BTReal.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/WiiUtils.h"
@@ -666,6 +667,10 @@ void HotkeyScheduler::Run()
 
     if (IsHotkey(HK_SAVE_STATE_FILE))
       emit StateSaveFile();
+
+    // Steps back once per emulated field for as long as the hotkey is held.
+    if (IsHotkey(HK_REWIND, true))
+      Rewind::RequestStepBack();
   }
 }
 
@@ -181,6 +181,15 @@ void AudioPane::CreateWidgets()
   // Set initial value display
   audio_buffer_size_label->setText(tr("%1 ms").arg(audio_buffer_size->value()));
 
+  QStringList resampling_options{tr("Lowest (Hermite)"), tr("Low (8 Taps)"),
+                                 tr("High (16 Taps)"), tr("Highest (32 Taps)")};
+  m_resampling_quality_combo =
+      new ConfigChoice(resampling_options, Config::MAIN_AUDIO_RESAMPLING_QUALITY);
+
+  auto* resampling_layout = new QHBoxLayout;
+  resampling_layout->addWidget(new QLabel(tr("Resampling Quality:")));
+  resampling_layout->addWidget(m_resampling_quality_combo);
+
   m_audio_fill_gaps = new ConfigBool(tr("Fill Audio Gaps"), Config::MAIN_AUDIO_FILL_GAPS);
 
   m_speed_up_mute_enable = new ConfigBool(tr("Mute When Disabling Speed Limit"),
@@ -193,9 +202,10 @@ void AudioPane::CreateWidgets()
   buffer_layout->addWidget(audio_buffer_size_label);
 
   playback_layout->addLayout(buffer_layout, 0, 0);
-  playback_layout->addWidget(m_audio_fill_gaps, 1, 0);
-  playback_layout->addWidget(m_speed_up_mute_enable, 2, 0);
-  playback_layout->setRowStretch(3, 1);
+  playback_layout->addLayout(resampling_layout, 1, 0);
+  playback_layout->addWidget(m_audio_fill_gaps, 2, 0);
+  playback_layout->addWidget(m_speed_up_mute_enable, 3, 0);
+  playback_layout->setRowStretch(4, 1);
   playback_box->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
 
   auto* const main_vbox_layout = new QVBoxLayout;
@@ -316,6 +326,10 @@ void AudioPane::AddDescriptions()
   static const char TR_VOLUME_DESCRIPTION[] =
       QT_TR_NOOP("Adjusts audio output volume.<br><br><dolphin_emphasis>If unsure, leave this at "
                  "100%.</dolphin_emphasis>");
+  static const char TR_RESAMPLING_QUALITY_DESCRIPTION[] = QT_TR_NOOP(
+      "Selects how audio is converted to the sample rate of the output device. Higher settings "
+      "sound cleaner but take more CPU time on the audio thread.<br><br><dolphin_emphasis>If "
+      "unsure, select High.</dolphin_emphasis>");
   static const char TR_FILL_AUDIO_GAPS_DESCRIPTION[] = QT_TR_NOOP(
       "Repeat existing audio during lag spikes to prevent stuttering.<br><br><dolphin_emphasis>If "
       "unsure, leave this checked.</dolphin_emphasis>");
@@ -357,6 +371,9 @@ void AudioPane::AddDescriptions()
   m_speed_up_mute_enable->SetTitle(tr("Mute When Disabling Speed Limit"));
   m_speed_up_mute_enable->SetDescription(tr(TR_SPEED_UP_MUTE_DESCRIPTION));
 
+  m_resampling_quality_combo->SetTitle(tr("Resampling Quality"));
+  m_resampling_quality_combo->SetDescription(tr(TR_RESAMPLING_QUALITY_DESCRIPTION));
+
   m_audio_fill_gaps->SetTitle(tr("Fill Audio Gaps"));
   m_audio_fill_gaps->SetDescription(tr(TR_FILL_AUDIO_GAPS_DESCRIPTION));
 }
@@ -65,6 +65,7 @@ private:
 #endif
 
   // Misc Settings
+  ConfigChoice* m_resampling_quality_combo;
   ConfigBool* m_audio_fill_gaps;
   ConfigBool* m_speed_up_mute_enable;
 };
@@ -0,0 +1,169 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/BenchmarkCommand.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace DolphinTool
+{
+// Calls func until the given time has passed, and returns how many bytes per second it got
+// through. func returns how many bytes it went through, or std::nullopt if it failed.
+static std::optional<double> MeasureThroughput(DT duration,
+                                               const std::function<std::optional<u64>()>& func)
+{
+  const TimePoint start = Clock::now();
+  TimePoint now = start;
+  u64 total_bytes = 0;
+  while (now - start < duration)
+  {
+    const std::optional<u64> bytes = func();
+    if (!bytes)
+      return std::nullopt;
+
+    total_bytes += *bytes;
+    now = Clock::now();
+  }
+
+  return total_bytes / std::chrono::duration_cast<DT_s>(now - start).count();
+}
+
+static void PrintThroughput(std::string_view name, double bytes_per_second)
+{
+  fmt::print(std::cout, "{}: {:.1f} MB/s\n", name, bytes_per_second / 1000000);
+}
+
+int BenchmarkCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: benchmark [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to a Wii disc image FILE with an encrypted game partition.")
+      .metavar("FILE");
+
+  parser.add_option("-s", "--seconds")
+      .type("int")
+      .action("store")
+      .help("Optional. How long to run each of the tests for, in seconds. Default is 5.")
+      .set_default(5);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  const int seconds = static_cast<int>(options.get("seconds"));
+  if (seconds <= 0)
+  {
+    fmt::print(std::cerr, "Error: The test duration must be positive\n");
+    return EXIT_FAILURE;
+  }
+  const DT duration = std::chrono::seconds(seconds);
+
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
+  if (!volume)
+  {
+    fmt::print(std::cerr, "Error: Unable to open disc image\n");
+    return EXIT_FAILURE;
+  }
+
+  const DiscIO::Partition partition = volume->GetGamePartition();
+  if (partition == DiscIO::PARTITION_NONE || !volume->HasWiiHashes() ||
+      !volume->HasWiiEncryption())
+  {
+    fmt::print(std::cerr, "Error: The disc image has no encrypted Wii game partition\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::optional<u64> data_offset =
+      volume->ReadSwappedAndShifted(partition.offset + 0x2b8, DiscIO::PARTITION_NONE);
+  const std::optional<u64> data_size =
+      volume->ReadSwappedAndShifted(partition.offset + 0x2bc, DiscIO::PARTITION_NONE);
+  const u64 groups = data_size.value_or(0) / DiscIO::VolumeWii::GROUP_TOTAL_SIZE;
+  if (!data_offset || groups == 0)
+  {
+    fmt::print(std::cerr, "Error: Unable to read the game partition header\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::unique_ptr<Common::AES::Context> aes_context =
+      Common::AES::CreateContextDecrypt(volume->GetTicket(partition).GetTitleKey().data());
+
+  // Reading and decrypting through the volume, like the emulated disc drive does
+  std::vector<u8> decrypted(DiscIO::VolumeWii::GROUP_DATA_SIZE);
+  u64 group = 0;
+  const std::optional<double> read_throughput = MeasureThroughput(duration, [&] {
+    const u64 offset = group * DiscIO::VolumeWii::GROUP_DATA_SIZE;
+    group = (group + 1) % groups;
+    return volume->Read(offset, decrypted.size(), decrypted.data(), partition) ?
+               std::optional<u64>(decrypted.size()) :
+               std::nullopt;
+  });
+  if (!read_throughput)
+  {
+    fmt::print(std::cerr, "Error: Failed to read from the disc image\n");
+    return EXIT_FAILURE;
+  }
+  PrintThroughput("Read and decrypt", *read_throughput);
+
+  // Decrypting and hashing data that is already in memory, which leaves out the disc image
+  constexpr u64 MAX_GROUPS_IN_MEMORY = 32;
+  const u64 groups_in_memory = std::min(groups, MAX_GROUPS_IN_MEMORY);
+  std::vector<u8> encrypted(groups_in_memory * DiscIO::VolumeWii::GROUP_TOTAL_SIZE);
+  if (!volume->Read(partition.offset + *data_offset, encrypted.size(), encrypted.data(),
+                    DiscIO::PARTITION_NONE))
+  {
+    fmt::print(std::cerr, "Error: Failed to read from the disc image\n");
+    return EXIT_FAILURE;
+  }
+
+  group = 0;
+  const std::optional<double> decrypt_throughput = MeasureThroughput(duration, [&] {
+    DiscIO::VolumeWii::DecryptBlocks(encrypted.data() + group * DiscIO::VolumeWii::GROUP_TOTAL_SIZE,
+                                     decrypted.data(), DiscIO::VolumeWii::BLOCKS_PER_GROUP,
+                                     aes_context.get());
+    group = (group + 1) % groups_in_memory;
+    return std::optional<u64>(decrypted.size());
+  });
+  PrintThroughput("Decrypt", *decrypt_throughput);
+
+  using BlockData = std::array<u8, DiscIO::VolumeWii::BLOCK_DATA_SIZE>;
+  std::vector<DiscIO::VolumeWii::HashBlock> hashes(DiscIO::VolumeWii::BLOCKS_PER_GROUP);
+  const std::optional<double> hash_throughput = MeasureThroughput(duration, [&] {
+    DiscIO::VolumeWii::HashGroup(reinterpret_cast<const BlockData*>(decrypted.data()),
+                                 hashes.data());
+    return std::optional<u64>(decrypted.size());
+  });
+  PrintThroughput("Hash", *hash_throughput);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -3,6 +3,8 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <string>
 #include <vector>
@@ -11,6 +13,7 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
 #include "Core/AchievementManager.h"
 #include "DiscIO/Volume.h"
@@ -74,6 +77,20 @@ static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
   }
 }
 
+static void PrintThroughput(u64 bytes, DT duration,
+                            const DiscIO::VolumeVerifier::PipelineStats& stats)
+{
+  const double seconds = std::max(std::chrono::duration_cast<DT_s>(duration).count(), 0.001);
+  const double reading = std::chrono::duration_cast<DT_s>(stats.reading).count();
+  const double waiting = std::chrono::duration_cast<DT_s>(stats.waiting).count();
+
+  fmt::print(std::cout, "Throughput: {:.1f} MB/s ({} bytes in {:.1f} seconds)\n",
+             bytes / seconds / 1000000, bytes, seconds);
+  fmt::print(std::cout, "Time spent reading: {:.1f} seconds\n", reading);
+  fmt::print(std::cout, "Time spent waiting for hashing and integrity checks: {:.1f} seconds\n",
+             waiting);
+}
+
 int VerifyCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -156,6 +173,7 @@ int VerifyCommand(const std::vector<std::string>& args)
   }
 
   // Verify the volume
+  const TimePoint start_time = Clock::now();
   DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
   verifier.Start();
   while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
@@ -163,6 +181,7 @@ int VerifyCommand(const std::vector<std::string>& args)
     verifier.Process();
   }
   verifier.Finish();
+  const DT verify_duration = Clock::now() - start_time;
   const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
 
 #ifdef USE_RETRO_ACHIEVEMENTS
@@ -177,6 +196,7 @@ int VerifyCommand(const std::vector<std::string>& args)
   if (!algorithm_is_set)
   {
     PrintFullReport(result);
+    PrintThroughput(verifier.GetTotalBytes(), verify_duration, verifier.GetPipelineStats());
   }
   else
   {
@@ -53,6 +53,9 @@ public:
     return resources.fence_counter;
   }
 
+  // Returns which of the NUM_COMMAND_BUFFERS command buffers is currently being recorded.
+  u32 GetCurrentCommandBufferIndex() const { return m_current_cmd_buffer; }
+
   // Returns the semaphore for the current command buffer, which can be used to ensure the
   // swap chain image is ready before the command buffer executes.
   // Once you've confirmed that the semaphore will be signalled this frame, call
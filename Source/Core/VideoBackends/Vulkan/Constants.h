@@ -93,4 +93,8 @@ constexpr u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
 // large anyway, so it's only really an issue for HD texture packs, and memory is not
 // a limiting factor in these scenarios anyway.
 constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+
+// Textures above the threshold but no larger than this are placed in the streaming buffer when
+// it has free space without waiting for the GPU, and fall back to a staging texture otherwise.
+constexpr u32 STAGING_TEXTURE_UPLOAD_OPPORTUNISTIC_LIMIT = TEXTURE_UPLOAD_BUFFER_SIZE / 2;
 }  // namespace Vulkan
@@ -0,0 +1,361 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Vulkan/DrawRecorder.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "Common/Assert.h"
+#include "Common/VariantUtil.h"
+
+#include "VideoBackends/Vulkan/CommandBufferManager.h"
+#include "VideoBackends/Vulkan/VulkanContext.h"
+
+namespace Vulkan
+{
+void DrawCommandList::Clear()
+{
+  m_commands.clear();
+  m_samplers.clear();
+  m_clear_attachments.clear();
+  m_draw_count = 0;
+}
+
+void DrawCommandList::BindPipeline(VkPipeline pipeline)
+{
+  m_commands.emplace_back(BindPipelineCommand{pipeline});
+}
+
+void DrawCommandList::BindVertexBuffer(VkBuffer buffer, VkDeviceSize offset)
+{
+  m_commands.emplace_back(BindVertexBufferCommand{buffer, offset});
+}
+
+void DrawCommandList::BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type)
+{
+  m_commands.emplace_back(BindIndexBufferCommand{buffer, offset, type});
+}
+
+void DrawCommandList::SetViewport(const VkViewport& viewport)
+{
+  m_commands.emplace_back(SetViewportCommand{viewport});
+}
+
+void DrawCommandList::SetScissor(const VkRect2D& scissor)
+{
+  m_commands.emplace_back(SetScissorCommand{scissor});
+}
+
+void DrawCommandList::BindDescriptorSets(VkPipelineLayout layout, u32 first_set,
+                                         std::span<const VkDescriptorSet> sets,
+                                         std::span<const u32> dynamic_offsets)
+{
+  ASSERT(sets.size() <= MAX_DESCRIPTOR_SETS &&
+         dynamic_offsets.size() <= NUM_UBO_DESCRIPTOR_SET_BINDINGS);
+
+  BindDescriptorSetsCommand command{layout,
+                                    first_set,
+                                    static_cast<u32>(sets.size()),
+                                    {},
+                                    static_cast<u32>(dynamic_offsets.size()),
+                                    {}};
+  std::ranges::copy(sets, command.sets.begin());
+  std::ranges::copy(dynamic_offsets, command.dynamic_offsets.begin());
+  m_commands.emplace_back(command);
+}
+
+void DrawCommandList::PushSamplers(VkPipelineLayout layout, u32 set,
+                                   std::span<const VkDescriptorImageInfo> samplers)
+{
+  m_commands.emplace_back(PushSamplersCommand{layout, set, static_cast<u32>(m_samplers.size()),
+                                              static_cast<u32>(samplers.size())});
+  m_samplers.insert(m_samplers.end(), samplers.begin(), samplers.end());
+}
+
+void DrawCommandList::Draw(u32 vertex_count, u32 first_vertex)
+{
+  m_commands.emplace_back(DrawCommand{vertex_count, first_vertex});
+  ++m_draw_count;
+}
+
+void DrawCommandList::DrawIndexed(u32 index_count, u32 first_index, s32 vertex_offset)
+{
+  m_commands.emplace_back(DrawIndexedCommand{index_count, first_index, vertex_offset});
+  ++m_draw_count;
+}
+
+void DrawCommandList::ClearAttachments(std::span<const VkClearAttachment> attachments,
+                                       const VkClearRect& rect)
+{
+  m_commands.emplace_back(ClearAttachmentsCommand{static_cast<u32>(m_clear_attachments.size()),
+                                                  static_cast<u32>(attachments.size()), rect});
+  m_clear_attachments.insert(m_clear_attachments.end(), attachments.begin(), attachments.end());
+}
+
+void DrawCommandList::BeginQuery(VkQueryPool pool, u32 query, VkQueryControlFlags flags)
+{
+  m_commands.emplace_back(BeginQueryCommand{pool, query, flags});
+}
+
+void DrawCommandList::EndQuery(VkQueryPool pool, u32 query)
+{
+  m_commands.emplace_back(EndQueryCommand{pool, query});
+}
+
+void DrawCommandList::Record(VkCommandBuffer command_buffer) const
+{
+  const auto record = overloaded{
+      [&](const BindPipelineCommand& command) {
+        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, command.pipeline);
+      },
+      [&](const BindVertexBufferCommand& command) {
+        vkCmdBindVertexBuffers(command_buffer, 0, 1, &command.buffer, &command.offset);
+      },
+      [&](const BindIndexBufferCommand& command) {
+        vkCmdBindIndexBuffer(command_buffer, command.buffer, command.offset, command.type);
+      },
+      [&](const SetViewportCommand& command) {
+        vkCmdSetViewport(command_buffer, 0, 1, &command.viewport);
+      },
+      [&](const SetScissorCommand& command) {
+        vkCmdSetScissor(command_buffer, 0, 1, &command.scissor);
+      },
+      [&](const BindDescriptorSetsCommand& command) {
+        vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, command.layout,
+                                command.first_set, command.num_sets, command.sets.data(),
+                                command.num_dynamic_offsets, command.dynamic_offsets.data());
+      },
+      [&](const PushSamplersCommand& command) {
+        const VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                            nullptr,
+                                            VK_NULL_HANDLE,
+                                            0,
+                                            0,
+                                            command.num_samplers,
+                                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                            &m_samplers[command.first_sampler],
+                                            nullptr,
+                                            nullptr};
+        vkCmdPushDescriptorSetKHR(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, command.layout,
+                                  command.set, 1, &write);
+      },
+      [&](const DrawCommand& command) {
+        vkCmdDraw(command_buffer, command.vertex_count, 1, command.first_vertex, 0);
+      },
+      [&](const DrawIndexedCommand& command) {
+        vkCmdDrawIndexed(command_buffer, command.index_count, 1, command.first_index,
+                         command.vertex_offset, 0);
+      },
+      [&](const ClearAttachmentsCommand& command) {
+        vkCmdClearAttachments(command_buffer, command.num_attachments,
+                              &m_clear_attachments[command.first_attachment], 1, &command.rect);
+      },
+      [&](const BeginQueryCommand& command) {
+        vkCmdBeginQuery(command_buffer, command.pool, command.query, command.flags);
+      },
+      [&](const EndQueryCommand& command) {
+        vkCmdEndQuery(command_buffer, command.pool, command.query);
+      },
+  };
+
+  for (const Command& command : m_commands)
+    std::visit(record, command);
+}
+
+DrawRecorder::DrawRecorder(u32 num_workers)
+{
+  ASSERT(num_workers > 0);
+  for (u32 i = 0; i < num_workers; i++)
+    m_workers.push_back(std::make_unique<Worker>());
+}
+
+DrawRecorder::~DrawRecorder()
+{
+  for (auto& worker : m_workers)
+    worker->thread.Shutdown();
+
+  // The command buffers may still be in use by submitted primary command buffers.
+  g_command_buffer_mgr->WaitForWorkerThreadIdle();
+  vkDeviceWaitIdle(g_vulkan_context->GetDevice());
+
+  for (auto& worker : m_workers)
+    DestroyCommandPools(worker->command_pools);
+  DestroyCommandPools(m_command_pools);
+}
+
+bool DrawRecorder::Initialize()
+{
+  if (!CreateCommandPools(m_command_pools))
+    return false;
+
+  for (size_t i = 0; i < m_workers.size(); i++)
+  {
+    Worker* const worker = m_workers[i].get();
+    if (!CreateCommandPools(worker->command_pools))
+      return false;
+
+    worker->thread.Reset(fmt::format("Vulkan Draw Recorder {}", i),
+                         [worker](Batch* batch) { RecordBatch(*batch, worker->command_pools); });
+  }
+
+  return true;
+}
+
+bool DrawRecorder::CreateCommandPools(ThreadCommandPools& command_pools)
+{
+  for (CommandPool& command_pool : command_pools)
+  {
+    const VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr,
+                                               0, g_vulkan_context->GetGraphicsQueueFamilyIndex()};
+    const VkResult res = vkCreateCommandPool(g_vulkan_context->GetDevice(), &pool_info, nullptr,
+                                             &command_pool.pool);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void DrawRecorder::DestroyCommandPools(ThreadCommandPools& command_pools)
+{
+  // Destroying the pools frees the command buffers allocated from them.
+  for (CommandPool& command_pool : command_pools)
+  {
+    if (command_pool.pool != VK_NULL_HANDLE)
+      vkDestroyCommandPool(g_vulkan_context->GetDevice(), command_pool.pool, nullptr);
+    command_pool = {};
+  }
+}
+
+void DrawRecorder::BeginRenderPass(VkRenderPass render_pass, VkFramebuffer framebuffer)
+{
+  ASSERT(!IsRecording());
+
+  m_render_pass = render_pass;
+  m_framebuffer = framebuffer;
+  m_num_batches = 0;
+  StartBatch();
+}
+
+void DrawRecorder::StartBatch()
+{
+  if (m_num_batches == m_batches.size())
+    m_batches.push_back(std::make_unique<Batch>());
+
+  Batch& batch = *m_batches[m_num_batches++];
+  batch.commands.Clear();
+  batch.render_pass = m_render_pass;
+  batch.framebuffer = m_framebuffer;
+  batch.command_buffer_index = g_command_buffer_mgr->GetCurrentCommandBufferIndex();
+  batch.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+  batch.command_buffer = VK_NULL_HANDLE;
+}
+
+void DrawRecorder::FlushCommandList()
+{
+  Batch& batch = *m_batches[m_num_batches - 1];
+  if (batch.commands.IsEmpty())
+    return;
+
+  m_workers[m_next_worker]->thread.Push(&batch);
+  m_next_worker = (m_next_worker + 1) % static_cast<u32>(m_workers.size());
+  StartBatch();
+}
+
+void DrawRecorder::EndRenderPass(VkCommandBuffer primary_command_buffer)
+{
+  ASSERT(IsRecording());
+
+  // Recording the last batch here saves waking a worker for render passes with few draws.
+  Batch& last_batch = *m_batches[m_num_batches - 1];
+  if (!last_batch.commands.IsEmpty())
+    RecordBatch(last_batch, m_command_pools);
+
+  for (auto& worker : m_workers)
+    worker->thread.WaitForCompletion();
+
+  m_command_buffers.clear();
+  for (size_t i = 0; i < m_num_batches; i++)
+  {
+    if (m_batches[i]->command_buffer != VK_NULL_HANDLE)
+      m_command_buffers.push_back(m_batches[i]->command_buffer);
+  }
+
+  if (!m_command_buffers.empty())
+  {
+    vkCmdExecuteCommands(primary_command_buffer, static_cast<u32>(m_command_buffers.size()),
+                         m_command_buffers.data());
+  }
+
+  m_render_pass = VK_NULL_HANDLE;
+  m_framebuffer = VK_NULL_HANDLE;
+  m_next_worker = 0;
+}
+
+void DrawRecorder::RecordBatch(Batch& batch, ThreadCommandPools& command_pools)
+{
+  const VkDevice device = g_vulkan_context->GetDevice();
+  CommandPool& command_pool = command_pools[batch.command_buffer_index];
+  if (command_pool.fence_counter != batch.fence_counter)
+  {
+    const VkResult res = vkResetCommandPool(device, command_pool.pool, 0);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+    command_pool.num_used = 0;
+    command_pool.fence_counter = batch.fence_counter;
+  }
+
+  if (command_pool.num_used == command_pool.command_buffers.size())
+  {
+    const VkCommandBufferAllocateInfo allocate_info = {
+        VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, command_pool.pool,
+        VK_COMMAND_BUFFER_LEVEL_SECONDARY, 1};
+    VkCommandBuffer command_buffer;
+    const VkResult res = vkAllocateCommandBuffers(device, &allocate_info, &command_buffer);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+      return;
+    }
+    command_pool.command_buffers.push_back(command_buffer);
+  }
+
+  const VkCommandBuffer command_buffer = command_pool.command_buffers[command_pool.num_used++];
+  const VkCommandBufferInheritanceInfo inheritance_info = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+      nullptr,
+      batch.render_pass,
+      0,
+      batch.framebuffer,
+      VK_FALSE,
+      0,
+      0};
+  const VkCommandBufferBeginInfo begin_info = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
+      VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+          VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+      &inheritance_info};
+  VkResult res = vkBeginCommandBuffer(command_buffer, &begin_info);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
+    return;
+  }
+
+  batch.commands.Record(command_buffer);
+
+  res = vkEndCommandBuffer(command_buffer);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
+    return;
+  }
+
+  batch.command_buffer = command_buffer;
+}
+}  // namespace Vulkan
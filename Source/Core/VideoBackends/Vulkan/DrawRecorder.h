@@ -0,0 +1,210 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <variant>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+#include "VideoBackends/Vulkan/Constants.h"
+#include "VideoCommon/Constants.h"
+
+namespace Vulkan
+{
+// The commands of a render pass, collected on the GPU thread so that they can be recorded into a
+// secondary command buffer elsewhere. Everything referenced must stay alive until the command
+// buffer has executed, which deferred destruction already ensures.
+class DrawCommandList
+{
+public:
+  bool IsEmpty() const { return m_commands.empty(); }
+  u32 GetDrawCount() const { return m_draw_count; }
+  void Clear();
+
+  void BindPipeline(VkPipeline pipeline);
+  void BindVertexBuffer(VkBuffer buffer, VkDeviceSize offset);
+  void BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type);
+  void SetViewport(const VkViewport& viewport);
+  void SetScissor(const VkRect2D& scissor);
+  void BindDescriptorSets(VkPipelineLayout layout, u32 first_set,
+                          std::span<const VkDescriptorSet> sets,
+                          std::span<const u32> dynamic_offsets);
+  void PushSamplers(VkPipelineLayout layout, u32 set,
+                    std::span<const VkDescriptorImageInfo> samplers);
+  void Draw(u32 vertex_count, u32 first_vertex);
+  void DrawIndexed(u32 index_count, u32 first_index, s32 vertex_offset);
+  void ClearAttachments(std::span<const VkClearAttachment> attachments, const VkClearRect& rect);
+  void BeginQuery(VkQueryPool pool, u32 query, VkQueryControlFlags flags);
+  void EndQuery(VkQueryPool pool, u32 query);
+
+  void Record(VkCommandBuffer command_buffer) const;
+
+private:
+  static constexpr size_t MAX_DESCRIPTOR_SETS = 3;
+
+  struct BindPipelineCommand
+  {
+    VkPipeline pipeline;
+  };
+  struct BindVertexBufferCommand
+  {
+    VkBuffer buffer;
+    VkDeviceSize offset;
+  };
+  struct BindIndexBufferCommand
+  {
+    VkBuffer buffer;
+    VkDeviceSize offset;
+    VkIndexType type;
+  };
+  struct SetViewportCommand
+  {
+    VkViewport viewport;
+  };
+  struct SetScissorCommand
+  {
+    VkRect2D scissor;
+  };
+  struct BindDescriptorSetsCommand
+  {
+    VkPipelineLayout layout;
+    u32 first_set;
+    u32 num_sets;
+    std::array<VkDescriptorSet, MAX_DESCRIPTOR_SETS> sets;
+    u32 num_dynamic_offsets;
+    std::array<u32, NUM_UBO_DESCRIPTOR_SET_BINDINGS> dynamic_offsets;
+  };
+  // The samplers and clear attachments are kept in separate arrays, which keeps the commands small.
+  struct PushSamplersCommand
+  {
+    VkPipelineLayout layout;
+    u32 set;
+    u32 first_sampler;
+    u32 num_samplers;
+  };
+  struct DrawCommand
+  {
+    u32 vertex_count;
+    u32 first_vertex;
+  };
+  struct DrawIndexedCommand
+  {
+    u32 index_count;
+    u32 first_index;
+    s32 vertex_offset;
+  };
+  struct ClearAttachmentsCommand
+  {
+    u32 first_attachment;
+    u32 num_attachments;
+    VkClearRect rect;
+  };
+  struct BeginQueryCommand
+  {
+    VkQueryPool pool;
+    u32 query;
+    VkQueryControlFlags flags;
+  };
+  struct EndQueryCommand
+  {
+    VkQueryPool pool;
+    u32 query;
+  };
+
+  using Command =
+      std::variant<BindPipelineCommand, BindVertexBufferCommand, BindIndexBufferCommand,
+                   SetViewportCommand, SetScissorCommand, BindDescriptorSetsCommand,
+                   PushSamplersCommand, DrawCommand, DrawIndexedCommand, ClearAttachmentsCommand,
+                   BeginQueryCommand, EndQueryCommand>;
+
+  std::vector<Command> m_commands;
+  std::vector<VkDescriptorImageInfo> m_samplers;
+  std::vector<VkClearAttachment> m_clear_attachments;
+  u32 m_draw_count = 0;
+};
+
+// Records the draws of a render pass into secondary command buffers on worker threads. The GPU
+// thread still tracks state and allocates descriptor sets, but instead of recording commands it
+// collects them into command lists. Every DRAWS_PER_BATCH draws, the list is handed to the next
+// worker, and the following list starts by binding all state again. When the render pass ends, the
+// GPU thread records the last list itself, waits for the workers and executes their command
+// buffers in order.
+class DrawRecorder
+{
+public:
+  static constexpr u32 DRAWS_PER_BATCH = 256;
+
+  explicit DrawRecorder(u32 num_workers);
+  ~DrawRecorder();
+
+  bool Initialize();
+
+  bool IsRecording() const { return m_render_pass != VK_NULL_HANDLE; }
+  DrawCommandList& GetCommandList() { return m_batches[m_num_batches - 1]->commands; }
+
+  // Must be called after the render pass was begun with secondary command buffer contents.
+  void BeginRenderPass(VkRenderPass render_pass, VkFramebuffer framebuffer);
+
+  // Hands the current command list to a worker, if it is not empty. Commands added after this
+  // can't rely on any state bound before.
+  void FlushCommandList();
+
+  // Executes the recorded commands in the primary command buffer, which must be in the render pass.
+  void EndRenderPass(VkCommandBuffer primary_command_buffer);
+
+private:
+  struct CommandPool
+  {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> command_buffers;
+    size_t num_used = 0;
+    // Command buffers can be reused once the primary command buffer they were executed in has
+    // completed, which is the case when its slot is used with a new fence counter.
+    u64 fence_counter = 0;
+  };
+
+  // Command pools can only be used by one thread at a time, so each thread has its own for each
+  // primary command buffer.
+  using ThreadCommandPools = std::array<CommandPool, NUM_COMMAND_BUFFERS>;
+
+  struct Batch
+  {
+    DrawCommandList commands;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    u32 command_buffer_index = 0;
+    u64 fence_counter = 0;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+  };
+
+  struct Worker
+  {
+    ThreadCommandPools command_pools;
+    Common::WorkQueueThreadSP<Batch*> thread;
+  };
+
+  static bool CreateCommandPools(ThreadCommandPools& command_pools);
+  static void DestroyCommandPools(ThreadCommandPools& command_pools);
+  static void RecordBatch(Batch& batch, ThreadCommandPools& command_pools);
+  void StartBatch();
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  // Used for the last batch of each render pass, which the GPU thread records itself.
+  ThreadCommandPools m_command_pools;
+  u32 m_next_worker = 0;
+
+  // Batches are reused to keep the capacity of their command lists.
+  std::vector<std::unique_ptr<Batch>> m_batches;
+  size_t m_num_batches = 0;
+  std::vector<VkCommandBuffer> m_command_buffers;
+
+  VkRenderPass m_render_pass = VK_NULL_HANDLE;
+  VkFramebuffer m_framebuffer = VK_NULL_HANDLE;
+};
+}  // namespace Vulkan
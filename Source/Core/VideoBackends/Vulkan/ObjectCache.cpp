@@ -32,6 +32,10 @@ ObjectCache::ObjectCache() = default;
 
 ObjectCache::~ObjectCache()
 {
+  m_vertex_input_libraries.clear();
+  m_pre_rasterization_libraries.clear();
+  m_fragment_shader_libraries.clear();
+  m_fragment_output_libraries.clear();
   DestroyPipelineCache();
   DestroySamplers();
   DestroyPipelineLayouts();
@@ -70,11 +74,18 @@ bool ObjectCache::Initialize()
       return false;
   }
 
+  if (g_vulkan_context->SupportsGraphicsPipelineLibrary())
+    m_pipeline_optimization_thread.Reset("Vulkan Pipeline Optimizer");
+
   return true;
 }
 
 void ObjectCache::Shutdown()
 {
+  // Skip any optimized pipelines which haven't started compiling yet, they are no longer needed.
+  m_pipeline_optimization_thread.Cancel();
+  m_pipeline_optimization_thread.Shutdown();
+
   if (g_ActiveConfig.bShaderCache && m_pipeline_cache != VK_NULL_HANDLE)
     SavePipelineCache();
 }
@@ -220,6 +231,13 @@ bool ObjectCache::CreateDescriptorSetLayouts()
   if (!g_backend_info.bSupportsDynamicVertexLoader)
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SHADER_STORAGE_BUFFERS].bindingCount--;
 
+  // GX samplers are pushed directly into the command buffer instead of allocating a set per draw.
+  if (g_vulkan_context->SupportsPushDescriptors())
+  {
+    create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS].flags |=
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+  }
+
   for (size_t i = 0; i < create_infos.size(); i++)
   {
     VkResult res = vkCreateDescriptorSetLayout(g_vulkan_context->GetDevice(), &create_infos[i],
@@ -701,4 +719,86 @@ void ObjectCache::ReloadPipelineCache()
   else
     CreatePipelineCache();
 }
+template <typename Key>
+static VKPipelineLibraryPtr GetOrCreatePipelineLibrary(
+    std::mutex& mutex, std::map<Key, VKPipelineLibraryPtr>& map, const Key& key,
+    const ObjectCache::PipelineLibraryCreator& create_library)
+{
+  {
+    std::lock_guard lk(mutex);
+    const auto iter = map.find(key);
+    if (iter != map.end())
+      return iter->second;
+  }
+
+  // Compile without holding the lock, so that other threads can create unrelated parts. If
+  // another thread created the same part in the meantime, use that one instead.
+  const VkPipeline pipeline = create_library();
+  if (pipeline == VK_NULL_HANDLE)
+    return nullptr;
+
+  auto library = std::make_shared<VKPipelineLibrary>(pipeline);
+  std::lock_guard lk(mutex);
+  return map.emplace(key, std::move(library)).first->second;
+}
+
+VKPipelineLibraryPtr
+ObjectCache::GetVertexInputLibrary(const PortableVertexDeclaration& vertex_decl,
+                                   PrimitiveType primitive,
+                                   const PipelineLibraryCreator& create_library)
+{
+  return GetOrCreatePipelineLibrary(m_pipeline_library_mutex, m_vertex_input_libraries,
+                                    VertexInputLibraryKey(vertex_decl, primitive), create_library);
+}
+
+VKPipelineLibraryPtr ObjectCache::GetPreRasterizationLibrary(
+    const VKShader* vertex_shader, const VKShader* geometry_shader,
+    const RasterizationState& rasterization_state, VkPipelineLayout pipeline_layout,
+    VkRenderPass render_pass, const PipelineLibraryCreator& create_library)
+{
+  return GetOrCreatePipelineLibrary(
+      m_pipeline_library_mutex, m_pre_rasterization_libraries,
+      PreRasterizationLibraryKey(vertex_shader, geometry_shader, rasterization_state.hex,
+                                 pipeline_layout, render_pass),
+      create_library);
+}
+
+VKPipelineLibraryPtr ObjectCache::GetFragmentShaderLibrary(
+    const VKShader* pixel_shader, const DepthState& depth_state,
+    const FramebufferState& framebuffer_state, VkPipelineLayout pipeline_layout,
+    VkRenderPass render_pass, const PipelineLibraryCreator& create_library)
+{
+  return GetOrCreatePipelineLibrary(m_pipeline_library_mutex, m_fragment_shader_libraries,
+                                    FragmentShaderLibraryKey(pixel_shader, depth_state.hex,
+                                                             framebuffer_state.hex,
+                                                             pipeline_layout, render_pass),
+                                    create_library);
+}
+
+VKPipelineLibraryPtr
+ObjectCache::GetFragmentOutputLibrary(const BlendingState& blending_state,
+                                      const FramebufferState& framebuffer_state,
+                                      VkRenderPass render_pass,
+                                      const PipelineLibraryCreator& create_library)
+{
+  return GetOrCreatePipelineLibrary(
+      m_pipeline_library_mutex, m_fragment_output_libraries,
+      FragmentOutputLibraryKey(blending_state.hex, framebuffer_state.hex, render_pass),
+      create_library);
+}
+
+void ObjectCache::ReleasePipelineLibraries(const VKShader* shader)
+{
+  std::lock_guard lk(m_pipeline_library_mutex);
+  std::erase_if(m_pre_rasterization_libraries, [shader](const auto& it) {
+    return std::get<0>(it.first) == shader || std::get<1>(it.first) == shader;
+  });
+  std::erase_if(m_fragment_shader_libraries,
+                [shader](const auto& it) { return std::get<0>(it.first) == shader; });
+}
+
+void ObjectCache::QueuePipelineOptimization(std::function<void()> func)
+{
+  m_pipeline_optimization_thread.Push(std::move(func));
+}
 }  // namespace Vulkan
@@ -5,18 +5,24 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 
 #include "Common/CommonTypes.h"
 #include "Common/LinearDiskCache.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoBackends/Vulkan/Constants.h"
+#include "VideoBackends/Vulkan/VKPipeline.h"
 
 #include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/VertexShaderGen.h"
@@ -25,6 +31,7 @@ namespace Vulkan
 {
 class CommandBufferManager;
 class VertexFormat;
+class VKShader;
 class VKTexture;
 class StreamBuffer;
 
@@ -75,6 +82,36 @@ public:
   // Reload pipeline cache. Call when host config changes.
   void ReloadPipelineCache();
 
+  // Graphics pipeline library parts, used with VK_EXT_graphics_pipeline_library. On a miss, the
+  // part is created by calling create_library. Safe to call from multiple threads.
+  using PipelineLibraryCreator = std::function<VkPipeline()>;
+  VKPipelineLibraryPtr GetVertexInputLibrary(const PortableVertexDeclaration& vertex_decl,
+                                             PrimitiveType primitive,
+                                             const PipelineLibraryCreator& create_library);
+  VKPipelineLibraryPtr GetPreRasterizationLibrary(const VKShader* vertex_shader,
+                                                  const VKShader* geometry_shader,
+                                                  const RasterizationState& rasterization_state,
+                                                  VkPipelineLayout pipeline_layout,
+                                                  VkRenderPass render_pass,
+                                                  const PipelineLibraryCreator& create_library);
+  VKPipelineLibraryPtr GetFragmentShaderLibrary(const VKShader* pixel_shader,
+                                                const DepthState& depth_state,
+                                                const FramebufferState& framebuffer_state,
+                                                VkPipelineLayout pipeline_layout,
+                                                VkRenderPass render_pass,
+                                                const PipelineLibraryCreator& create_library);
+  VKPipelineLibraryPtr GetFragmentOutputLibrary(const BlendingState& blending_state,
+                                                const FramebufferState& framebuffer_state,
+                                                VkRenderPass render_pass,
+                                                const PipelineLibraryCreator& create_library);
+
+  // Drops cached pipeline library parts which were compiled from the specified shader. Called when
+  // the shader is destroyed, as its address may be reused by a new shader.
+  void ReleasePipelineLibraries(const VKShader* shader);
+
+  // Runs func on the background thread which compiles link-time optimized pipelines.
+  void QueuePipelineOptimization(std::function<void()> func);
+
 private:
   bool CreateDescriptorSetLayouts();
   void DestroyDescriptorSetLayouts();
@@ -108,6 +145,20 @@ private:
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
+
+  // Graphics pipeline library caches
+  using VertexInputLibraryKey = std::pair<PortableVertexDeclaration, PrimitiveType>;
+  using PreRasterizationLibraryKey =
+      std::tuple<const VKShader*, const VKShader*, u32, VkPipelineLayout, VkRenderPass>;
+  using FragmentShaderLibraryKey =
+      std::tuple<const VKShader*, u32, u32, VkPipelineLayout, VkRenderPass>;
+  using FragmentOutputLibraryKey = std::tuple<u32, u32, VkRenderPass>;
+  std::mutex m_pipeline_library_mutex;
+  std::map<VertexInputLibraryKey, VKPipelineLibraryPtr> m_vertex_input_libraries;
+  std::map<PreRasterizationLibraryKey, VKPipelineLibraryPtr> m_pre_rasterization_libraries;
+  std::map<FragmentShaderLibraryKey, VKPipelineLibraryPtr> m_fragment_shader_libraries;
+  std::map<FragmentOutputLibraryKey, VKPipelineLibraryPtr> m_fragment_output_libraries;
+  Common::AsyncWorkThread m_pipeline_optimization_thread;
 };
 
 extern std::unique_ptr<ObjectCache> g_object_cache;
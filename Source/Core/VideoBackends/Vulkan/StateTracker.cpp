@@ -6,6 +6,7 @@
 #include "Common/Assert.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
+#include "VideoBackends/Vulkan/DrawRecorder.h"
 #include "VideoBackends/Vulkan/ObjectCache.h"
 #include "VideoBackends/Vulkan/VKGfx.h"
 #include "VideoBackends/Vulkan/VKPipeline.h"
@@ -14,6 +15,8 @@
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
 #include "VideoCommon/Constants.h"
+#include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace Vulkan
 {
@@ -92,6 +95,14 @@ bool StateTracker::Initialize()
     m_bindings.image_textures[i].sampler = g_object_cache->GetPointSampler();
   }
 
+  if (g_ActiveConfig.iDrawRecordingThreads > 0)
+  {
+    m_draw_recorder =
+        std::make_unique<DrawRecorder>(static_cast<u32>(g_ActiveConfig.iDrawRecordingThreads));
+    if (!m_draw_recorder->Initialize())
+      return false;
+  }
+
   // Default dirty flags include all descriptors
   InvalidateCachedState();
   return true;
@@ -272,15 +283,46 @@ void StateTracker::InvalidateCachedState()
   m_gx_descriptor_sets.fill(VK_NULL_HANDLE);
   m_utility_descriptor_sets.fill(VK_NULL_HANDLE);
   m_compute_descriptor_set = VK_NULL_HANDLE;
-  m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTORS | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR |
-                   DIRTY_FLAG_PIPELINE | DIRTY_FLAG_COMPUTE_SHADER | DIRTY_FLAG_DESCRIPTOR_SETS |
-                   DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
+  m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTORS | DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
+  InvalidateBoundState();
+}
+
+void StateTracker::InvalidateBoundState()
+{
+  m_dirty_flags |= DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR | DIRTY_FLAG_PIPELINE |
+                   DIRTY_FLAG_COMPUTE_SHADER | DIRTY_FLAG_DESCRIPTOR_SETS;
+  if (m_compute_descriptor_set != VK_NULL_HANDLE)
+    m_dirty_flags |= DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
   if (m_vertex_buffer != VK_NULL_HANDLE)
     m_dirty_flags |= DIRTY_FLAG_VERTEX_BUFFER;
   if (m_index_buffer != VK_NULL_HANDLE)
     m_dirty_flags |= DIRTY_FLAG_INDEX_BUFFER;
 }
 
+DrawCommandList* StateTracker::GetDrawCommandList() const
+{
+  if (!m_draw_recorder || !m_draw_recorder->IsRecording())
+    return nullptr;
+
+  return &m_draw_recorder->GetCommandList();
+}
+
+void StateTracker::BeginRenderPass(const VkRenderPassBeginInfo& begin_info)
+{
+  // Only the EFB sees enough draws per render pass to be worth recording on other threads.
+  const bool record_draws =
+      m_draw_recorder && m_framebuffer == g_framebuffer_manager->GetEFBFramebuffer();
+
+  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
+                       record_draws ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS :
+                                      VK_SUBPASS_CONTENTS_INLINE);
+  if (record_draws)
+  {
+    m_draw_recorder->BeginRenderPass(begin_info.renderPass, begin_info.framebuffer);
+    InvalidateBoundState();
+  }
+}
+
 void StateTracker::BeginRenderPass()
 {
   if (InRenderPass())
@@ -297,8 +339,7 @@ void StateTracker::BeginRenderPass()
                                       0,
                                       nullptr};
 
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  BeginRenderPass(begin_info);
 }
 
 void StateTracker::BeginDiscardRenderPass()
@@ -317,8 +358,7 @@ void StateTracker::BeginDiscardRenderPass()
                                       0,
                                       nullptr};
 
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  BeginRenderPass(begin_info);
 }
 
 void StateTracker::EndRenderPass()
@@ -326,7 +366,16 @@ void StateTracker::EndRenderPass()
   if (!InRenderPass())
     return;
 
-  vkCmdEndRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer());
+  const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
+  if (m_draw_recorder && m_draw_recorder->IsRecording())
+  {
+    m_draw_recorder->EndRenderPass(command_buffer);
+
+    // Executing secondary command buffers leaves the state of the primary one undefined.
+    InvalidateBoundState();
+  }
+
+  vkCmdEndRenderPass(command_buffer);
   m_current_render_pass = VK_NULL_HANDLE;
 }
 
@@ -346,8 +395,7 @@ void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue
                                       num_clear_values,
                                       clear_values};
 
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  BeginRenderPass(begin_info);
 }
 
 void StateTracker::SetViewport(const VkViewport& viewport)
@@ -378,40 +426,139 @@ bool StateTracker::Bind()
   if (m_current_render_pass == m_framebuffer->GetClearRenderPass() && !IsViewportWithinRenderArea())
     EndRenderPass();
 
-  // Get a new descriptor set if any parts have changed
-  UpdateDescriptorSet();
-
-  // Start render pass if not already started
+  // Start render pass if not already started. This comes first as the draw recorder needs all
+  // state bound again in its command lists.
   if (!InRenderPass())
     BeginRenderPass();
 
+  // Get a new descriptor set if any parts have changed
+  UpdateDescriptorSet();
+
   // Re-bind parts of the pipeline
   const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
+  DrawCommandList* const command_list = GetDrawCommandList();
   const bool needs_vertex_buffer = !g_backend_info.bSupportsDynamicVertexLoader ||
                                    m_pipeline->GetUsage() != AbstractPipelineUsage::GXUber;
   if (needs_vertex_buffer && (m_dirty_flags & DIRTY_FLAG_VERTEX_BUFFER))
   {
-    vkCmdBindVertexBuffers(command_buffer, 0, 1, &m_vertex_buffer, &m_vertex_buffer_offset);
+    if (command_list)
+      command_list->BindVertexBuffer(m_vertex_buffer, m_vertex_buffer_offset);
+    else
+      vkCmdBindVertexBuffers(command_buffer, 0, 1, &m_vertex_buffer, &m_vertex_buffer_offset);
     m_dirty_flags &= ~DIRTY_FLAG_VERTEX_BUFFER;
   }
 
   if (m_dirty_flags & DIRTY_FLAG_INDEX_BUFFER)
-    vkCmdBindIndexBuffer(command_buffer, m_index_buffer, m_index_buffer_offset, m_index_type);
+  {
+    if (command_list)
+      command_list->BindIndexBuffer(m_index_buffer, m_index_buffer_offset, m_index_type);
+    else
+      vkCmdBindIndexBuffer(command_buffer, m_index_buffer, m_index_buffer_offset, m_index_type);
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_PIPELINE)
-    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipeline());
+  {
+    if (command_list)
+    {
+      command_list->BindPipeline(m_pipeline->GetVkPipeline());
+    }
+    else
+    {
+      vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                        m_pipeline->GetVkPipeline());
+    }
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_VIEWPORT)
-    vkCmdSetViewport(command_buffer, 0, 1, &m_viewport);
+  {
+    if (command_list)
+      command_list->SetViewport(m_viewport);
+    else
+      vkCmdSetViewport(command_buffer, 0, 1, &m_viewport);
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_SCISSOR)
-    vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
+  {
+    if (command_list)
+      command_list->SetScissor(m_scissor);
+    else
+      vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
+  }
 
   m_dirty_flags &=
       ~(DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR);
   return true;
 }
 
+void StateTracker::Draw(u32 num_vertices, u32 base_vertex)
+{
+  if (DrawCommandList* const command_list = GetDrawCommandList())
+  {
+    command_list->Draw(num_vertices, base_vertex);
+    CountDraw();
+    return;
+  }
+
+  vkCmdDraw(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_vertices, 1, base_vertex, 0);
+}
+
+void StateTracker::DrawIndexed(u32 num_indices, u32 base_index, u32 base_vertex)
+{
+  if (DrawCommandList* const command_list = GetDrawCommandList())
+  {
+    command_list->DrawIndexed(num_indices, base_index, static_cast<s32>(base_vertex));
+    CountDraw();
+    return;
+  }
+
+  vkCmdDrawIndexed(g_command_buffer_mgr->GetCurrentCommandBuffer(), num_indices, 1, base_index,
+                   base_vertex, 0);
+}
+
+void StateTracker::CountDraw()
+{
+  // A query has to begin and end in the same command buffer.
+  if (m_query_active ||
+      m_draw_recorder->GetCommandList().GetDrawCount() < DrawRecorder::DRAWS_PER_BATCH)
+  {
+    return;
+  }
+
+  m_draw_recorder->FlushCommandList();
+  InvalidateBoundState();
+}
+
+void StateTracker::ClearAttachments(std::span<const VkClearAttachment> attachments,
+                                    const VkClearRect& rect)
+{
+  if (DrawCommandList* const command_list = GetDrawCommandList())
+  {
+    command_list->ClearAttachments(attachments, rect);
+    return;
+  }
+
+  vkCmdClearAttachments(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                        static_cast<u32>(attachments.size()), attachments.data(), 1, &rect);
+}
+
+void StateTracker::BeginQuery(VkQueryPool pool, u32 query, VkQueryControlFlags flags)
+{
+  m_query_active = true;
+  if (DrawCommandList* const command_list = GetDrawCommandList())
+    command_list->BeginQuery(pool, query, flags);
+  else
+    vkCmdBeginQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), pool, query, flags);
+}
+
+void StateTracker::EndQuery(VkQueryPool pool, u32 query)
+{
+  m_query_active = false;
+  if (DrawCommandList* const command_list = GetDrawCommandList())
+    command_list->EndQuery(pool, query);
+  else
+    vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), pool, query);
+}
+
 bool StateTracker::BindCompute()
 {
   if (!m_compute_shader)
@@ -517,7 +664,10 @@ void StateTracker::UpdateGXDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_UBOS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+  // With push descriptors, the samplers are written into the command buffer below instead.
+  const bool push_samplers = g_vulkan_context->SupportsPushDescriptors();
+  if (!push_samplers &&
+      (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE))
   {
     m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
@@ -572,26 +722,61 @@ void StateTracker::UpdateGXDescriptorSet()
   if (num_writes > 0)
     vkUpdateDescriptorSets(g_vulkan_context->GetDevice(), num_writes, writes.data(), 0, nullptr);
 
-  if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
+  // Pushed descriptors are lost when the layout changes, so they have to be re-pushed alongside
+  // the descriptor sets as well as when the samplers themselves change.
+  const bool needs_sampler_push =
+      push_samplers && (m_dirty_flags & (DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_DESCRIPTOR_SETS));
+  const auto ubo_offsets = std::span(m_bindings.gx_ubo_offsets)
+                               .first(needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS :
+                                                     (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1));
+
+  if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS && push_samplers)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
-                            m_gx_descriptor_sets.data(),
-                            needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS :
-                                           (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-                            m_bindings.gx_ubo_offsets.data());
+    // The pushed sampler set sits between the UBO and SSBO sets, so bind those two separately.
+    BindDescriptorSets(0, std::span(m_gx_descriptor_sets).first(1), ubo_offsets);
+    if (needs_ssbo)
+      BindDescriptorSets(2, std::span(m_gx_descriptor_sets).subspan(2, 1), {});
+    m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
+  {
+    BindDescriptorSets(
+        0,
+        std::span(m_gx_descriptor_sets)
+            .first(needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1)),
+        ubo_offsets);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
   }
   else if (m_dirty_flags & DIRTY_FLAG_GX_UBO_OFFSETS)
   {
-    vkCmdBindDescriptorSets(
-        g_command_buffer_mgr->GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
-        m_pipeline->GetVkPipelineLayout(), 0, 1, m_gx_descriptor_sets.data(),
-        needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-        m_bindings.gx_ubo_offsets.data());
+    BindDescriptorSets(0, std::span(m_gx_descriptor_sets).first(1), ubo_offsets);
     m_dirty_flags &= ~DIRTY_FLAG_GX_UBO_OFFSETS;
   }
+
+  if (needs_sampler_push)
+  {
+    const VkPipelineLayout layout = m_pipeline->GetVkPipelineLayout();
+    if (DrawCommandList* const command_list = GetDrawCommandList())
+    {
+      command_list->PushSamplers(layout, 1, m_bindings.samplers);
+    }
+    else
+    {
+      const VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                          nullptr,
+                                          VK_NULL_HANDLE,
+                                          0,
+                                          0,
+                                          static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
+                                          VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                          m_bindings.samplers.data(),
+                                          nullptr,
+                                          nullptr};
+      vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                                VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 1, 1, &write);
+    }
+    m_dirty_flags &= ~DIRTY_FLAG_GX_SAMPLERS;
+  }
 }
 
 void StateTracker::UpdateUtilityDescriptorSet()
@@ -654,21 +839,34 @@ void StateTracker::UpdateUtilityDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+    BindDescriptorSets(0, m_utility_descriptor_sets,
+                       std::span(&m_bindings.utility_ubo_offset, 1));
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            1, m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
+    BindDescriptorSets(0, std::span(m_utility_descriptor_sets).first(1),
+                       std::span(&m_bindings.utility_ubo_offset, 1));
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
 }
 
+void StateTracker::BindDescriptorSets(u32 first_set, std::span<const VkDescriptorSet> sets,
+                                      std::span<const u32> dynamic_offsets)
+{
+  const VkPipelineLayout layout = m_pipeline->GetVkPipelineLayout();
+  if (DrawCommandList* const command_list = GetDrawCommandList())
+  {
+    command_list->BindDescriptorSets(layout, first_set, sets, dynamic_offsets);
+    return;
+  }
+
+  vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                          VK_PIPELINE_BIND_POINT_GRAPHICS, layout, first_set,
+                          static_cast<u32>(sets.size()), sets.data(),
+                          static_cast<u32>(dynamic_offsets.size()), dynamic_offsets.data());
+}
+
 void StateTracker::UpdateComputeDescriptorSet()
 {
   // Max number of updates - UBO, Samplers, TexelBuffer, Image
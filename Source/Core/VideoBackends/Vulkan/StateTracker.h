@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <span>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -13,6 +14,8 @@
 
 namespace Vulkan
 {
+class DrawCommandList;
+class DrawRecorder;
 class VKFramebuffer;
 class VKShader;
 class VKPipeline;
@@ -70,6 +73,14 @@ public:
   // If this returns false, you should not issue the draw.
   bool Bind();
 
+  // Record into the current command buffer, or the draw recorder's command list while it is
+  // recording the render pass. Draws must follow a successful Bind().
+  void Draw(u32 num_vertices, u32 base_vertex);
+  void DrawIndexed(u32 num_indices, u32 base_index, u32 base_vertex);
+  void ClearAttachments(std::span<const VkClearAttachment> attachments, const VkClearRect& rect);
+  void BeginQuery(VkQueryPool pool, u32 query, VkQueryControlFlags flags);
+  void EndQuery(VkQueryPool pool, u32 query);
+
   // Binds all dirty compute state to the command buffer.
   // If this returns false, you should not dispatch the shader.
   bool BindCompute();
@@ -112,6 +123,15 @@ private:
 
   bool Initialize();
 
+  // Returns the command list to record into instead of the command buffer, if any.
+  DrawCommandList* GetDrawCommandList() const;
+  void BeginRenderPass(const VkRenderPassBeginInfo& begin_info);
+  // Hands the draws recorded so far to a worker once there are enough of them.
+  void CountDraw();
+
+  // Set dirty flags on all state bound to the command buffer, for when it starts out empty.
+  void InvalidateBoundState();
+
   // Check that the specified viewport is within the render area.
   // If not, ends the render pass if it is a clear render pass.
   bool IsViewportWithinRenderArea() const;
@@ -120,6 +140,8 @@ private:
   void UpdateGXDescriptorSet();
   void UpdateUtilityDescriptorSet();
   void UpdateComputeDescriptorSet();
+  void BindDescriptorSets(u32 first_set, std::span<const VkDescriptorSet> sets,
+                          std::span<const u32> dynamic_offsets);
 
   // Which bindings/state has to be updated before the next draw.
   u32 m_dirty_flags = 0;
@@ -163,5 +185,9 @@ private:
   VKFramebuffer* m_framebuffer = nullptr;
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
   VkRect2D m_framebuffer_render_area = {};
+
+  // Records the render passes of the EFB on worker threads, if enabled.
+  std::unique_ptr<DrawRecorder> m_draw_recorder;
+  bool m_query_active = false;
 };
 }  // namespace Vulkan
@@ -68,8 +68,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
 
     // Ensure the query starts within a render pass.
     StateTracker::GetInstance()->BeginRenderPass();
-    vkCmdBeginQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos,
-                    flags);
+    StateTracker::GetInstance()->BeginQuery(m_query_pool, m_query_next_pos, flags);
   }
 }
 
@@ -77,7 +76,7 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
 {
   if (group == PQG_ZCOMP_ZCOMPLOC || group == PQG_ZCOMP)
   {
-    vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos);
+    StateTracker::GetInstance()->EndQuery(m_query_pool, m_query_next_pos);
     ActiveQuery& entry = m_query_buffer[m_query_next_pos];
     entry.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
 
@@ -4,6 +4,9 @@
 #include "VideoBackends/Vulkan/VKPipeline.h"
 
 #include <array>
+#include <mutex>
+#include <tuple>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/EnumMap.h"
@@ -27,6 +30,33 @@ VKPipeline::VKPipeline(const AbstractPipelineConfig& config, VkPipeline pipeline
 }
 
 VKPipeline::~VKPipeline()
+{
+  if (m_optimized)
+  {
+    // Any pending background compile will destroy its result when it sees the released flag.
+    std::lock_guard lk(m_optimized->mutex);
+    m_optimized->released = true;
+    const VkPipeline optimized_pipeline = m_optimized->pipeline.exchange(VK_NULL_HANDLE);
+    if (optimized_pipeline != VK_NULL_HANDLE)
+      vkDestroyPipeline(g_vulkan_context->GetDevice(), optimized_pipeline, nullptr);
+  }
+
+  vkDestroyPipeline(g_vulkan_context->GetDevice(), m_pipeline, nullptr);
+}
+
+VkPipeline VKPipeline::GetVkPipeline() const
+{
+  if (m_optimized)
+  {
+    const VkPipeline optimized_pipeline = m_optimized->pipeline.load(std::memory_order_acquire);
+    if (optimized_pipeline != VK_NULL_HANDLE)
+      return optimized_pipeline;
+  }
+
+  return m_pipeline;
+}
+
+VKPipelineLibrary::~VKPipelineLibrary()
 {
   vkDestroyPipeline(g_vulkan_context->GetDevice(), m_pipeline, nullptr);
 }
@@ -240,6 +270,277 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
+static VkPipelineInputAssemblyStateCreateInfo
+GetVulkanInputAssemblyState(const RasterizationState& state)
+{
+  static constexpr std::array<VkPrimitiveTopology, 4> vk_primitive_topologies = {
+      {VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
+       VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP}};
+  VkPipelineInputAssemblyStateCreateInfo input_assembly_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, nullptr, 0,
+      vk_primitive_topologies[static_cast<u32>(state.primitive.Value())], VK_FALSE};
+
+  // See Vulkan spec, section 19:
+  // If topology is VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
+  // VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY,
+  // VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY or VK_PRIMITIVE_TOPOLOGY_PATCH_LIST,
+  // primitiveRestartEnable must be VK_FALSE
+  if (g_backend_info.bSupportsPrimitiveRestart &&
+      IsStripPrimitiveTopology(input_assembly_state.topology))
+  {
+    input_assembly_state.primitiveRestartEnable = VK_TRUE;
+  }
+
+  return input_assembly_state;
+}
+
+static VkPipelineShaderStageCreateInfo GetVulkanShaderStage(VkShaderStageFlagBits stage,
+                                                            const AbstractShader* shader)
+{
+  return {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+          nullptr,
+          0,
+          stage,
+          static_cast<const VKShader*>(shader)->GetShaderModule(),
+          "main"};
+}
+
+static const VkPipelineViewportStateCreateInfo& GetVulkanViewportState()
+{
+  static const VkDepthClampRangeEXT clamp_range = {0.0f, MAX_EFB_DEPTH};
+  static const VkPipelineViewportDepthClampControlCreateInfoEXT depth_clamp_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLAMP_CONTROL_CREATE_INFO_EXT, nullptr,
+      VK_DEPTH_CLAMP_MODE_USER_DEFINED_RANGE_EXT,  // VkDepthClampModeEXT            depthClampMode
+      &clamp_range  // const VkDepthClampRangeEXT*    pDepthClampRange
+  };
+
+  // This viewport isn't used, but needs to be specified anyway.
+  static const VkViewport viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
+  static const VkRect2D scissor = {{0, 0}, {1, 1}};
+  static const VkPipelineViewportStateCreateInfo viewport_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+      &depth_clamp_state,
+      0,          // VkPipelineViewportStateCreateFlags    flags;
+      1,          // uint32_t                              viewportCount
+      &viewport,  // const VkViewport*                     pViewports
+      1,          // uint32_t                              scissorCount
+      &scissor    // const VkRect2D*                       pScissors
+  };
+
+  return viewport_state;
+}
+
+static const VkPipelineDynamicStateCreateInfo& GetVulkanDynamicState()
+{
+  // Set viewport and scissor dynamic state so we can change it elsewhere.
+  static const std::array<VkDynamicState, 2> dynamic_states{
+      VK_DYNAMIC_STATE_VIEWPORT,
+      VK_DYNAMIC_STATE_SCISSOR,
+  };
+  static const VkPipelineDynamicStateCreateInfo dynamic_state = {
+      VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr,
+      0,                                        // VkPipelineDynamicStateCreateFlags    flags
+      static_cast<u32>(dynamic_states.size()),  // uint32_t dynamicStateCount
+      dynamic_states.data()  // const VkDynamicState*                pDynamicStates
+  };
+
+  return dynamic_state;
+}
+
+static std::vector<VkPipelineColorBlendAttachmentState>
+GetVulkanAttachmentBlendStates(const AbstractPipelineConfig& config)
+{
+  const VkPipelineColorBlendAttachmentState blend_attachment_state =
+      GetVulkanAttachmentBlendState(config.blending_state, config.usage);
+
+  std::vector<VkPipelineColorBlendAttachmentState> blend_attachment_states;
+  blend_attachment_states.push_back(blend_attachment_state);
+  // Right now all our attachments have the same state
+  for (u8 i = 0; i < static_cast<u8>(config.framebuffer_state.additional_color_attachment_count);
+       i++)
+  {
+    blend_attachment_states.push_back(blend_attachment_state);
+  }
+  return blend_attachment_states;
+}
+
+static VkPipeline CreatePipelineLibrary(VkGraphicsPipelineLibraryFlagsEXT part,
+                                        VkGraphicsPipelineCreateInfo pipeline_info)
+{
+  const VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr, part};
+  pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pipeline_info.pNext = &library_info;
+  pipeline_info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                        VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+  pipeline_info.basePipelineIndex = -1;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &pipeline_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines (library) failed: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
+VkPipeline VKPipeline::LinkLibraries(const LibraryArray& libraries,
+                                     VkPipelineLayout pipeline_layout, bool optimize)
+{
+  std::array<VkPipeline, std::tuple_size_v<LibraryArray>> library_pipelines;
+  for (size_t i = 0; i < libraries.size(); i++)
+    library_pipelines[i] = libraries[i]->GetVkPipeline();
+
+  const VkPipelineLibraryCreateInfoKHR library_info = {
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, nullptr,
+      static_cast<u32>(library_pipelines.size()), library_pipelines.data()};
+
+  VkGraphicsPipelineCreateInfo pipeline_info = {};
+  pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pipeline_info.pNext = &library_info;
+  pipeline_info.flags = optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+  pipeline_info.layout = pipeline_layout;
+  pipeline_info.basePipelineIndex = -1;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &pipeline_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines (link) failed: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
+std::unique_ptr<VKPipeline> VKPipeline::CreateFromLibraries(const AbstractPipelineConfig& config,
+                                                            VkPipelineLayout pipeline_layout,
+                                                            VkRenderPass render_pass)
+{
+  const VertexFormat* vertex_format = static_cast<const VertexFormat*>(config.vertex_format);
+  const VKShader* vertex_shader = static_cast<const VKShader*>(config.vertex_shader);
+  const VKShader* geometry_shader = static_cast<const VKShader*>(config.geometry_shader);
+  const VKShader* pixel_shader = static_cast<const VKShader*>(config.pixel_shader);
+  const VkPipelineMultisampleStateCreateInfo multisample_state =
+      GetVulkanMultisampleState(config.framebuffer_state);
+
+  LibraryArray libraries;
+  libraries[0] = g_object_cache->GetVertexInputLibrary(
+      vertex_format->GetVertexDeclaration(), config.rasterization_state.primitive, [&] {
+        const VkPipelineInputAssemblyStateCreateInfo input_assembly_state =
+            GetVulkanInputAssemblyState(config.rasterization_state);
+
+        VkGraphicsPipelineCreateInfo pipeline_info = {};
+        pipeline_info.pVertexInputState = &vertex_format->GetVertexInputStateInfo();
+        pipeline_info.pInputAssemblyState = &input_assembly_state;
+        return CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+                                     pipeline_info);
+      });
+
+  libraries[1] = g_object_cache->GetPreRasterizationLibrary(
+      vertex_shader, geometry_shader, config.rasterization_state, pipeline_layout, render_pass,
+      [&] {
+        std::array<VkPipelineShaderStageCreateInfo, 2> shader_stages;
+        u32 num_shader_stages = 0;
+        shader_stages[num_shader_stages++] =
+            GetVulkanShaderStage(VK_SHADER_STAGE_VERTEX_BIT, vertex_shader);
+        if (geometry_shader)
+        {
+          shader_stages[num_shader_stages++] =
+              GetVulkanShaderStage(VK_SHADER_STAGE_GEOMETRY_BIT, geometry_shader);
+        }
+        const VkPipelineRasterizationStateCreateInfo rasterization_state =
+            GetVulkanRasterizationState(config.rasterization_state);
+
+        VkGraphicsPipelineCreateInfo pipeline_info = {};
+        pipeline_info.stageCount = num_shader_stages;
+        pipeline_info.pStages = shader_stages.data();
+        pipeline_info.pViewportState = &GetVulkanViewportState();
+        pipeline_info.pRasterizationState = &rasterization_state;
+        pipeline_info.pDynamicState = &GetVulkanDynamicState();
+        pipeline_info.layout = pipeline_layout;
+        pipeline_info.renderPass = render_pass;
+        return CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                                     pipeline_info);
+      });
+
+  libraries[2] = g_object_cache->GetFragmentShaderLibrary(
+      pixel_shader, config.depth_state, config.framebuffer_state, pipeline_layout, render_pass,
+      [&] {
+        const VkPipelineShaderStageCreateInfo shader_stage =
+            GetVulkanShaderStage(VK_SHADER_STAGE_FRAGMENT_BIT, pixel_shader);
+        const VkPipelineDepthStencilStateCreateInfo depth_stencil_state =
+            GetVulkanDepthStencilState(config.depth_state);
+
+        VkGraphicsPipelineCreateInfo pipeline_info = {};
+        pipeline_info.stageCount = 1;
+        pipeline_info.pStages = &shader_stage;
+        pipeline_info.pMultisampleState = &multisample_state;
+        pipeline_info.pDepthStencilState = &depth_stencil_state;
+        pipeline_info.layout = pipeline_layout;
+        pipeline_info.renderPass = render_pass;
+        return CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+                                     pipeline_info);
+      });
+
+  libraries[3] = g_object_cache->GetFragmentOutputLibrary(
+      config.blending_state, config.framebuffer_state, render_pass, [&] {
+        const std::vector<VkPipelineColorBlendAttachmentState> blend_attachment_states =
+            GetVulkanAttachmentBlendStates(config);
+        const VkPipelineColorBlendStateCreateInfo blend_state =
+            GetVulkanColorBlendState(config.blending_state, blend_attachment_states.data(),
+                                     static_cast<uint32_t>(blend_attachment_states.size()));
+
+        VkGraphicsPipelineCreateInfo pipeline_info = {};
+        pipeline_info.pMultisampleState = &multisample_state;
+        pipeline_info.pColorBlendState = &blend_state;
+        pipeline_info.renderPass = render_pass;
+        return CreatePipelineLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+                                     pipeline_info);
+      });
+
+  if (!libraries[0] || !libraries[1] || !libraries[2] || !libraries[3])
+    return nullptr;
+
+  // Fast-link the libraries without optimization so the pipeline can be used immediately.
+  const VkPipeline pipeline = LinkLibraries(libraries, pipeline_layout, false);
+  if (pipeline == VK_NULL_HANDLE)
+    return nullptr;
+
+  auto vk_pipeline = std::make_unique<VKPipeline>(config, pipeline, pipeline_layout, config.usage);
+  vk_pipeline->m_optimized = std::make_shared<OptimizedPipeline>();
+
+  // Compile the link-time optimized pipeline in the background. It replaces the fast-linked
+  // pipeline the next time this pipeline is bound after it completes.
+  g_object_cache->QueuePipelineOptimization(
+      [optimized = vk_pipeline->m_optimized, libraries, pipeline_layout] {
+        {
+          std::lock_guard lk(optimized->mutex);
+          if (optimized->released)
+            return;
+        }
+
+        const VkPipeline optimized_pipeline = LinkLibraries(libraries, pipeline_layout, true);
+
+        std::lock_guard lk(optimized->mutex);
+        if (optimized->released)
+        {
+          if (optimized_pipeline != VK_NULL_HANDLE)
+            vkDestroyPipeline(g_vulkan_context->GetDevice(), optimized_pipeline, nullptr);
+          return;
+        }
+        optimized->pipeline.store(optimized_pipeline, std::memory_order_release);
+      });
+
+  return vk_pipeline;
+}
+
 std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
@@ -275,6 +576,17 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
     return nullptr;
   }
 
+  // GX pipelines are linked from separately compiled parts when graphics pipeline libraries are
+  // supported, as new combinations of vertex format and render state are common. Should linking
+  // fail for any reason, fall back to creating the whole pipeline at once.
+  if (g_vulkan_context->SupportsGraphicsPipelineLibrary() &&
+      config.usage != AbstractPipelineUsage::Utility && config.vertex_format)
+  {
+    auto pipeline = CreateFromLibraries(config, pipeline_layout, render_pass);
+    if (pipeline)
+      return pipeline;
+  }
+
   // Declare descriptors for empty vertex buffers/attributes
   static const VkPipelineVertexInputStateCreateInfo empty_vertex_input_state = {
       VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,  // VkStructureType sType
@@ -293,57 +605,26 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
           empty_vertex_input_state;
 
   // Input assembly
-  static constexpr std::array<VkPrimitiveTopology, 4> vk_primitive_topologies = {
-      {VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
-       VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP}};
-  VkPipelineInputAssemblyStateCreateInfo input_assembly_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, nullptr, 0,
-      vk_primitive_topologies[static_cast<u32>(config.rasterization_state.primitive.Value())],
-      VK_FALSE};
-
-  // See Vulkan spec, section 19:
-  // If topology is VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
-  // VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY,
-  // VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY or VK_PRIMITIVE_TOPOLOGY_PATCH_LIST,
-  // primitiveRestartEnable must be VK_FALSE
-  if (g_backend_info.bSupportsPrimitiveRestart &&
-      IsStripPrimitiveTopology(input_assembly_state.topology))
-  {
-    input_assembly_state.primitiveRestartEnable = VK_TRUE;
-  }
+  const VkPipelineInputAssemblyStateCreateInfo input_assembly_state =
+      GetVulkanInputAssemblyState(config.rasterization_state);
 
   // Shaders to stages
   VkPipelineShaderStageCreateInfo shader_stages[3];
   uint32_t num_shader_stages = 0;
   if (config.vertex_shader)
   {
-    shader_stages[num_shader_stages++] = {
-        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-        nullptr,
-        0,
-        VK_SHADER_STAGE_VERTEX_BIT,
-        static_cast<const VKShader*>(config.vertex_shader)->GetShaderModule(),
-        "main"};
+    shader_stages[num_shader_stages++] =
+        GetVulkanShaderStage(VK_SHADER_STAGE_VERTEX_BIT, config.vertex_shader);
   }
   if (config.geometry_shader)
   {
-    shader_stages[num_shader_stages++] = {
-        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-        nullptr,
-        0,
-        VK_SHADER_STAGE_GEOMETRY_BIT,
-        static_cast<const VKShader*>(config.geometry_shader)->GetShaderModule(),
-        "main"};
+    shader_stages[num_shader_stages++] =
+        GetVulkanShaderStage(VK_SHADER_STAGE_GEOMETRY_BIT, config.geometry_shader);
   }
   if (config.pixel_shader)
   {
-    shader_stages[num_shader_stages++] = {
-        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-        nullptr,
-        0,
-        VK_SHADER_STAGE_FRAGMENT_BIT,
-        static_cast<const VKShader*>(config.pixel_shader)->GetShaderModule(),
-        "main"};
+    shader_stages[num_shader_stages++] =
+        GetVulkanShaderStage(VK_SHADER_STAGE_FRAGMENT_BIT, config.pixel_shader);
   }
 
   // Fill in Vulkan descriptor structs from our state structures.
@@ -353,52 +634,13 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       GetVulkanMultisampleState(config.framebuffer_state);
   VkPipelineDepthStencilStateCreateInfo depth_stencil_state =
       GetVulkanDepthStencilState(config.depth_state);
-  VkPipelineColorBlendAttachmentState blend_attachment_state =
-      GetVulkanAttachmentBlendState(config.blending_state, config.usage);
-
-  std::vector<VkPipelineColorBlendAttachmentState> blend_attachment_states;
-  blend_attachment_states.push_back(blend_attachment_state);
-  // Right now all our attachments have the same state
-  for (u8 i = 0; i < static_cast<u8>(config.framebuffer_state.additional_color_attachment_count);
-       i++)
-  {
-    blend_attachment_states.push_back(blend_attachment_state);
-  }
+  const std::vector<VkPipelineColorBlendAttachmentState> blend_attachment_states =
+      GetVulkanAttachmentBlendStates(config);
   VkPipelineColorBlendStateCreateInfo blend_state =
       GetVulkanColorBlendState(config.blending_state, blend_attachment_states.data(),
                                static_cast<uint32_t>(blend_attachment_states.size()));
-
-  static const VkDepthClampRangeEXT clamp_range = {0.0f, MAX_EFB_DEPTH};
-  static const VkPipelineViewportDepthClampControlCreateInfoEXT depth_clamp_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLAMP_CONTROL_CREATE_INFO_EXT, nullptr,
-      VK_DEPTH_CLAMP_MODE_USER_DEFINED_RANGE_EXT,  // VkDepthClampModeEXT            depthClampMode
-      &clamp_range  // const VkDepthClampRangeEXT*    pDepthClampRange
-  };
-
-  // This viewport isn't used, but needs to be specified anyway.
-  static const VkViewport viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
-  static const VkRect2D scissor = {{0, 0}, {1, 1}};
-  static const VkPipelineViewportStateCreateInfo viewport_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
-      &depth_clamp_state,
-      0,          // VkPipelineViewportStateCreateFlags    flags;
-      1,          // uint32_t                              viewportCount
-      &viewport,  // const VkViewport*                     pViewports
-      1,          // uint32_t                              scissorCount
-      &scissor    // const VkRect2D*                       pScissors
-  };
-
-  // Set viewport and scissor dynamic state so we can change it elsewhere.
-  static const std::array<VkDynamicState, 2> dynamic_states{
-      VK_DYNAMIC_STATE_VIEWPORT,
-      VK_DYNAMIC_STATE_SCISSOR,
-  };
-  static const VkPipelineDynamicStateCreateInfo dynamic_state = {
-      VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr,
-      0,                                        // VkPipelineDynamicStateCreateFlags    flags
-      static_cast<u32>(dynamic_states.size()),  // uint32_t dynamicStateCount
-      dynamic_states.data()  // const VkDynamicState*                pDynamicStates
-  };
+  const VkPipelineViewportStateCreateInfo& viewport_state = GetVulkanViewportState();
+  const VkPipelineDynamicStateCreateInfo& dynamic_state = GetVulkanDynamicState();
 
   // Combine to full pipeline info structure.
   VkGraphicsPipelineCreateInfo pipeline_info = {
@@ -3,13 +3,35 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "VideoBackends/Vulkan/VulkanLoader.h"
 #include "VideoCommon/AbstractPipeline.h"
 
 namespace Vulkan
 {
+// One part of a graphics pipeline, created with VK_EXT_graphics_pipeline_library. Libraries are
+// shared between pipelines, and kept alive by every pipeline which is linked from them.
+class VKPipelineLibrary
+{
+public:
+  explicit VKPipelineLibrary(VkPipeline pipeline) : m_pipeline(pipeline) {}
+  ~VKPipelineLibrary();
+
+  VKPipelineLibrary(const VKPipelineLibrary&) = delete;
+  VKPipelineLibrary& operator=(const VKPipelineLibrary&) = delete;
+
+  VkPipeline GetVkPipeline() const { return m_pipeline; }
+
+private:
+  VkPipeline m_pipeline;
+};
+
+using VKPipelineLibraryPtr = std::shared_ptr<VKPipelineLibrary>;
+
 class VKPipeline final : public AbstractPipeline
 {
 public:
@@ -17,15 +39,36 @@ public:
                       VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage);
   ~VKPipeline() override;
 
-  VkPipeline GetVkPipeline() const { return m_pipeline; }
+  // For pipelines linked from libraries, returns the link-time optimized pipeline once it has been
+  // compiled in the background, otherwise the pipeline which was created up front.
+  VkPipeline GetVkPipeline() const;
   VkPipelineLayout GetVkPipelineLayout() const { return m_pipeline_layout; }
   AbstractPipelineUsage GetUsage() const { return m_usage; }
   static std::unique_ptr<VKPipeline> Create(const AbstractPipelineConfig& config);
 
 private:
+  // Vertex input, pre-rasterization shaders, fragment shader, fragment output.
+  using LibraryArray = std::array<VKPipelineLibraryPtr, 4>;
+
+  // Shared with the background thread which compiles the optimized pipeline, so that the
+  // pipeline can be destroyed while the compile is still pending.
+  struct OptimizedPipeline
+  {
+    std::mutex mutex;
+    std::atomic<VkPipeline> pipeline{VK_NULL_HANDLE};
+    bool released = false;
+  };
+
+  static std::unique_ptr<VKPipeline> CreateFromLibraries(const AbstractPipelineConfig& config,
+                                                         VkPipelineLayout pipeline_layout,
+                                                         VkRenderPass render_pass);
+  static VkPipeline LinkLibraries(const LibraryArray& libraries, VkPipelineLayout pipeline_layout,
+                                  bool optimize);
+
   VkPipeline m_pipeline;
   VkPipelineLayout m_pipeline_layout;
   AbstractPipelineUsage m_usage;
+  std::shared_ptr<OptimizedPipeline> m_optimized;
 };
 
 }  // namespace Vulkan
@@ -47,6 +47,9 @@ VKShader::VKShader(std::vector<u32> spv, VkPipeline compute_pipeline, std::strin
 
 VKShader::~VKShader()
 {
+  if (m_stage != ShaderStage::Compute && g_object_cache)
+    g_object_cache->ReleasePipelineLibraries(this);
+
   if (m_stage != ShaderStage::Compute)
     vkDestroyShaderModule(g_vulkan_context->GetDevice(), m_module, nullptr);
   else
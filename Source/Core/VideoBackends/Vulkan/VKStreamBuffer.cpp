@@ -88,7 +88,7 @@ bool StreamBuffer::AllocateBuffer()
   return true;
 }
 
-bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
+bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment, bool wait_for_space)
 {
   const u32 required_bytes = num_bytes + alignment;
 
@@ -142,7 +142,7 @@ bool StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
   }
 
   // Can we find a fence to wait on that will give us enough memory?
-  if (WaitForClearSpace(required_bytes))
+  if (wait_for_space && WaitForClearSpace(required_bytes))
   {
     m_current_offset = Common::AlignUp(m_current_offset, alignment);
     m_last_allocation_size = num_bytes;
@@ -24,7 +24,8 @@ public:
   u8* GetCurrentHostPointer() const { return m_host_pointer + m_current_offset; }
   u32 GetCurrentSize() const { return m_size; }
   u32 GetCurrentOffset() const { return m_current_offset; }
-  bool ReserveMemory(u32 num_bytes, u32 alignment);
+  // When wait_for_space is false, returns false instead of waiting for the GPU to release memory.
+  bool ReserveMemory(u32 num_bytes, u32 alignment, bool wait_for_space = true);
   void CommitMemory(u32 final_num_bytes);
 
   static std::unique_ptr<StreamBuffer> Create(VkBufferUsageFlags usage, u32 size);
@@ -385,10 +385,21 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   VkBuffer upload_buffer;
   VkDeviceSize upload_buffer_offset;
 
-  // Does this texture data fit within the streaming buffer?
-  if (upload_size <= STAGING_TEXTURE_UPLOAD_THRESHOLD)
+  // Does this texture data fit within the streaming buffer? Larger textures are still placed in
+  // the streaming buffer when there is space available without waiting on the GPU, so that a
+  // batch of uploads in one command buffer does not need a separate allocation for each.
+  StreamBuffer* stream_buffer = g_object_cache->GetTextureUploadBuffer();
+  if (upload_size > STAGING_TEXTURE_UPLOAD_THRESHOLD &&
+      upload_size <= STAGING_TEXTURE_UPLOAD_OPPORTUNISTIC_LIMIT &&
+      stream_buffer->ReserveMemory(upload_size, upload_alignment, false))
+  {
+    upload_buffer = stream_buffer->GetBuffer();
+    upload_buffer_offset = stream_buffer->GetCurrentOffset();
+    std::memcpy(stream_buffer->GetCurrentHostPointer(), buffer, upload_size);
+    stream_buffer->CommitMemory(upload_size);
+  }
+  else if (upload_size <= STAGING_TEXTURE_UPLOAD_THRESHOLD)
   {
-    StreamBuffer* stream_buffer = g_object_cache->GetTextureUploadBuffer();
     if (!stream_buffer->ReserveMemory(upload_size, upload_alignment))
     {
       // Execute the command buffer first.
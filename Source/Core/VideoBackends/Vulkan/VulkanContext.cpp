@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <string_view>
 
 #include "Common/Assert.h"
 #include "Common/Contains.h"
@@ -61,6 +62,32 @@ VulkanContext::PhysicalDeviceInfo::PhysicalDeviceInfo(VkPhysicalDevice device)
 
     subgroupSize = properties_subgroup.subgroupSize;
 
+    // VK_EXT_graphics_pipeline_library lets us build pipelines by linking independently compiled
+    // parts. Only query the feature when the device advertises the extension.
+    if (vkGetPhysicalDeviceFeatures2)
+    {
+      u32 extension_count = 0;
+      vkEnumerateDeviceExtensionProperties(device, nullptr, &extension_count, nullptr);
+      std::vector<VkExtensionProperties> extensions(extension_count);
+      vkEnumerateDeviceExtensionProperties(device, nullptr, &extension_count, extensions.data());
+      const auto has_extension = [&extensions](std::string_view name) {
+        return Common::Contains(extensions, name, &VkExtensionProperties::extensionName);
+      };
+
+      if (has_extension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+          has_extension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+      {
+        VkPhysicalDeviceFeatures2 features2 = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT features_gpl = {};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features_gpl.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+        InsertIntoChain(&features2, &features_gpl);
+        vkGetPhysicalDeviceFeatures2(device, &features2);
+        graphicsPipelineLibrary = features_gpl.graphicsPipelineLibrary != VK_FALSE;
+      }
+    }
+
     // We require basic ops (for gl_SubgroupInvocationID), ballot (for subgroupBallot,
     // subgroupBallotFindLSB), and arithmetic (for subgroupMin/subgroupMax).
     // Shuffle is enabled as a workaround until SPIR-V >= 1.5 is enabled with broadcast(uniform)
@@ -674,6 +701,18 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
         AddExtension(VK_EXT_DEPTH_RANGE_UNRESTRICTED_EXTENSION_NAME, false);
   }
 
+  if (m_device_info.graphicsPipelineLibrary)
+  {
+    m_device_info.graphicsPipelineLibrary =
+        AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false) &&
+        AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false);
+    if (m_device_info.graphicsPipelineLibrary)
+      INFO_LOG_FMT(VIDEO, "Using VK_EXT_graphics_pipeline_library for fast pipeline linking.");
+  }
+
+  // Samplers change between most draws, pushing them skips allocating and writing a new set.
+  m_device_info.pushDescriptors = AddExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, false);
+
   return true;
 }
 
@@ -806,6 +845,14 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   VkPhysicalDeviceFeatures device_features = m_device_info.features();
   device_info.pEnabledFeatures = &device_features;
 
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT gpl_features = {};
+  if (m_device_info.graphicsPipelineLibrary)
+  {
+    gpl_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    gpl_features.graphicsPipelineLibrary = VK_TRUE;
+    InsertIntoChain(&device_info, &gpl_features);
+  }
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -54,6 +54,8 @@ public:
     bool depthClamp;
     bool textureCompressionBC;
     bool shaderSubgroupOperations = false;
+    bool graphicsPipelineLibrary = false;
+    bool pushDescriptors = false;
   };
 
   VulkanContext(VkInstance instance, VkPhysicalDevice physical_device);
@@ -108,6 +110,8 @@ public:
   bool SupportsPreciseOcclusionQueries() const { return m_device_info.occlusionQueryPrecise; }
   u32 GetShaderSubgroupSize() const { return m_device_info.subgroupSize; }
   bool SupportsShaderSubgroupOperations() const { return m_device_info.shaderSubgroupOperations; }
+  bool SupportsGraphicsPipelineLibrary() const { return m_device_info.graphicsPipelineLibrary; }
+  bool SupportsPushDescriptors() const { return m_device_info.pushDescriptors; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
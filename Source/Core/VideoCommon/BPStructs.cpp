@@ -14,6 +14,7 @@
 #include "Common/EnumMap.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
@@ -364,7 +365,8 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
         const u64 ticks = system.GetCoreTiming().GetTicks();
 
         // below div two to convert from bytes to pixels - it expects width, not stride
-        g_presenter->ImmediateSwap(destAddr, destStride / 2, destStride, height, ticks);
+        if (!Core::GetIsPresentationSuppressed())
+          g_presenter->ImmediateSwap(destAddr, destStride / 2, destStride, height, ticks);
       }
       else
       {
@@ -386,7 +386,7 @@ void CommandProcessorManager::GatherPipeBursted()
 
   m_fifo.CPReadWriteDistance.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
 
-  m_system.GetFifo().RunGpu();
+  m_system.GetFifo().RunGpuForGatherPipe();
 
   ASSERT_MSG(COMMANDPROCESSOR,
              m_fifo.CPReadWriteDistance.load(std::memory_order_relaxed) <=
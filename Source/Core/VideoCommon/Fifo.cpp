@@ -3,13 +3,13 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
 #include "Common/Assert.h"
 #include "Common/BlockingLoop.h"
 #include "Common/ChunkFile.h"
-#include "Common/Event.h"
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
@@ -19,6 +19,7 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/GPFifo.h"
 #include "Core/HW/Memmap.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
 #include "Core/System.h"
 
@@ -28,6 +29,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -36,6 +38,12 @@ namespace Fifo
 {
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// Adaptive SyncGPU scales the configured distances by at most this much in either direction.
+static constexpr float SYNC_GPU_MIN_DISTANCE_SCALE = 0.25f;
+static constexpr float SYNC_GPU_MAX_DISTANCE_SCALE = 4.0f;
+// The distances are widened while the CPU thread stalls for more than this fraction of the time.
+static constexpr double SYNC_GPU_TARGET_STALL_FRACTION = 0.01;
+
 FifoManager::FifoManager(Core::System& system) : m_system{system}
 {
 }
@@ -48,6 +56,19 @@ void FifoManager::RefreshConfig()
   m_config_sync_gpu_max_distance = Config::Get(Config::MAIN_SYNC_GPU_MAX_DISTANCE);
   m_config_sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
   m_config_sync_gpu_overclock = Config::Get(Config::MAIN_SYNC_GPU_OVERCLOCK);
+  m_config_sync_gpu_adaptive = Config::Get(Config::MAIN_SYNC_GPU_ADAPTIVE);
+
+  // The CPU thread picks up the new distances the next time it updates them.
+  m_config_sync_gpu_changed.store(true, std::memory_order_release);
+  if (!m_config_sync_gpu)
+    g_perf_metrics.SetSyncGPUState(0, 0, 0, 0.0);
+}
+
+void FifoManager::ApplySyncGPUDistances()
+{
+  const float scale = m_sync_gpu_distance_scale;
+  m_sync_gpu_max_distance.store(static_cast<int>(m_config_sync_gpu_max_distance * scale));
+  m_sync_gpu_min_distance.store(static_cast<int>(m_config_sync_gpu_min_distance * scale));
 }
 
 void FifoManager::DoState(PointerWrap& p)
@@ -98,6 +119,15 @@ void FifoManager::Init()
   if (m_system.IsDualCoreMode())
     m_gpu_mainloop.Prepare();
   m_sync_ticks.store(0);
+
+  m_sync_gpu_distance_scale = 1.0f;
+  m_config_sync_gpu_changed.store(false, std::memory_order_relaxed);
+  ApplySyncGPUDistances();
+  m_sync_gpu_window_ticks = 0;
+  m_sync_gpu_window_lag = 0;
+  m_sync_gpu_window_samples = 0;
+  m_sync_gpu_window_stall_time = DT::zero();
+  m_sync_gpu_window_start = Clock::now();
 }
 
 void FifoManager::Shutdown()
@@ -150,6 +180,7 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
+    WakeupGpuForPreprocessedData();
     m_gpu_mainloop.Wait();
     if (!m_gpu_mainloop.IsRunning())
       return;
@@ -324,7 +355,7 @@ void FifoManager::RunGpuLoop()
                  fifo.CPReadWriteDistance.load(std::memory_order_relaxed) &&
                  !AtBreakpoint(m_system))
           {
-            if (m_config_sync_gpu && m_sync_ticks.load() < m_config_sync_gpu_min_distance)
+            if (m_config_sync_gpu && m_sync_ticks.load() < m_sync_gpu_min_distance.load())
               break;
 
             u32 cyclesExecuted = 0;
@@ -362,8 +393,8 @@ void FifoManager::RunGpuLoop()
             {
               cyclesExecuted = (int)(cyclesExecuted / m_config_sync_gpu_overclock);
               int old = m_sync_ticks.fetch_sub(cyclesExecuted);
-              if (old >= m_config_sync_gpu_max_distance &&
-                  old - (int)cyclesExecuted < m_config_sync_gpu_max_distance)
+              const int max_distance = m_sync_gpu_max_distance.load();
+              if (old >= max_distance && old - (int)cyclesExecuted < max_distance)
               {
                 m_sync_wakeup_event.Set();
               }
@@ -380,7 +411,7 @@ void FifoManager::RunGpuLoop()
           if (m_sync_ticks.load() > 0)
           {
             int old = m_sync_ticks.exchange(0);
-            if (old >= m_config_sync_gpu_max_distance)
+            if (old >= m_sync_gpu_max_distance.load())
               m_sync_wakeup_event.Set();
           }
 
@@ -440,6 +471,29 @@ void FifoManager::RunGpu()
   }
 }
 
+void FifoManager::RunGpuForGatherPipe()
+{
+  // The GPU thread stops running as soon as it is less than the min distance behind the CPU, so
+  // there is no point in waking it up before WaitForGpuThread would.
+  if (m_system.IsDualCoreMode() && !m_use_deterministic_gpu_thread && m_config_sync_gpu &&
+      !m_syncing_suspended &&
+      m_sync_ticks.load() < m_sync_gpu_min_distance.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  RunGpu();
+}
+
+void FifoManager::WakeupGpuForPreprocessedData()
+{
+  if (m_preprocessed_bytes_since_wakeup == 0)
+    return;
+
+  m_preprocessed_bytes_since_wakeup = 0;
+  m_gpu_mainloop.Wakeup();
+}
+
 int FifoManager::RunGpuOnCpu(int ticks)
 {
   auto& command_processor = m_system.GetCommandProcessor();
@@ -453,7 +507,9 @@ int FifoManager::RunGpuOnCpu(int ticks)
     if (m_use_deterministic_gpu_thread)
     {
       ReadDataFromFifoOnCPU(fifo.CPReadPointer.load(std::memory_order_relaxed));
-      m_gpu_mainloop.Wakeup();
+      m_preprocessed_bytes_since_wakeup += GPFifo::GATHER_PIPE_SIZE;
+      if (m_preprocessed_bytes_since_wakeup >= GPU_WAKEUP_BATCH_SIZE)
+        WakeupGpuForPreprocessedData();
     }
     else
     {
@@ -485,6 +541,7 @@ int FifoManager::RunGpuOnCpu(int ticks)
   }
 
   command_processor.SetCPStatusFromGPU();
+  WakeupGpuForPreprocessedData();
 
   if (reset_simd_state)
   {
@@ -522,6 +579,9 @@ void FifoManager::UpdateWantDeterminism(bool want)
 
   gpu_thread = gpu_thread && m_system.IsDualCoreMode();
 
+  // Go back to the configured SyncGPU distances, so that every run uses the same ones.
+  m_want_determinism = want;
+
   if (m_use_deterministic_gpu_thread != gpu_thread)
   {
     m_use_deterministic_gpu_thread = gpu_thread;
@@ -542,6 +602,17 @@ void FifoManager::UpdateWantDeterminism(bool want)
  */
 int FifoManager::WaitForGpuThread(int ticks)
 {
+  m_sync_gpu_window_ticks += ticks;
+  m_sync_gpu_window_lag += m_sync_ticks.load(std::memory_order_relaxed);
+  ++m_sync_gpu_window_samples;
+
+  // This has to happen before m_sync_ticks is changed below, see m_sync_gpu_max_distance.
+  if (m_sync_gpu_window_ticks >= m_system.GetSystemTimers().GetTicksPerSecond() / 10)
+    UpdateSyncGPUController();
+
+  const int min_distance = m_sync_gpu_min_distance.load(std::memory_order_relaxed);
+  const int max_distance = m_sync_gpu_max_distance.load(std::memory_order_relaxed);
+
   int old = m_sync_ticks.fetch_add(ticks);
   int now = old + ticks;
 
@@ -550,20 +621,76 @@ int FifoManager::WaitForGpuThread(int ticks)
     return -1;
 
   // Wakeup GPU
-  if (old < m_config_sync_gpu_min_distance && now >= m_config_sync_gpu_min_distance)
+  if (old < min_distance && now >= min_distance)
     RunGpu();
 
   // If the GPU is still sleeping, wait for a longer time
-  if (now < m_config_sync_gpu_min_distance)
-    return GPU_TIME_SLOT_SIZE + m_config_sync_gpu_min_distance - now;
+  if (now < min_distance)
+    return GPU_TIME_SLOT_SIZE + min_distance - now;
 
   // Wait for GPU
-  if (now >= m_config_sync_gpu_max_distance)
+  if (now >= max_distance)
+  {
+    const TimePoint stall_start = Clock::now();
     m_sync_wakeup_event.Wait();
+    const DT stall = Clock::now() - stall_start;
+
+    m_sync_gpu_window_stall_time += stall;
+    g_perf_metrics.CountSyncGPUStall(stall);
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
 
+void FifoManager::UpdateSyncGPUController()
+{
+  const TimePoint now = Clock::now();
+  const DT window_time = now - m_sync_gpu_window_start;
+  const double stall_fraction =
+      window_time > DT::zero() ? DT_s(m_sync_gpu_window_stall_time) / DT_s(window_time) : 0.0;
+  const int average_lag = static_cast<int>(m_sync_gpu_window_lag / m_sync_gpu_window_samples);
+
+  const int old_min_distance = m_sync_gpu_min_distance.load(std::memory_order_relaxed);
+  const int old_max_distance = m_sync_gpu_max_distance.load(std::memory_order_relaxed);
+
+  float scale = m_sync_gpu_distance_scale;
+  if (m_config_sync_gpu_changed.exchange(false, std::memory_order_acquire))
+    scale = 1.0f;
+
+  if (!m_config_sync_gpu_adaptive || m_want_determinism)
+  {
+    scale = 1.0f;
+  }
+  else if (stall_fraction > SYNC_GPU_TARGET_STALL_FRACTION)
+  {
+    // Let the CPU thread run further ahead before it has to wait.
+    scale = std::min(scale * 1.25f, SYNC_GPU_MAX_DISTANCE_SCALE);
+  }
+  else if (m_sync_gpu_window_stall_time == DT::zero() && average_lag < old_max_distance / 2)
+  {
+    // The GPU thread keeps up easily, so keep it closer to the CPU thread again.
+    scale = std::max(scale * 0.95f, SYNC_GPU_MIN_DISTANCE_SCALE);
+  }
+
+  m_sync_gpu_distance_scale = scale;
+  ApplySyncGPUDistances();
+
+  // The GPU thread may have stopped short of a min distance that is lower now, in which case the
+  // CPU thread wouldn't wake it up again before waiting for it.
+  if (m_sync_gpu_min_distance.load(std::memory_order_relaxed) < old_min_distance)
+    RunGpu();
+
+  g_perf_metrics.SetSyncGPUState(m_sync_gpu_min_distance.load(std::memory_order_relaxed),
+                                 m_sync_gpu_max_distance.load(std::memory_order_relaxed),
+                                 average_lag, stall_fraction);
+
+  m_sync_gpu_window_ticks = 0;
+  m_sync_gpu_window_lag = 0;
+  m_sync_gpu_window_samples = 0;
+  m_sync_gpu_window_stall_time = DT::zero();
+  m_sync_gpu_window_start = now;
+}
+
 void FifoManager::SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate)
 {
   ticks += cyclesLate;
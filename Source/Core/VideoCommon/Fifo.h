@@ -7,10 +7,10 @@
 #include <cstddef>
 #include <optional>
 
+#include "Common/AdaptiveEvent.h"
 #include "Common/BlockingLoop.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
-#include "Common/Event.h"
 #include "Common/Flag.h"
 
 class PointerWrap;
@@ -57,6 +57,11 @@ public:
   bool UseDeterministicGPUThread() const { return m_use_deterministic_gpu_thread; }
   bool UseSyncGPU() const { return m_config_sync_gpu; }
 
+  // While set, primitives are skipped instead of being drawn. Register loads, EFB copies and the
+  // PE token and finish interrupts are still processed, so that the CPU sees the same side effects.
+  void SetSkipDraws(bool skip) { m_skip_draws.store(skip, std::memory_order_relaxed); }
+  bool ShouldSkipDraws() const { return m_skip_draws.load(std::memory_order_relaxed); }
+
   // In deterministic GPU thread mode this waits for the GPU to be done with pending work.
   void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr = true);
 
@@ -69,6 +74,9 @@ public:
 
   void FlushGpu();
   void RunGpu();
+  // Like RunGpu, for when the gather pipe has written to the FIFO. In SyncGPU mode, the GPU thread
+  // isn't woken up for this until the CPU is far enough ahead of it to let it run.
+  void RunGpuForGatherPipe();
   void GpuMaySleep();
   void RunGpuLoop();
   void ExitGpuLoop();
@@ -77,13 +85,19 @@ public:
 
 private:
   void RefreshConfig();
+  void ApplySyncGPUDistances();
+  void UpdateSyncGPUController();
   void ReadDataFromFifo(u32 read_ptr);
   void ReadDataFromFifoOnCPU(u32 read_ptr);
   int RunGpuOnCpu(int ticks);
+  void WakeupGpuForPreprocessedData();
   int WaitForGpuThread(int ticks);
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
+  // In deterministic GPU thread mode, the GPU thread is woken up after this much preprocessed data
+  // rather than after every gather pipe burst.
+  static constexpr u32 GPU_WAKEUP_BATCH_SIZE = 1024;
 
   Common::BlockingLoop m_gpu_mainloop;
 
@@ -98,6 +112,8 @@ private:
   // and can change at runtime.
   bool m_use_deterministic_gpu_thread = false;
 
+  std::atomic<bool> m_skip_draws = false;
+
   CoreTiming::EventType* m_event_sync_gpu = nullptr;
 
   // STATE_TO_SAVE
@@ -120,13 +136,31 @@ private:
 
   std::atomic<int> m_sync_ticks = 0;
   bool m_syncing_suspended = false;
-  Common::Event m_sync_wakeup_event;
+  Common::AdaptiveEvent m_sync_wakeup_event;
+  u32 m_preprocessed_bytes_since_wakeup = 0;
 
   std::optional<Config::ConfigChangedCallbackID> m_config_callback_id = std::nullopt;
   bool m_config_sync_gpu = false;
   int m_config_sync_gpu_max_distance = 0;
   int m_config_sync_gpu_min_distance = 0;
   float m_config_sync_gpu_overclock = 0.0f;
+  bool m_config_sync_gpu_adaptive = false;
+  std::atomic<bool> m_config_sync_gpu_changed = false;
+
+  // The SyncGPU distances in use. Only the CPU thread writes them, and it does so before changing
+  // m_sync_ticks, so that the GPU thread wakes it up based on the distance it waits for.
+  std::atomic<int> m_sync_gpu_max_distance = 0;
+  std::atomic<int> m_sync_gpu_min_distance = 0;
+
+  // Adaptive SyncGPU, only touched by the CPU thread. The configured distances are scaled up while
+  // the CPU thread stalls on the GPU thread and back down while it doesn't.
+  bool m_want_determinism = false;
+  float m_sync_gpu_distance_scale = 1.0f;
+  s64 m_sync_gpu_window_ticks = 0;
+  s64 m_sync_gpu_window_lag = 0;
+  u32 m_sync_gpu_window_samples = 0;
+  DT m_sync_gpu_window_stall_time{};
+  TimePoint m_sync_gpu_window_start{};
 
   Core::System& m_system;
 };
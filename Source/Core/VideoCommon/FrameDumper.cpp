@@ -3,6 +3,8 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
@@ -20,6 +22,13 @@
 // The video encoder needs the image to be a multiple of x samples.
 static constexpr int VIDEO_ENCODER_LCM = 4;
 
+// Number of frames a readback is left in flight before mapping it, so the copy has usually
+// completed on the GPU by then and mapping doesn't have to wait for it.
+static constexpr size_t READBACK_LATENCY = 1;
+
+// The ring needs room for the frames in flight plus the one being encoded.
+static constexpr size_t MIN_READBACK_SLOTS = READBACK_LATENCY + 1;
+
 static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 {
   return Common::ConvertRGBAToRGBAndSavePNG(file_name, frame.data, frame.width, frame.height,
@@ -61,13 +70,20 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  size_t slot_index;
+  if (!AcquireReadbackSlot(&slot_index))
+    return;
+
+  ReadbackSlot& slot = m_readback_slots[slot_index];
+  if (!CheckFrameDumpReadbackTexture(slot, target_width, target_height))
+  {
+    m_free_slots.push_back(slot_index);
     return;
+  }
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  slot.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, slot.texture->GetRect());
+  slot.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_pending_readbacks.push_back(slot_index);
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -98,9 +114,10 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(ReadbackSlot& slot, u32 target_width,
+                                                u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
+  std::unique_ptr<AbstractStagingTexture>& rbtex = slot.texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -115,85 +132,161 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
   return true;
 }
 
-void FrameDumper::FlushFrameDump()
+bool FrameDumper::AcquireReadbackSlot(size_t* slot_index)
 {
-  if (!m_frame_dump_needs_flush)
-    return;
-
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  RetireEncodedFrames();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  const size_t max_slots = std::max<size_t>(
+      MIN_READBACK_SLOTS, static_cast<size_t>(Config::Get(Config::GFX_FRAME_DUMPS_QUEUE_SIZE)));
+  if (m_free_slots.empty() && m_readback_slots.size() < max_slots)
+  {
+    m_free_slots.push_back(m_readback_slots.size());
+    m_readback_slots.emplace_back();
+  }
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+  if (m_free_slots.empty())
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    if (Config::Get(Config::GFX_FRAME_DUMPS_DROP_WHEN_FULL))
+    {
+      m_frames_dropped++;
+      return false;
+    }
+
+    const TimePoint wait_start = Clock::now();
+    while (m_free_slots.empty())
+    {
+      if (!m_pending_readbacks.empty())
+      {
+        QueueOldestReadback();
+        continue;
+      }
+
+      {
+        std::unique_lock lk(m_encode_queue_lock);
+        m_encode_queue_changed.wait(lk, [this] { return !m_encoded_slots.empty(); });
+      }
+      RetireEncodedFrames();
+    }
+    m_time_blocked += Clock::now() - wait_start;
   }
-  else
+
+  *slot_index = m_free_slots.front();
+  m_free_slots.pop_front();
+  return true;
+}
+
+void FrameDumper::QueueOldestReadback()
+{
+  const size_t slot_index = m_pending_readbacks.front();
+  m_pending_readbacks.pop_front();
+
+  ReadbackSlot& slot = m_readback_slots[slot_index];
+  slot.texture->Flush();
+  if (!slot.texture->Map())
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    m_free_slots.push_back(slot_index);
+    return;
   }
 
-  m_frame_dump_needs_flush = false;
+  const FrameData frame{reinterpret_cast<u8*>(slot.texture->GetMappedPointer()),
+                        static_cast<int>(slot.texture->GetConfig().width),
+                        static_cast<int>(slot.texture->GetConfig().height),
+                        static_cast<int>(slot.texture->GetMappedStride()), slot.state};
 
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+  if (!m_frame_dump_thread_running.IsSet())
+  {
+    if (m_frame_dump_thread.joinable())
+      m_frame_dump_thread.join();
+    m_frame_dump_thread_running.Set();
+    m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
+  }
+
+  {
+    std::lock_guard lk(m_encode_queue_lock);
+    m_encode_queue.push_back(EncodeRequest{slot_index, frame});
+    m_max_encode_queue_depth = std::max(m_max_encode_queue_depth, m_encode_queue.size());
+  }
+  m_encode_queue_changed.notify_all();
+  m_frames_queued++;
 }
 
-void FrameDumper::ShutdownFrameDumping()
+void FrameDumper::RetireEncodedFrames()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  std::vector<size_t> encoded_slots;
+  {
+    std::lock_guard lk(m_encode_queue_lock);
+    encoded_slots.swap(m_encoded_slots);
+  }
 
-  if (!m_frame_dump_thread_running.IsSet())
+  for (const size_t slot_index : encoded_slots)
+  {
+    m_readback_slots[slot_index].texture->Unmap();
+    m_free_slots.push_back(slot_index);
+  }
+}
+
+void FrameDumper::FlushFrameDump()
+{
+  if (m_readback_slots.empty())
     return;
 
-  // Ensure previous frame has been encoded.
-  FinishFrameData();
+  RetireEncodedFrames();
 
-  // Wake thread up, and wait for it to exit.
-  m_frame_dump_thread_running.Clear();
-  m_frame_dump_start.Set();
-  if (m_frame_dump_thread.joinable())
-    m_frame_dump_thread.join();
-  m_frame_dump_render_framebuffer.reset();
-  m_frame_dump_render_texture.reset();
+  // Screenshots are taken from the next encoded frame, so don't hold them back, as no further
+  // frames may be rendered while paused.
+  const size_t frames_in_flight = m_screenshot_request.IsSet() ? 0 : READBACK_LATENCY;
+  while (m_pending_readbacks.size() > frames_in_flight)
+    QueueOldestReadback();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::ShutdownFrameDumping()
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  // Ensure all readbacks have been sent to the encoder.
+  while (!m_pending_readbacks.empty())
+    QueueOldestReadback();
 
-  if (!m_frame_dump_thread_running.IsSet())
+  if (m_frame_dump_thread_running.IsSet())
   {
+    // Wake thread up, and wait for it to encode the remaining frames and exit.
+    {
+      std::lock_guard lk(m_encode_queue_lock);
+      m_frame_dump_thread_running.Clear();
+    }
+    m_encode_queue_changed.notify_all();
     if (m_frame_dump_thread.joinable())
       m_frame_dump_thread.join();
-    m_frame_dump_thread_running.Set();
-    m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
   }
 
-  // Wake worker thread up.
-  m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
-}
+  RetireEncodedFrames();
 
-void FrameDumper::FinishFrameData()
-{
-  if (!m_frame_dump_frame_running)
-    return;
+  if (m_frames_queued != 0 || m_frames_dropped != 0)
+  {
+    INFO_LOG_FMT(FRAMEDUMP,
+                 "Frame dump finished: {} frames encoded, {} dropped, {:.1f} ms waiting for the "
+                 "encoder, up to {} frames queued",
+                 m_frames_queued, m_frames_dropped, DT_ms(m_time_blocked).count(),
+                 m_max_encode_queue_depth);
+    if (m_frames_dropped != 0)
+    {
+      OSD::AddMessage(fmt::format("Frame dump dropped {} frames as the encoder fell behind.",
+                                  m_frames_dropped));
+    }
+  }
+  m_frames_queued = 0;
+  m_frames_dropped = 0;
+  m_max_encode_queue_depth = 0;
+  m_time_blocked = DT::zero();
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  m_frame_dump_render_framebuffer.reset();
+  m_frame_dump_render_texture.reset();
 
-  m_frame_dump_output_texture->Unmap();
+  m_readback_slots.clear();
+  m_free_slots.clear();
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -215,11 +308,20 @@ void FrameDumper::FrameDumpThreadFunc()
 
   while (true)
   {
-    m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
+    EncodeRequest request;
+    {
+      std::unique_lock lk(m_encode_queue_lock);
+      m_encode_queue_changed.wait(
+          lk, [this] { return !m_encode_queue.empty() || !m_frame_dump_thread_running.IsSet(); });
 
-    auto frame = m_frame_dump_data;
+      // Finish encoding everything which was queued before stopping.
+      if (m_encode_queue.empty())
+        break;
+
+      request = m_encode_queue.front();
+    }
+
+    const FrameData& frame = request.frame;
 
     // Save screenshot
     if (m_screenshot_request.TestAndClear())
@@ -258,7 +360,12 @@ void FrameDumper::FrameDumpThreadFunc()
       }
     }
 
-    m_frame_dump_done.Set();
+    {
+      std::lock_guard lk(m_encode_queue_lock);
+      m_encode_queue.pop_front();
+      m_encoded_slots.push_back(request.slot_index);
+    }
+    m_encode_queue_changed.notify_all();
   }
 
   if (frame_dump_started)
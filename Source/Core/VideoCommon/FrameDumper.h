@@ -3,6 +3,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -22,10 +28,10 @@ public:
   FrameDumper();
   ~FrameDumper();
 
-  // Ensures all rendered frames are queued for encoding.
+  // Queues rendered frames for encoding once their readback has had time to complete.
   void FlushFrameDump();
 
-  // Fills the frame dump staging texture with the current XFB texture.
+  // Copies the current XFB texture into a free frame dump staging texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect,
                         const MathUtil::Rectangle<int>& target_rect, u64 ticks, int frame_number);
@@ -38,6 +44,20 @@ public:
   void DoState(PointerWrap& p);
 
 private:
+  // A staging texture and the frame which was read back into it. Each slot is either free,
+  // waiting for its readback, queued for encoding, or encoded and waiting to be unmapped.
+  struct ReadbackSlot
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    FrameState state;
+  };
+
+  struct EncodeRequest
+  {
+    size_t slot_index;
+    FrameData frame;
+  };
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameData&);
@@ -52,41 +72,43 @@ private:
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that the slot's readback texture exists and is the correct size.
+  bool CheckFrameDumpReadbackTexture(ReadbackSlot& slot, u32 target_width, u32 target_height);
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Returns a free readback slot, growing the ring up to the configured queue size. When the
+  // encoder has fallen behind, either drops the frame or waits for it, depending on config.
+  bool AcquireReadbackSlot(size_t* slot_index);
 
-  // Ensures all encoded frames have been written to the output file.
-  void FinishFrameData();
+  // Waits for the readback of the oldest pending slot, and hands it to the encoding thread.
+  void QueueOldestReadback();
+
+  // Unmaps slots which the encoding thread has finished with, making them free again.
+  void RetireEncodedFrames();
 
   std::thread m_frame_dump_thread;
   Common::Flag m_frame_dump_thread_running;
 
-  // Used to kick frame dump thread.
-  Common::Event m_frame_dump_start;
-
-  // Set by frame dump thread on frame completion.
-  Common::Event m_frame_dump_done;
-
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
-
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Ring of readback textures, only accessed from the video thread. The mapped memory of a slot
+  // in the encode queue belongs to the frame dump thread until it is encoded.
+  std::vector<ReadbackSlot> m_readback_slots;
+  std::deque<size_t> m_free_slots;
+  std::deque<size_t> m_pending_readbacks;
+
+  // Communication of frames between video and dump threads.
+  std::mutex m_encode_queue_lock;
+  std::condition_variable m_encode_queue_changed;
+  std::deque<EncodeRequest> m_encode_queue;
+  std::vector<size_t> m_encoded_slots;
+
+  // Statistics for the current dump, logged when it stops.
+  u64 m_frames_queued = 0;
+  u64 m_frames_dropped = 0;
+  size_t m_max_encode_queue_depth = 0;
+  DT m_time_blocked{};
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
@@ -130,10 +130,13 @@ public:
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    if (is_preprocess || !m_skip_draws)
+    {
+      const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive,
+                                                                        num_vertices, vertex_data);
 
-    ASSERT(bytes == size);
+      ASSERT(bytes == size);
+    }
 
     // 4 GPU ticks per vertex, 3 CPU ticks per GPU tick
     m_cycles += num_vertices * 4 * 3 + 6;
@@ -255,6 +258,8 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+  // The GPU cycles are still counted when skipping draws, as they affect emulated timing.
+  bool m_skip_draws = false;
 };
 
 template <bool is_preprocess>
@@ -262,6 +267,8 @@ u8* RunFifo(DataReader src, u32* cycles)
 {
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
+  if constexpr (!is_preprocess)
+    callback.m_skip_draws = Core::System::GetInstance().GetFifo().ShouldSkipDraws();
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
 
   if (cycles != nullptr)
@@ -4,6 +4,7 @@
 #include "VideoCommon/PerformanceMetrics.h"
 
 #include <algorithm>
+#include <cfloat>
 
 #include <imgui.h>
 #include <implot.h>
@@ -23,6 +24,26 @@ void PerformanceMetrics::Reset()
 
   m_speed = 0;
   m_max_speed = 0;
+
+  m_present_compose_time = DT::zero();
+  m_present_swap_time = DT::zero();
+
+  m_rewind_overhead = 0.0;
+  m_rewind_buffer_size = 0;
+
+  m_unsuppressed_max_speed = 0.0;
+  m_suppressed_presentation_speedup = 0.0;
+
+  m_sync_gpu_min_distance = 0;
+  m_sync_gpu_max_distance = 0;
+  m_sync_gpu_average_lag = 0;
+  m_sync_gpu_stall_fraction = 0.0;
+  for (auto& count : m_sync_gpu_stall_histogram)
+    count = 0;
+
+  m_audio_latency = DT::zero();
+  m_audio_underruns = 0;
+  m_audio_mix_load = 0.0;
 }
 
 void PerformanceMetrics::CountFrame()
@@ -78,6 +99,78 @@ void PerformanceMetrics::CountPerformanceMarker(s64 core_ticks, u32 ticks_per_se
   m_max_speed.store(elapsed_core_time / (work_time - oldest.work_time), std::memory_order_relaxed);
 }
 
+void PerformanceMetrics::CountPresentLatency(DT compose_time, DT swap_time)
+{
+  // Weight new samples by 1/16th, which smooths out single slow frames without lagging much.
+  const auto update = [](std::atomic<DT>& average, DT sample) {
+    const DT old_average = average.load(std::memory_order_relaxed);
+    average.store(old_average + (sample - old_average) / 16, std::memory_order_relaxed);
+  };
+  update(m_present_compose_time, compose_time);
+  update(m_present_swap_time, swap_time);
+}
+
+void PerformanceMetrics::CountRewindCapture(DT capture_time, DT interval)
+{
+  if (interval <= DT::zero())
+    return;
+
+  const double sample = DT_s(capture_time) / DT_s(interval);
+  const double old_average = m_rewind_overhead.load(std::memory_order_relaxed);
+  m_rewind_overhead.store(old_average + (sample - old_average) / 16, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::BeginSuppressedPresentation()
+{
+  // The maximum speed leaves out throttling, so it is what emulation could do while presenting.
+  m_unsuppressed_max_speed.store(GetMaxSpeed(), std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::CountSuppressedPresentation(DT emulated_time, DT host_time)
+{
+  const double max_speed = m_unsuppressed_max_speed.load(std::memory_order_relaxed);
+  if (host_time <= DT::zero() || max_speed <= 0.0)
+  {
+    m_suppressed_presentation_speedup.store(0.0, std::memory_order_relaxed);
+    return;
+  }
+
+  const double speed = DT_s(emulated_time) / DT_s(host_time);
+  m_suppressed_presentation_speedup.store(speed / max_speed, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::CountSyncGPUStall(DT stall)
+{
+  size_t bucket = 0;
+  for (DT limit = std::chrono::microseconds(10);
+       bucket < SYNC_GPU_STALL_BUCKET_COUNT - 1 && stall >= limit; limit *= 10)
+  {
+    ++bucket;
+  }
+  m_sync_gpu_stall_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetSyncGPUState(int min_distance, int max_distance, int average_lag,
+                                         double stall_fraction)
+{
+  m_sync_gpu_min_distance.store(min_distance, std::memory_order_relaxed);
+  m_sync_gpu_max_distance.store(max_distance, std::memory_order_relaxed);
+  m_sync_gpu_average_lag.store(average_lag, std::memory_order_relaxed);
+  m_sync_gpu_stall_fraction.store(stall_fraction, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetRewindBufferSize(size_t size)
+{
+  m_rewind_buffer_size.store(size, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetAudioState(DT latency, u64 underruns, double mix_load)
+{
+  m_audio_latency.store(latency, std::memory_order_relaxed);
+  m_audio_underruns.store(underruns, std::memory_order_relaxed);
+  m_audio_mix_load.store(mix_load, std::memory_order_relaxed);
+}
+
 double PerformanceMetrics::GetFPS() const
 {
   return m_fps_counter.GetHzAvg();
@@ -98,6 +191,74 @@ double PerformanceMetrics::GetMaxSpeed() const
   return m_max_speed.load(std::memory_order_relaxed);
 }
 
+DT PerformanceMetrics::GetPresentComposeTime() const
+{
+  return m_present_compose_time.load(std::memory_order_relaxed);
+}
+
+DT PerformanceMetrics::GetPresentSwapTime() const
+{
+  return m_present_swap_time.load(std::memory_order_relaxed);
+}
+
+double PerformanceMetrics::GetRewindOverhead() const
+{
+  return m_rewind_overhead.load(std::memory_order_relaxed);
+}
+
+size_t PerformanceMetrics::GetRewindBufferSize() const
+{
+  return m_rewind_buffer_size.load(std::memory_order_relaxed);
+}
+
+double PerformanceMetrics::GetSuppressedPresentationSpeedup() const
+{
+  return m_suppressed_presentation_speedup.load(std::memory_order_relaxed);
+}
+
+int PerformanceMetrics::GetSyncGPUMinDistance() const
+{
+  return m_sync_gpu_min_distance.load(std::memory_order_relaxed);
+}
+
+int PerformanceMetrics::GetSyncGPUMaxDistance() const
+{
+  return m_sync_gpu_max_distance.load(std::memory_order_relaxed);
+}
+
+int PerformanceMetrics::GetSyncGPUAverageLag() const
+{
+  return m_sync_gpu_average_lag.load(std::memory_order_relaxed);
+}
+
+double PerformanceMetrics::GetSyncGPUStallFraction() const
+{
+  return m_sync_gpu_stall_fraction.load(std::memory_order_relaxed);
+}
+
+PerformanceMetrics::SyncGPUStallHistogram PerformanceMetrics::GetSyncGPUStallHistogram() const
+{
+  SyncGPUStallHistogram histogram;
+  for (size_t i = 0; i < SYNC_GPU_STALL_BUCKET_COUNT; ++i)
+    histogram[i] = m_sync_gpu_stall_histogram[i].load(std::memory_order_relaxed);
+  return histogram;
+}
+
+DT PerformanceMetrics::GetAudioLatency() const
+{
+  return m_audio_latency.load(std::memory_order_relaxed);
+}
+
+u64 PerformanceMetrics::GetAudioUnderruns() const
+{
+  return m_audio_underruns.load(std::memory_order_relaxed);
+}
+
+double PerformanceMetrics::GetAudioMixLoad() const
+{
+  return m_audio_mix_load.load(std::memory_order_relaxed);
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   m_vps_counter.UpdateStats();
@@ -249,8 +410,12 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 
   if (g_ActiveConfig.bShowSpeed)
   {
+    const bool show_rewind = GetRewindBufferSize() != 0;
+    const double suppressed_speedup = GetSuppressedPresentationSpeedup();
+    const bool show_suppressed = suppressed_speedup != 0.0;
+
     // Position in the top-right corner of the screen.
-    float window_height = 47.f * backbuffer_scale;
+    float window_height = (47.f + 17.f * (show_rewind + show_suppressed)) * backbuffer_scale;
 
     ImGui::SetNextWindowPos(ImVec2(window_x, window_y), set_next_position_condition,
                             ImVec2(1.0f, 0.0f));
@@ -267,13 +432,80 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
       clamp_window_position();
       ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Speed:%4.0lf%%", 100.0 * speed);
       ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Max:%6.0lf%%", 100.0 * GetMaxSpeed());
+      if (show_rewind)
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Rwd:%5.1lf%%", 100.0 * GetRewindOverhead());
+      if (show_suppressed)
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Turbo:%5.2lfx", suppressed_speedup);
+    }
+    ImGui::End();
+  }
+
+  if (g_ActiveConfig.bShowSpeed && GetSyncGPUMaxDistance() != 0)
+  {
+    const float histogram_height = 30.f * backbuffer_scale;
+    float window_height = (12.f + 17.f * 4) * backbuffer_scale + histogram_height;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), set_next_position_condition,
+                            ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("SyncGPUStats", nullptr, imgui_flags))
+    {
+      clamp_window_position();
+      // Distances are in thousands of CPU ticks.
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Max:%5dk", GetSyncGPUMaxDistance() / 1000);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Min:%5dk", GetSyncGPUMinDistance() / 1000);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Lag:%5dk", GetSyncGPUAverageLag() / 1000);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Stl:%5.1lf%%",
+                         100.0 * GetSyncGPUStallFraction());
+
+      const SyncGPUStallHistogram histogram = GetSyncGPUStallHistogram();
+      std::array<float, SYNC_GPU_STALL_BUCKET_COUNT> values;
+      std::transform(histogram.begin(), histogram.end(), values.begin(),
+                     [](u64 count) { return static_cast<float>(count); });
+      ImGui::PlotHistogram("##SyncGPUStalls", values.data(), static_cast<int>(values.size()), 0,
+                           nullptr, 0.0f, FLT_MAX, ImVec2(-1.0f, histogram_height));
+    }
+    ImGui::End();
+  }
+
+  if (g_ActiveConfig.bShowSpeed && GetAudioLatency() != DT::zero())
+  {
+    float window_height = (12.f + 17.f * 3) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), set_next_position_condition,
+                            ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("AudioStats", nullptr, imgui_flags))
+    {
+      clamp_window_position();
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Aud:%4.0lfms",
+                         DT_ms(GetAudioLatency()).count());
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Und:%6llu",
+                         static_cast<unsigned long long>(GetAudioUnderruns()));
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Mix:%5.1lf%%", 100.0 * GetAudioMixLoad());
     }
     ImGui::End();
   }
 
   if (g_ActiveConfig.bShowFPS || g_ActiveConfig.bShowFTimes)
   {
-    int count = g_ActiveConfig.bShowFPS + 2 * g_ActiveConfig.bShowFTimes;
+    int count = g_ActiveConfig.bShowFPS + 4 * g_ActiveConfig.bShowFTimes;
     float window_height = (12.f + 17.f * count) * backbuffer_scale;
 
     // Position in the top-right corner of the screen.
@@ -298,6 +530,10 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
                            DT_ms(m_fps_counter.GetDtAvg()).count());
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), " ±:%6.2lfms",
                            DT_ms(m_fps_counter.GetDtStd()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "xfb:%5.2lfms",
+                           DT_ms(GetPresentComposeTime()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "swp:%5.2lfms",
+                           DT_ms(GetPresentSwapTime()).count());
       }
     }
     ImGui::End();
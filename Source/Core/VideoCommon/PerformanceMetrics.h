@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <deque>
 
@@ -18,6 +19,10 @@ class System;
 class PerformanceMetrics
 {
 public:
+  // SyncGPU stalls are counted by duration: below 10us, 100us, 1ms, 10ms, and longer.
+  static constexpr size_t SYNC_GPU_STALL_BUCKET_COUNT = 5;
+  using SyncGPUStallHistogram = std::array<u64, SYNC_GPU_STALL_BUCKET_COUNT>;
+
   PerformanceMetrics() = default;
   ~PerformanceMetrics() = default;
 
@@ -36,12 +41,55 @@ public:
   void CountThrottleSleep(DT sleep);
   void AdjustClockSpeed(s64 ticks, u32 new_ppc_clock, u32 old_ppc_clock);
   void CountPerformanceMarker(s64 ticks, u32 ticks_per_second);
+  // capture_time is the time spent capturing a rewind snapshot, interval the time since the last.
+  void CountRewindCapture(DT capture_time, DT interval);
+  // Called when presentation is suppressed, to keep the speed it is compared against.
+  void BeginSuppressedPresentation();
+  // Called when presentation is resumed, with the time emulated while it was suppressed and the
+  // host time that took.
+  void CountSuppressedPresentation(DT emulated_time, DT host_time);
+  // Called when the CPU thread had to wait for the GPU thread in SyncGPU mode.
+  void CountSyncGPUStall(DT stall);
+  // The SyncGPU distances in use, how far the GPU thread was behind on average, and the fraction of
+  // time the CPU thread spent stalled since the last update.
+  void SetSyncGPUState(int min_distance, int max_distance, int average_lag, double stall_fraction);
+
+  // May be called from any thread.
+  void SetRewindBufferSize(size_t size);
+
+  // Call from audio thread.
+  // latency covers the audio queued in the mixer and the backend, mix_load is the fraction of
+  // time spent mixing since the last update.
+  void SetAudioState(DT latency, u64 underruns, double mix_load);
+
+  // Call from Video thread.
+  // compose_time covers fetching the XFB through drawing it and the UI to the backbuffer,
+  // swap_time covers handing the backbuffer to the window system.
+  void CountPresentLatency(DT compose_time, DT swap_time);
 
   // Getter Functions. May be called from any thread.
   double GetFPS() const;
   double GetVPS() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
+  DT GetPresentComposeTime() const;
+  DT GetPresentSwapTime() const;
+  // Fraction of CPU thread time spent capturing rewind snapshots.
+  double GetRewindOverhead() const;
+  size_t GetRewindBufferSize() const;
+  // How many times faster the last span without presentation was emulated than the maximum speed
+  // just before it, or 0 if there is nothing to compare.
+  double GetSuppressedPresentationSpeedup() const;
+  // Distances are 0 if SyncGPU isn't in use.
+  int GetSyncGPUMinDistance() const;
+  int GetSyncGPUMaxDistance() const;
+  int GetSyncGPUAverageLag() const;
+  double GetSyncGPUStallFraction() const;
+  SyncGPUStallHistogram GetSyncGPUStallHistogram() const;
+  // Latency is 0 if the audio backend doesn't pull from the mixer.
+  DT GetAudioLatency() const;
+  u64 GetAudioUnderruns() const;
+  double GetAudioMixLoad() const;
 
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
@@ -64,6 +112,27 @@ private:
 
   std::deque<PerfSample> m_samples;
   DT m_time_sleeping{};
+
+  // Exponential moving averages of the present latency.
+  std::atomic<DT> m_present_compose_time{};
+  std::atomic<DT> m_present_swap_time{};
+
+  // Exponential moving average of the rewind capture overhead.
+  std::atomic<double> m_rewind_overhead{};
+  std::atomic<size_t> m_rewind_buffer_size{};
+
+  std::atomic<double> m_unsuppressed_max_speed{};
+  std::atomic<double> m_suppressed_presentation_speedup{};
+
+  std::atomic<int> m_sync_gpu_min_distance{};
+  std::atomic<int> m_sync_gpu_max_distance{};
+  std::atomic<int> m_sync_gpu_average_lag{};
+  std::atomic<double> m_sync_gpu_stall_fraction{};
+  std::array<std::atomic<u64>, SYNC_GPU_STALL_BUCKET_COUNT> m_sync_gpu_stall_histogram{};
+
+  std::atomic<DT> m_audio_latency{};
+  std::atomic<u64> m_audio_underruns{};
+  std::atomic<double> m_audio_mix_load{};
 };
 
 extern PerformanceMetrics g_perf_metrics;
@@ -17,6 +17,7 @@
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OnScreenUI.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -130,6 +131,7 @@ bool Presenter::Initialize()
 
 bool Presenter::FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
 {
+  m_xfb_fetch_time = Clock::now();
   ReleaseXFBContentLock();
   u64 old_xfb_id = m_last_xfb_id;
 
@@ -204,6 +206,10 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
 
     AfterPresentEvent::Trigger(present_info);
   }
+  else
+  {
+    m_xfb_fetch_time.reset();
+  }
 }
 
 void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
@@ -869,10 +875,19 @@ void Presenter::Present(std::optional<TimePoint> presentation_time)
   {
     std::lock_guard<std::mutex> guard(m_swap_mutex);
 
+    // Time spent pacing to the presentation time is intentional, so it isn't counted as latency.
+    const TimePoint compose_end = Clock::now();
     if (presentation_time.has_value())
       Core::System::GetInstance().GetCoreTiming().SleepUntil(*presentation_time);
 
+    const TimePoint swap_start = Clock::now();
     g_gfx->PresentBackbuffer();
+    if (m_xfb_fetch_time)
+    {
+      g_perf_metrics.CountPresentLatency(compose_end - *m_xfb_fetch_time,
+                                         Clock::now() - swap_start);
+      m_xfb_fetch_time.reset();
+    }
   }
 
   if (m_xfb_entry)
@@ -14,6 +14,7 @@
 #include <array>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <tuple>
 
 class AbstractTexture;
@@ -147,6 +148,10 @@ private:
   // Tracking of XFB textures so we don't render duplicate frames.
   u64 m_last_xfb_id = std::numeric_limits<u64>::max();
 
+  // When the XFB for the next present was fetched, for measuring present latency. Presents which
+  // don't show a newly fetched XFB, like shader compilation progress, leave this unset.
+  std::optional<TimePoint> m_xfb_fetch_time;
+
   // These will be set on the first call to SetSuggestedWindowSize.
   int m_last_window_request_width = 0;
   int m_last_window_request_height = 0;
@@ -408,6 +408,7 @@ void ShaderCache::ClearCaches()
     pipeline.reset();
   m_texture_reinterpret_pipelines.clear();
   m_texture_decoding_shaders.clear();
+  m_tmem_rgba8_decoding_shader.reset();
 
   SETSTAT(g_stats.num_pixel_shaders_created, 0);
   SETSTAT(g_stats.num_pixel_shaders_alive, 0);
@@ -1604,4 +1605,16 @@ ShaderCache::GetTextureDecodingShader(TextureFormat format,
   const auto iiter = m_texture_decoding_shaders.emplace(key, std::move(shader));
   return iiter.first->second.get();
 }
+
+const AbstractShader* ShaderCache::GetTmemRGBA8DecodingShader()
+{
+  if (m_tmem_rgba8_decoding_shader.has_value())
+    return m_tmem_rgba8_decoding_shader->get();
+
+  const std::string shader_source =
+      TextureConversionShaderTiled::GenerateTmemRGBA8DecodingShader(APIType::OpenGL);
+  m_tmem_rgba8_decoding_shader = g_gfx->CreateShaderFromSource(
+      ShaderStage::Compute, shader_source, "Texture decoding compute shader: RGBA8 from TMEM");
+  return m_tmem_rgba8_decoding_shader->get();
+}
 }  // namespace VideoCommon
@@ -113,6 +113,7 @@ public:
   // Texture decoding compute shaders
   const AbstractShader* GetTextureDecodingShader(TextureFormat format,
                                                  std::optional<TLUTFormat> palette_format);
+  const AbstractShader* GetTmemRGBA8DecodingShader();
 
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
@@ -251,6 +252,7 @@ private:
 
   // Texture decoding shaders
   std::map<std::pair<u32, u32>, std::unique_ptr<AbstractShader>> m_texture_decoding_shaders;
+  std::optional<std::unique_ptr<AbstractShader>> m_tmem_rgba8_decoding_shader;
 
   Common::EventHook m_frame_end_handler;
 };
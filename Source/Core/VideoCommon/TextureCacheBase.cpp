@@ -1654,13 +1654,13 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       return entry;
 
     // We can decode on the GPU if it is a supported format and the flag is enabled.
-    // Currently we don't decode RGBA8 textures from TMEM, as that would require copying from both
-    // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
-    // there's no conversion between formats. In the future this could be extended with a separate
-    // shader, however.
-    const bool decode_on_gpu =
-        g_ActiveConfig.UseGPUTextureDecoding() &&
-        !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
+    // RGBA8 textures from TMEM are split across both banks, so they use a separate shader which
+    // reads the AR and GB channels from the two banks. Each bank holds half of the texture data.
+    const bool decode_on_gpu = g_ActiveConfig.UseGPUTextureDecoding();
+    const bool is_tmem_rgba8 =
+        texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8;
+    const u32 base_row_stride =
+        creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth());
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
@@ -1669,10 +1669,12 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+            entry, 0, texture_info.GetData(),
+            is_tmem_rgba8 ? texture_info.GetTextureSize() / 2 : texture_info.GetTextureSize(),
             texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+            is_tmem_rgba8 ? base_row_stride / 2 : base_row_stride, texture_info.GetTlutAddress(),
+            texture_info.GetTlutFormat(),
+            is_tmem_rgba8 ? texture_info.GetTmemOddAddress() : nullptr))
     {
       size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
@@ -1952,7 +1954,11 @@ void TextureCacheBase::StitchXFBCopy(RcTcacheEntry& stitched_entry)
         if (entry->native_width != entry->GetWidth())
           create_upscaled_copy = true;
 
-        candidates.emplace_back(entry.get());
+        // Copies which were already stitched in are still in the texture, so only the copies made
+        // since the last present need to be applied. Replacing a referenced copy marks this entry
+        // as changed, which discards it in GetXFBFromCache, so stale contents can't be reused.
+        if (!entry->references.contains(stitched_entry.get()))
+          candidates.emplace_back(entry.get());
       }
       else
       {
@@ -2964,14 +2970,18 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
                                           u32 data_size, TextureFormat format, u32 width,
                                           u32 height, u32 aligned_width, u32 aligned_height,
                                           u32 row_stride, const u8* palette,
-                                          TLUTFormat palette_format)
+                                          TLUTFormat palette_format, const u8* tmem_odd)
 {
-  const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format);
+  const auto* info = tmem_odd ? TextureConversionShaderTiled::GetTmemRGBA8DecodingShaderInfo() :
+                                TextureConversionShaderTiled::GetDecodingShaderInfo(format);
   if (!info)
     return false;
 
-  const AbstractShader* shader = g_shader_cache->GetTextureDecodingShader(
-      format, info->palette_size != 0 ? std::make_optional(palette_format) : std::nullopt);
+  const AbstractShader* shader =
+      tmem_odd ? g_shader_cache->GetTmemRGBA8DecodingShader() :
+                 g_shader_cache->GetTextureDecodingShader(
+                     format, info->palette_size != 0 ? std::make_optional(palette_format) :
+                                                       std::nullopt);
   if (!shader)
     return false;
 
@@ -2981,7 +2991,17 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
 
   // Allocate space in stream buffer, and copy texture + palette across.
   u32 src_offset = 0, palette_offset = 0;
-  if (info->palette_size > 0)
+  if (tmem_odd)
+  {
+    // The odd bank is the same size as the even bank, and takes the place of the palette.
+    if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset,
+                                             tmem_odd, data_size, info->buffer_format,
+                                             &palette_offset))
+    {
+      return false;
+    }
+  }
+  else if (info->palette_size > 0)
   {
     if (!g_vertex_manager->UploadTexelBuffer(data, data_size, info->buffer_format, &src_offset,
                                              palette, info->palette_size,
@@ -319,10 +319,12 @@ protected:
   // width, height are the size of the image in pixels.
   // aligned_width, aligned_height are the size of the image in pixels, aligned to the block size.
   // row_stride is the number of bytes for a row of blocks, not pixels.
+  // tmem_odd is the odd bank for RGBA8 textures preloaded into TMEM, in which case data is the even
+  // bank, and data_size/row_stride describe a single bank. It must be null for other textures.
   bool DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, const u8* data, u32 data_size,
                           TextureFormat format, u32 width, u32 height, u32 aligned_width,
                           u32 aligned_height, u32 row_stride, const u8* palette,
-                          TLUTFormat palette_format);
+                          TLUTFormat palette_format, const u8* tmem_odd = nullptr);
 
   virtual void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
                        u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
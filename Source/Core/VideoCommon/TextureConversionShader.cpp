@@ -1034,12 +1034,43 @@ static const std::map<TextureFormat, DecodingShaderInfo> s_decoding_shader_info{
       }
       )"}}};
 
+// RGBA8 textures preloaded into TMEM are split across both banks: the AR channels of every block
+// live in the even bank and the GB channels at the same offset in the odd bank. The odd bank is
+// bound in place of the palette buffer, which has the same 16-bit element type.
+static const DecodingShaderInfo s_tmem_rgba8_decoding_shader_info{
+    TEXEL_BUFFER_FORMAT_R16_UINT, 0, 8, 8, false,
+    R"(
+      DEFINE_MAIN(8, 8)
+      {
+        uint2 coords = gl_GlobalInvocationID.xy;
+
+        // Tiled in 4x4 blocks, one 16-bit element per texel in each bank.
+        uint buffer_pos = GetTiledTexelOffset(uint2(4u, 4u), coords);
+        uint val1 = FETCH(buffer_pos);
+        uint val2 = FETCH_PALETTE(buffer_pos);
+
+        uint4 color;
+        color.a = (val1 & 0xFFu);
+        color.r = (val1 >> 8);
+        color.g = (val2 & 0xFFu);
+        color.b = (val2 >> 8);
+
+        float4 norm_color = float4(color) / 255.0;
+        imageStore(output_image, int3(int2(coords), 0), norm_color);
+      }
+      )"};
+
 const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format)
 {
   auto iter = s_decoding_shader_info.find(format);
   return iter != s_decoding_shader_info.end() ? &iter->second : nullptr;
 }
 
+const DecodingShaderInfo* GetTmemRGBA8DecodingShaderInfo()
+{
+  return &s_tmem_rgba8_decoding_shader_info;
+}
+
 std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width, u32 height)
 {
   // Flatten to a single dimension?
@@ -1050,6 +1081,28 @@ std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width,
           (height + (info->group_size_y - 1)) / info->group_size_y};
 }
 
+static void WriteBufferFormatDefines(std::ostringstream& ss, TexelBufferFormat buffer_format)
+{
+  switch (buffer_format)
+  {
+  case TEXEL_BUFFER_FORMAT_R8_UINT:
+    ss << "#define TEXEL_BUFFER_FORMAT_R8 1\n";
+    break;
+  case TEXEL_BUFFER_FORMAT_R16_UINT:
+    ss << "#define TEXEL_BUFFER_FORMAT_R16 1\n";
+    break;
+  case TEXEL_BUFFER_FORMAT_RGBA8_UINT:
+    ss << "#define TEXEL_BUFFER_FORMAT_RGBA8 1\n";
+    break;
+  case TEXEL_BUFFER_FORMAT_R32G32_UINT:
+    ss << "#define TEXEL_BUFFER_FORMAT_R32G32 1\n";
+    break;
+  case NUM_TEXEL_BUFFER_FORMATS:
+    ASSERT(false);
+    break;
+  }
+}
+
 std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTFormat> palette_format,
                                    APIType api_type)
 {
@@ -1074,25 +1127,21 @@ std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTForma
     }
   }
 
-  switch (info->buffer_format)
-  {
-  case TEXEL_BUFFER_FORMAT_R8_UINT:
-    ss << "#define TEXEL_BUFFER_FORMAT_R8 1\n";
-    break;
-  case TEXEL_BUFFER_FORMAT_R16_UINT:
-    ss << "#define TEXEL_BUFFER_FORMAT_R16 1\n";
-    break;
-  case TEXEL_BUFFER_FORMAT_RGBA8_UINT:
-    ss << "#define TEXEL_BUFFER_FORMAT_RGBA8 1\n";
-    break;
-  case TEXEL_BUFFER_FORMAT_R32G32_UINT:
-    ss << "#define TEXEL_BUFFER_FORMAT_R32G32 1\n";
-    break;
-  case NUM_TEXEL_BUFFER_FORMATS:
-    ASSERT(false);
-    break;
-  }
+  WriteBufferFormatDefines(ss, info->buffer_format);
+  ss << decoding_shader_header;
+  ss << info->shader_body;
+
+  return ss.str();
+}
+
+std::string GenerateTmemRGBA8DecodingShader(APIType api_type)
+{
+  const DecodingShaderInfo* info = GetTmemRGBA8DecodingShaderInfo();
 
+  // The odd bank occupies the palette binding, so enable it without selecting a palette format.
+  std::ostringstream ss;
+  ss << "#define HAS_PALETTE 1\n";
+  WriteBufferFormatDefines(ss, info->buffer_format);
   ss << decoding_shader_header;
   ss << info->shader_body;
 
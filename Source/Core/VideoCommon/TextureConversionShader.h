@@ -37,6 +37,10 @@ struct DecodingShaderInfo
 // If this format does not have a shader written for it, returns nullptr.
 const DecodingShaderInfo* GetDecodingShaderInfo(TextureFormat format);
 
+// Obtain shader information for RGBA8 textures preloaded into TMEM, which are split across the
+// even (AR) and odd (GB) banks. The odd bank is uploaded in place of a palette.
+const DecodingShaderInfo* GetTmemRGBA8DecodingShaderInfo();
+
 // Determine how many thread groups should be dispatched for an image of the specified width/height.
 // First is the number of X groups, second is the number of Y groups, Z is always one.
 std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width, u32 height);
@@ -45,6 +49,9 @@ std::pair<u32, u32> GetDispatchCount(const DecodingShaderInfo* info, u32 width,
 std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTFormat> palette_format,
                                    APIType api_type);
 
+// Returns the GLSL string containing the decoding shader for RGBA8 textures preloaded into TMEM.
+std::string GenerateTmemRGBA8DecodingShader(APIType api_type);
+
 // Returns the GLSL string containing the palette conversion shader for the specified format.
 std::string GeneratePaletteConversionShader(TLUTFormat palette_format, APIType api_type);
 
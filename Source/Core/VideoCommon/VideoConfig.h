@@ -333,6 +333,10 @@ struct VideoConfig final
   // Currently only supported with Vulkan.
   int iCommandBufferExecuteInterval = 0;
 
+  // Number of threads recording the draws of the EFB into secondary command buffers, 0 records them
+  // on the GPU thread. Currently only supported with Vulkan.
+  int iDrawRecordingThreads = 0;
+
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "AudioCommon/AdaptiveLatency.h"
+
+using AudioCommon::AdaptiveLatency;
+
+TEST(AdaptiveLatency, StartsAtMinimum)
+{
+  AdaptiveLatency latency(480, 4800, 240);
+  EXPECT_EQ(latency.GetFrames(), 480u);
+  EXPECT_FALSE(latency.Update(TimePoint{} + std::chrono::hours(1)));
+  EXPECT_EQ(latency.GetFrames(), 480u);
+}
+
+TEST(AdaptiveLatency, GrowsOnUnderrunUpToMaximum)
+{
+  AdaptiveLatency latency(480, 1000, 240);
+  TimePoint now = Clock::now();
+
+  EXPECT_TRUE(latency.OnUnderrun(now));
+  EXPECT_EQ(latency.GetFrames(), 720u);
+
+  // Underruns right after growing are ignored.
+  EXPECT_FALSE(latency.OnUnderrun(now + std::chrono::milliseconds(10)));
+  EXPECT_EQ(latency.GetFrames(), 720u);
+
+  now += AdaptiveLatency::GROW_HOLDOFF;
+  EXPECT_TRUE(latency.OnUnderrun(now));
+  EXPECT_EQ(latency.GetFrames(), 960u);
+
+  now += AdaptiveLatency::GROW_HOLDOFF;
+  EXPECT_TRUE(latency.OnUnderrun(now));
+  EXPECT_EQ(latency.GetFrames(), 1000u);
+
+  now += AdaptiveLatency::GROW_HOLDOFF;
+  EXPECT_FALSE(latency.OnUnderrun(now));
+  EXPECT_EQ(latency.GetFrames(), 1000u);
+  EXPECT_EQ(latency.GetUnderrunCount(), 5u);
+}
+
+TEST(AdaptiveLatency, ShrinksWhenStable)
+{
+  AdaptiveLatency latency(480, 4800, 400);
+  TimePoint now = Clock::now();
+  latency.OnUnderrun(now);
+  EXPECT_EQ(latency.GetFrames(), 880u);
+
+  EXPECT_FALSE(latency.Update(now + AdaptiveLatency::STABLE_TIME / 2));
+  EXPECT_EQ(latency.GetFrames(), 880u);
+
+  // Another underrun restarts the wait.
+  now += AdaptiveLatency::STABLE_TIME / 2;
+  latency.OnUnderrun(now);
+  EXPECT_EQ(latency.GetFrames(), 1280u);
+  EXPECT_FALSE(latency.Update(now + AdaptiveLatency::STABLE_TIME / 2));
+
+  now += AdaptiveLatency::STABLE_TIME;
+  EXPECT_TRUE(latency.Update(now));
+  EXPECT_EQ(latency.GetFrames(), 880u);
+
+  now += AdaptiveLatency::STABLE_TIME;
+  EXPECT_TRUE(latency.Update(now));
+  EXPECT_EQ(latency.GetFrames(), 480u);
+
+  now += AdaptiveLatency::STABLE_TIME;
+  EXPECT_FALSE(latency.Update(now));
+  EXPECT_EQ(latency.GetFrames(), 480u);
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cmath>
+#include <numbers>
+
+#include <gtest/gtest.h>
+
+#include "AudioCommon/Enums.h"
+#include "AudioCommon/PolyphaseFilter.h"
+
+using AudioCommon::PolyphaseFilter;
+using AudioCommon::ResamplingQuality;
+
+namespace
+{
+using Samples = std::array<float, PolyphaseFilter::MAX_TAPS * 2>;
+
+// Fills samples with an interleaved stereo sine wave, at frequency cycles per sample, with the
+// right channel a quarter of a cycle behind.
+Samples MakeSine(double frequency, double phase)
+{
+  Samples samples;
+  for (std::size_t i = 0; i < samples.size() / 2; ++i)
+  {
+    const double angle = 2 * std::numbers::pi * (frequency * i + phase);
+    samples[i * 2] = static_cast<float>(1000 * std::sin(angle));
+    samples[i * 2 + 1] = static_cast<float>(1000 * std::cos(angle));
+  }
+  return samples;
+}
+}  // namespace
+
+TEST(PolyphaseFilter, ReusesFilters)
+{
+  EXPECT_EQ(AudioCommon::GetResamplingFilter(ResamplingQuality::Lowest, 1.5), nullptr);
+
+  // Every upsampling ratio uses the same filter.
+  const auto filter = AudioCommon::GetResamplingFilter(ResamplingQuality::High, 1.5);
+  ASSERT_NE(filter, nullptr);
+  EXPECT_EQ(filter, AudioCommon::GetResamplingFilter(ResamplingQuality::High, 48000.0 / 3000));
+  EXPECT_NE(filter, AudioCommon::GetResamplingFilter(ResamplingQuality::High, 44100.0 / 48000));
+  EXPECT_NE(filter, AudioCommon::GetResamplingFilter(ResamplingQuality::Highest, 1.5));
+}
+
+TEST(PolyphaseFilter, KeepsDCGain)
+{
+  Samples first, second;
+  first.fill(600.0f);
+  second.fill(400.0f);
+
+  for (auto quality : {ResamplingQuality::Low, ResamplingQuality::High, ResamplingQuality::Highest})
+  {
+    const auto filter = AudioCommon::GetResamplingFilter(quality, 44100.0 / 48000);
+    for (float fraction = 0.0f; fraction < 1.0f; fraction += 0.0625f)
+    {
+      float left, right;
+      filter->Apply(first.data(), second.data(), fraction, &left, &right);
+      EXPECT_NEAR(left, 1000.0f, 0.01f);
+      EXPECT_NEAR(right, 1000.0f, 0.01f);
+    }
+  }
+}
+
+TEST(PolyphaseFilter, InterpolatesPassband)
+{
+  const Samples zeros{};
+  for (auto quality : {ResamplingQuality::Low, ResamplingQuality::High, ResamplingQuality::Highest})
+  {
+    const auto filter = AudioCommon::GetResamplingFilter(quality, 1.5);
+    const u32 center = filter->GetTaps() / 2 - 1;
+
+    // 1 kHz at 32 kHz.
+    constexpr double frequency = 1.0 / 32;
+    const Samples sine = MakeSine(frequency, 0.0);
+    for (float fraction = 0.0f; fraction < 1.0f; fraction += 0.125f)
+    {
+      float left, right;
+      filter->Apply(sine.data(), zeros.data(), fraction, &left, &right);
+
+      const double angle = 2 * std::numbers::pi * frequency * (center + fraction);
+      EXPECT_NEAR(left, 1000 * std::sin(angle), 10.0);
+      EXPECT_NEAR(right, 1000 * std::cos(angle), 10.0);
+    }
+  }
+}
+
+TEST(PolyphaseFilter, FiltersAboveOutputNyquist)
+{
+  const Samples zeros{};
+  for (auto quality : {ResamplingQuality::High, ResamplingQuality::Highest})
+  {
+    // Halving the sample rate, so 20 kHz at 48 kHz is well above the new Nyquist frequency.
+    const auto filter = AudioCommon::GetResamplingFilter(quality, 0.5);
+    for (double phase : {0.0, 0.3, 0.7})
+    {
+      const Samples sine = MakeSine(20.0 / 48, phase);
+      float left, right;
+      filter->Apply(sine.data(), zeros.data(), 0.5f, &left, &right);
+      EXPECT_LT(std::abs(left), 20.0f);
+      EXPECT_LT(std::abs(right), 20.0f);
+    }
+  }
+}
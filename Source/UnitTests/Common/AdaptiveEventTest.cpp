@@ -0,0 +1,125 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/AdaptiveEvent.h"
+#include "Common/BlockingLoop.h"
+#include "Common/Event.h"
+
+using Common::AdaptiveEvent;
+
+TEST(AdaptiveEvent, MultiThreaded)
+{
+  AdaptiveEvent has_sent, can_send;
+  int shared_obj;
+  constexpr int ITERATIONS_COUNT = 100000;
+
+  auto sender = [&] {
+    for (int i = 0; i < ITERATIONS_COUNT; ++i)
+    {
+      can_send.Wait();
+      shared_obj = i;
+      has_sent.Set();
+    }
+  };
+
+  auto receiver = [&] {
+    for (int i = 0; i < ITERATIONS_COUNT; ++i)
+    {
+      has_sent.Wait();
+      EXPECT_EQ(i, shared_obj);
+      can_send.Set();
+    }
+  };
+
+  std::thread sender_thread(sender);
+  std::thread receiver_thread(receiver);
+
+  can_send.Set();
+
+  sender_thread.join();
+  receiver_thread.join();
+}
+
+TEST(AdaptiveEvent, WaitFor)
+{
+  AdaptiveEvent event;
+  EXPECT_FALSE(event.WaitFor(std::chrono::milliseconds(1)));
+
+  event.Set();
+  EXPECT_TRUE(event.WaitFor(std::chrono::milliseconds(1)));
+  EXPECT_FALSE(event.WaitFor(std::chrono::milliseconds(1)));
+
+  event.Set();
+  event.Reset();
+  EXPECT_FALSE(event.WaitFor(std::chrono::milliseconds(1)));
+
+  std::thread setter([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    event.Set();
+  });
+  EXPECT_TRUE(event.WaitFor(std::chrono::seconds(10)));
+  setter.join();
+}
+
+constexpr int BURST_SIZE = 32;
+constexpr int BURSTS_PER_SYNC = 16;
+
+// Hands 32 byte bursts from a producer to a BlockingLoop worker the way the CPU thread hands FIFO
+// data to the GPU thread, waiting for the worker every few bursts as SyncGPU and FIFO reads do.
+// Returns how many bytes were handed off.
+static u64 HandOffFifoData(int sync_count)
+{
+  Common::BlockingLoop loop;
+  std::atomic<u64> written = 0;
+  u64 consumed = 0;
+
+  loop.Prepare();
+  std::thread worker([&] { loop.Run([&] { consumed = written.load(); }); });
+
+  for (int i = 0; i < sync_count; ++i)
+  {
+    for (int j = 0; j < BURSTS_PER_SYNC; ++j)
+    {
+      written += BURST_SIZE;
+      loop.Wakeup();
+    }
+
+    loop.Wait();
+    EXPECT_EQ(written.load(), consumed);
+
+    // Let the worker park every now and then, like GpuMaySleep does.
+    if (i % 64 == 0)
+      loop.AllowSleep();
+  }
+
+  loop.Stop();
+  worker.join();
+  return written.load();
+}
+
+TEST(AdaptiveEvent, FifoHandoff)
+{
+  constexpr int SYNC_COUNT = 500;
+  EXPECT_EQ(u64{SYNC_COUNT} * BURSTS_PER_SYNC * BURST_SIZE, HandOffFifoData(SYNC_COUNT));
+}
+
+// Prints how long a round trip takes, as a way to spot regressions in the handoff. Disabled by
+// default, run it with --gtest_also_run_disabled_tests.
+TEST(AdaptiveEvent, DISABLED_FifoHandoffBenchmark)
+{
+  constexpr int SYNC_COUNT = 20000;
+
+  const auto start = std::chrono::steady_clock::now();
+  const u64 written = HandOffFifoData(SYNC_COUNT);
+  const auto end = std::chrono::steady_clock::now();
+
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  fmt::print("{} bytes handed off, {} ns per sync\n", written, ns / SYNC_COUNT);
+}
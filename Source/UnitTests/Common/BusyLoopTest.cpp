@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "Common/BlockingLoop.h"
+#include "Common/Event.h"
 #include "Common/Thread.h"
 
 TEST(BusyLoopTest, MultiThreaded)
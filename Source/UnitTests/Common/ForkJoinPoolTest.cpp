@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/ForkJoinPool.h"
+
+TEST(ForkJoinPool, RunsEveryItemOnce)
+{
+  Common::ForkJoinPool pool;
+  pool.Start("ForkJoinPool Test", 3);
+  EXPECT_EQ(pool.GetThreadCount(), 4u);
+
+  for (u32 item_count : {0u, 1u, 2u, 7u, 1000u})
+  {
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+      std::vector<int> runs(item_count);
+      std::vector<std::atomic<int>> busy_threads(pool.GetThreadCount());
+      pool.ParallelFor(item_count, [&](u32 thread, u32 item) {
+        ASSERT_LT(thread, pool.GetThreadCount());
+        EXPECT_EQ(busy_threads[thread].fetch_add(1), 0);
+        ++runs[item];
+        busy_threads[thread].fetch_sub(1);
+      });
+
+      for (int item_runs : runs)
+        ASSERT_EQ(item_runs, 1);
+    }
+  }
+}
+
+TEST(ForkJoinPool, RunsInlineWithoutWorkers)
+{
+  Common::ForkJoinPool pool;
+  EXPECT_EQ(pool.GetThreadCount(), 1u);
+
+  u32 sum = 0;
+  pool.ParallelFor(10, [&](u32 thread, u32 item) {
+    EXPECT_EQ(thread, 0u);
+    sum += item;
+  });
+  EXPECT_EQ(sum, 45u);
+
+  pool.Start("ForkJoinPool Test", 2);
+  pool.Stop();
+  EXPECT_EQ(pool.GetThreadCount(), 1u);
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/MappedFile.h"
+
+class MappedFileTest : public testing::Test
+{
+protected:
+  MappedFileTest()
+      : m_parent_directory(File::CreateTempDir()), m_file_path(m_parent_directory + "/file.bin")
+  {
+  }
+
+  ~MappedFileTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+
+    m_data.resize(0x123456);
+    for (size_t i = 0; i < m_data.size(); ++i)
+      m_data[i] = static_cast<u8>(i * 7 + (i >> 12));
+
+    File::IOFile file(m_file_path, "wb");
+    ASSERT_TRUE(file.WriteBytes(m_data.data(), m_data.size()));
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_file_path;
+  std::vector<u8> m_data;
+};
+
+TEST_F(MappedFileTest, MapsWholeFile)
+{
+  File::IOFile file(m_file_path, "rb");
+  File::MappedFile mapping;
+  if (!mapping.Map(file))
+    GTEST_SKIP() << "Files can't be mapped on this platform";
+  file.Close();
+
+  ASSERT_EQ(mapping.GetSize(), m_data.size());
+  const std::span<const u8> span = mapping.GetSpan();
+  EXPECT_TRUE(std::equal(span.begin(), span.end(), m_data.begin(), m_data.end()));
+}
+
+TEST_F(MappedFileTest, AdviseReadKeepsContents)
+{
+  File::IOFile file(m_file_path, "rb");
+  File::MappedFile mapping;
+  if (!mapping.Map(file))
+    GTEST_SKIP() << "Files can't be mapped on this platform";
+
+  // Sequential reads, then enough scattered ones to switch to random access, then sequential again.
+  for (u64 offset = 0; offset < 0x100000; offset += 0x8000)
+    mapping.AdviseRead(offset, 0x8000);
+  for (u64 i = 0; i < 32; ++i)
+    mapping.AdviseRead((i * 0x45678) % m_data.size(), 0x800);
+  for (u64 offset = 0x80000; offset < m_data.size(); offset += 0x8000)
+    mapping.AdviseRead(offset, 0x8000);
+
+  const std::span<const u8> span = mapping.GetSpan();
+  EXPECT_TRUE(std::equal(span.begin(), span.end(), m_data.begin(), m_data.end()));
+}
+
+TEST_F(MappedFileTest, MoveTransfersMapping)
+{
+  File::IOFile file(m_file_path, "rb");
+  File::MappedFile mapping;
+  if (!mapping.Map(file))
+    GTEST_SKIP() << "Files can't be mapped on this platform";
+
+  File::MappedFile moved = std::move(mapping);
+  EXPECT_FALSE(mapping.IsMapped());
+  ASSERT_TRUE(moved.IsMapped());
+  EXPECT_EQ(moved.GetSpan()[0x1234], m_data[0x1234]);
+
+  moved.Unmap();
+  EXPECT_FALSE(moved.IsMapped());
+  EXPECT_TRUE(moved.GetSpan().empty());
+}
+
+TEST_F(MappedFileTest, EmptyFileIsNotMapped)
+{
+  const std::string empty_path = m_parent_directory + "/empty.bin";
+  ASSERT_TRUE(File::CreateEmptyFile(empty_path));
+
+  File::IOFile file(empty_path, "rb");
+  File::MappedFile mapping;
+  EXPECT_FALSE(mapping.Map(file));
+  EXPECT_FALSE(mapping.IsMapped());
+}
@@ -3,9 +3,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
+#include <random>
+#include <set>
 #include <string>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
@@ -319,6 +327,69 @@ TEST(CoreTiming, ScheduleIntoPast)
   AdvanceAndCheck(system, 0, MAX_SLICE_LENGTH, 1000);
 }
 
+namespace SafePointTest
+{
+static CoreTiming::EventType* s_cb_periodic = nullptr;
+static int s_safe_points = 0;
+
+static void SafePointCallback(Core::System& system)
+{
+  ++s_safe_points;
+
+  // The periodic event has already been scheduled again, and the new slice ends when it is due.
+  EXPECT_EQ(1000 - s_lateness, system.GetPPCState().downcount);
+}
+
+static void PeriodicCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  EXPECT_EQ(s_lateness, lateness);
+
+  // Like the VI event, ask for the safe point before scheduling the next period.
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.RunAtSafePoint(SafePointCallback);
+  core_timing.RunAtSafePoint(SafePointCallback);
+  core_timing.ScheduleEvent(1000 - lateness, s_cb_periodic);
+}
+}  // namespace SafePointTest
+
+TEST(CoreTiming, SafePoint)
+{
+  using namespace SafePointTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  s_cb_periodic = core_timing.RegisterEvent("callbackPeriodic", PeriodicCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  core_timing.ScheduleEvent(1000, s_cb_periodic);
+  s_safe_points = 0;
+
+  s_lateness = 100;
+  ppc_state.downcount = -100;
+  core_timing.Advance();
+  EXPECT_EQ(1, s_safe_points);
+  EXPECT_EQ(900, ppc_state.downcount);
+
+  // No event runs, so there is no safe point either.
+  ppc_state.downcount = 400;
+  core_timing.Advance();
+  EXPECT_EQ(1, s_safe_points);
+  EXPECT_EQ(400, ppc_state.downcount);
+
+  s_lateness = 0;
+  ppc_state.downcount = 0;
+  core_timing.Advance();
+  EXPECT_EQ(2, s_safe_points);
+}
+
 TEST(CoreTiming, Overclocking)
 {
   auto& system = Core::System::GetInstance();
@@ -393,3 +464,177 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace ManyEventsTest
+{
+struct FiredEvent
+{
+  u64 id;
+  s64 time;
+};
+
+static std::vector<FiredEvent> s_fired;
+
+static void RecordCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  const s64 time = static_cast<s64>(system.GetCoreTiming().GetTicks()) - lateness;
+  s_fired.push_back({userdata, time});
+}
+}  // namespace ManyEventsTest
+
+// Events far enough apart to end up both in the timing wheel and in its overflow list, some of
+// which get removed again, must still run in the order they are due in.
+TEST(CoreTiming, ManyEvents)
+{
+  using namespace ManyEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  std::array<CoreTiming::EventType*, 8> event_types;
+  for (size_t i = 0; i < event_types.size(); ++i)
+    event_types[i] = core_timing.RegisterEvent(fmt::format("callback{}", i), RecordCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  struct ScheduledEvent
+  {
+    s64 time;
+    u64 id;
+    size_t type;
+  };
+  std::vector<ScheduledEvent> expected;
+  std::set<u64> removed;
+  s_fired.clear();
+
+  std::mt19937 rng(1234);
+  u64 next_id = 0;
+  for (int i = 0; i < 2000; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      const s64 cycles = 1 + rng() % (j == 0 ? 4000000 : 40000);
+      const size_t type = rng() % event_types.size();
+      expected.push_back({static_cast<s64>(core_timing.GetTicks()) + cycles, next_id, type});
+      core_timing.ScheduleEvent(cycles, event_types[type], next_id++);
+    }
+
+    if (rng() % 8 == 0)
+    {
+      const size_t type = rng() % event_types.size();
+      core_timing.RemoveEvent(event_types[type]);
+
+      const s64 now = static_cast<s64>(core_timing.GetTicks());
+      for (const ScheduledEvent& event : expected)
+      {
+        if (event.type == type && event.time > now)
+          removed.insert(event.id);
+      }
+    }
+
+    ppc_state.downcount = 0;
+    core_timing.Advance();
+  }
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    ppc_state.downcount = 0;
+    core_timing.Advance();
+  }
+
+  std::erase_if(expected, [&](const ScheduledEvent& event) { return removed.contains(event.id); });
+  std::ranges::sort(expected, {}, [](const ScheduledEvent& event) {
+    return std::tie(event.time, event.id);
+  });
+
+  ASSERT_EQ(expected.size(), s_fired.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_EQ(expected[i].id, s_fired[i].id);
+    EXPECT_EQ(expected[i].time, s_fired[i].time);
+  }
+}
+
+namespace PeriodicEventsTest
+{
+static constexpr std::array<s64, 12> PERIODS{{1200, 2500, 3300, 8000, 12000, 16384, 40000, 81000,
+                                              150000, 400000, 1000000, 8000000}};
+static std::array<CoreTiming::EventType*, PERIODS.size()> s_event_types;
+static u64 s_fired = 0;
+
+static void PeriodicCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  ++s_fired;
+  system.GetCoreTiming().ScheduleEvent(PERIODS[userdata] - lateness, s_event_types[userdata],
+                                       userdata);
+}
+
+// Calls Advance the given number of times with a realistic set of periodic events, and checks that
+// each of them ran as often as it should have.
+static void AdvanceWithPeriodicEvents(Core::System& system, int advance_count)
+{
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  for (size_t i = 0; i < PERIODS.size(); ++i)
+    s_event_types[i] = core_timing.RegisterEvent(fmt::format("periodic{}", i), PeriodicCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  for (size_t i = 0; i < PERIODS.size(); ++i)
+    core_timing.ScheduleEvent(PERIODS[i], s_event_types[i], i);
+
+  s_fired = 0;
+  for (int i = 0; i < advance_count; ++i)
+  {
+    ppc_state.downcount = 0;
+    core_timing.Advance();
+  }
+
+  const s64 ticks = static_cast<s64>(core_timing.GetTicks());
+  u64 expected_fired = 0;
+  for (const s64 period : PERIODS)
+    expected_fired += ticks / period;
+  EXPECT_EQ(expected_fired, s_fired);
+}
+}  // namespace PeriodicEventsTest
+
+TEST(CoreTiming, PeriodicEvents)
+{
+  using namespace PeriodicEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  AdvanceWithPeriodicEvents(system, 10000);
+}
+
+// Prints how long Advance takes with a realistic number of periodic events, as a way to spot
+// regressions. Disabled by default, run it with --gtest_also_run_disabled_tests.
+TEST(CoreTiming, DISABLED_AdvanceBenchmark)
+{
+  using namespace PeriodicEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  constexpr int ADVANCE_COUNT = 1000000;
+  const auto start = std::chrono::steady_clock::now();
+  AdvanceWithPeriodicEvents(system, ADVANCE_COUNT);
+  const auto end = std::chrono::steady_clock::now();
+
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  fmt::print("{} Advance calls running {} events took {} ns each\n", ADVANCE_COUNT, s_fired,
+             ns / ADVANCE_COUNT);
+}
@@ -0,0 +1,334 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/BitUtils.h"
+#include "Common/CommonTypes.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/DSP.h"
+#include "Core/HW/DSPHLE/DSPHLE.h"
+#include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// A GameCube AX ucode whose PBs include the low-pass filter and which has the newer mixer control.
+constexpr u32 AX_CRC = 0x07f88145;
+
+constexpr u32 VOICE_WORKERS = 3;
+
+// The PBs and their updates are all in this area, which is compared after processing.
+constexpr u32 PB_AREA = 0x00100000;
+constexpr u32 PB_AREA_SIZE = 0x00080000;
+constexpr u32 PB_STRIDE = 0x200;
+constexpr u32 UPDATES_AREA = PB_AREA + 0x00060000;
+constexpr u32 UPDATES_STRIDE = 0x80;
+
+constexpr u32 ARAM_SAMPLES_SIZE = 0x20000;
+
+constexpr u16 PBOffset(size_t offset)
+{
+  return static_cast<u16>(offset / sizeof(u16));
+}
+
+// AXUCode with the PB list processing exposed, processing voices on voice_workers + 1 threads if
+// voice_workers is not 0.
+class TestAXUCode final : public AXUCode
+{
+public:
+  TestAXUCode(DSPHLE* dsphle, u32 voice_workers) : AXUCode(dsphle, AX_CRC)
+  {
+    if (voice_workers != 0)
+      m_voice_workers.Start("AX Voice Worker", voice_workers);
+  }
+
+  using AXUCode::ProcessPBList;
+
+  std::vector<int> GetMixBuffers() const
+  {
+    std::vector<int> samples;
+    for (const auto& buffer :
+         {m_samples_main_left, m_samples_main_right, m_samples_main_surround, m_samples_auxA_left,
+          m_samples_auxA_right, m_samples_auxA_surround, m_samples_auxB_left, m_samples_auxB_right,
+          m_samples_auxB_surround})
+    {
+      samples.insert(samples.end(), buffer, buffer + std::size(m_samples_main_left));
+    }
+    return samples;
+  }
+
+  // The worker accelerators are only created once a list has been processed on several threads.
+  bool UsedVoiceWorkers() const { return !m_worker_accelerators.empty(); }
+};
+
+struct ProcessingResult
+{
+  std::vector<int> samples;
+  std::vector<u8> pb_area;
+  bool used_voice_workers;
+};
+}  // namespace
+
+class AXVoiceListTest : public testing::Test
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    auto& system = Core::System::GetInstance();
+    system.GetMemory().Init();
+    system.GetDSP().Init(true);
+  }
+
+  static void TearDownTestSuite()
+  {
+    auto& system = Core::System::GetInstance();
+    system.GetDSP().Shutdown();
+    system.GetMemory().Shutdown();
+    system.GetCoreTiming().UnregisterAllEvents();
+  }
+
+  void SetUp() override
+  {
+    u8* const aram = m_system.GetDSP().GetARAMPtr();
+    std::generate_n(aram, ARAM_SAMPLES_SIZE, [this] { return static_cast<u8>(m_rng()); });
+    m_system.GetMemory().Memset(PB_AREA, 0, PB_AREA_SIZE);
+  }
+
+  static std::vector<u32> SpacedPBAddresses(u32 count)
+  {
+    std::vector<u32> addrs(count);
+    for (u32 i = 0; i < count; ++i)
+      addrs[i] = PB_AREA + i * PB_STRIDE;
+    return addrs;
+  }
+
+  // A running voice mixing to random channels, which loops over ADPCM or PCM16 samples or plays
+  // PCM16 samples once and stops within the first frame.
+  AXPB MakeVoice(u32 index, u32 addr, u32 next_addr)
+  {
+    AXPB pb{};
+    pb.next_pb_hi = static_cast<u16>(next_addr >> 16);
+    pb.next_pb_lo = static_cast<u16>(next_addr);
+    pb.this_pb_hi = static_cast<u16>(addr >> 16);
+    pb.this_pb_lo = static_cast<u16>(addr);
+
+    pb.src_type = SRCTYPE_LINEAR;
+    pb.mixer_control = static_cast<u16>(m_rng() & 0x3FFF);
+    pb.running = 1;
+    pb.is_stream = index % 6 == 3 ? 1 : 0;
+
+    auto mixer = Common::BitCastToArray<VolumeData>(pb.mixer);
+    for (VolumeData& volume : mixer)
+    {
+      volume.volume = static_cast<u16>(m_rng() & 0x7FFF);
+      volume.volume_delta = static_cast<u16>(static_cast<int>(m_rng() % 17) - 8);
+    }
+    pb.mixer = std::bit_cast<PBMixer>(mixer);
+
+    pb.vol_env.cur_volume = 0x7FFF;
+    pb.vol_env.cur_volume_delta = 0;
+
+    u32 loop_addr;
+    u32 end_addr;
+    switch (index % 3)
+    {
+    case 0:
+      // ADPCM addresses are in nibbles, and each frame of 16 nibbles starts with a header.
+      pb.audio_addr.looping = 1;
+      pb.audio_addr.sample_format = 0x00;
+      loop_addr = (index * 0x40) * 2 + 2;
+      end_addr = (index * 0x40) * 2 + 0x3F;
+      break;
+    case 1:
+      pb.audio_addr.looping = 1;
+      pb.audio_addr.sample_format = 0x0A;
+      loop_addr = ARAM_SAMPLES_SIZE / 4 + index * 0x40;
+      end_addr = loop_addr + 0x2F;
+      break;
+    default:
+      pb.audio_addr.looping = 0;
+      pb.audio_addr.sample_format = 0x0A;
+      loop_addr = ARAM_SAMPLES_SIZE / 4 + index * 0x40;
+      end_addr = loop_addr + 0x50;
+      break;
+    }
+    pb.audio_addr.loop_addr_hi = static_cast<u16>(loop_addr >> 16);
+    pb.audio_addr.loop_addr_lo = static_cast<u16>(loop_addr);
+    pb.audio_addr.end_addr_hi = static_cast<u16>(end_addr >> 16);
+    pb.audio_addr.end_addr_lo = static_cast<u16>(end_addr);
+    pb.audio_addr.cur_addr_hi = pb.audio_addr.loop_addr_hi;
+    pb.audio_addr.cur_addr_lo = pb.audio_addr.loop_addr_lo;
+
+    for (s16& coef : pb.adpcm.coefs)
+      coef = static_cast<s16>(static_cast<int>(m_rng() % 0x1000) - 0x800);
+    pb.adpcm.gain = 0x800;
+    pb.adpcm_loop_info.pred_scale = static_cast<u16>(m_rng() & 0x7F);
+
+    const u32 ratio = 0x8000 + m_rng() % 0x10000;
+    pb.src.ratio_hi = static_cast<u16>(ratio >> 16);
+    pb.src.ratio_lo = static_cast<u16>(ratio);
+
+    if (index % 5 == 0)
+    {
+      pb.lpf.on = 1;
+      pb.lpf.a0 = 0x4000;
+      pb.lpf.b0 = 0x3000;
+    }
+
+    return pb;
+  }
+
+  // Gives the voice the updates for each millisecond of the frame, stored at updates_addr.
+  void SetUpdates(AXPB& pb, u32 updates_addr, const std::array<std::vector<PBUpdate>, 5>& updates)
+  {
+    std::vector<PBUpdate> all_updates;
+    for (size_t ms = 0; ms < updates.size(); ++ms)
+    {
+      pb.updates.num_updates[ms] = static_cast<u16>(updates[ms].size());
+      all_updates.insert(all_updates.end(), updates[ms].begin(), updates[ms].end());
+    }
+    pb.updates.data_hi = static_cast<u16>(updates_addr >> 16);
+    pb.updates.data_lo = static_cast<u16>(updates_addr);
+
+    m_system.GetMemory().CopyToEmuSwapped(updates_addr,
+                                          reinterpret_cast<const u16*>(all_updates.data()),
+                                          all_updates.size() * sizeof(PBUpdate));
+  }
+
+  void WritePB(u32 addr, const AXPB& pb)
+  {
+    m_system.GetMemory().CopyToEmuSwapped(addr, reinterpret_cast<const u16*>(&pb), sizeof(pb));
+  }
+
+  // Writes a list with a voice at each of the addresses, some of which change their volume, mixing
+  // and filter or stop through updates. Returns the PBs, which can still be changed and written
+  // again before processing.
+  std::vector<AXPB> WritePBList(const std::vector<u32>& addrs)
+  {
+    std::vector<AXPB> pbs;
+    for (u32 i = 0; i < addrs.size(); ++i)
+    {
+      const u32 next_addr = i + 1 < addrs.size() ? addrs[i + 1] : 0;
+      AXPB& pb = pbs.emplace_back(MakeVoice(i, addrs[i], next_addr));
+      if (i % 4 == 1)
+      {
+        const u16 last_update_offset = PBOffset(i % 8 == 1 ? offsetof(AXPB, running) :
+                                                             offsetof(AXPB, mixer_control));
+        SetUpdates(pb, UPDATES_AREA + i * UPDATES_STRIDE,
+                   {{{{PBOffset(offsetof(AXPB, mixer.main_left.volume)), 0x1234}},
+                     {},
+                     {{PBOffset(offsetof(AXPB, lpf.on)), 1},
+                      {PBOffset(offsetof(AXPB, vol_env.cur_volume_delta)), 0xFFFC}},
+                     {},
+                     {{last_update_offset, 0}}}});
+      }
+      WritePB(addrs[i], pb);
+    }
+    return pbs;
+  }
+
+  ProcessingResult ProcessPBList(u32 voice_workers, u32 pb_addr)
+  {
+    auto& memory = m_system.GetMemory();
+    TestAXUCode ucode(&m_dsphle, voice_workers);
+
+    // Processing a second frame checks that the worker buffers were cleared after the first one.
+    ucode.ProcessPBList(pb_addr);
+    ucode.ProcessPBList(pb_addr);
+
+    ProcessingResult result;
+    result.samples = ucode.GetMixBuffers();
+    result.pb_area.resize(PB_AREA_SIZE);
+    memory.CopyFromEmu(result.pb_area.data(), PB_AREA, PB_AREA_SIZE);
+    result.used_voice_workers = ucode.UsedVoiceWorkers();
+    return result;
+  }
+
+  // Processes the list written to memory one voice after another and on several threads, and
+  // checks that both give the same samples and write back the same PBs.
+  void ExpectSameAsSerial(u32 pb_addr, bool expect_voice_workers)
+  {
+    auto& memory = m_system.GetMemory();
+    std::vector<u8> initial_pb_area(PB_AREA_SIZE);
+    memory.CopyFromEmu(initial_pb_area.data(), PB_AREA, PB_AREA_SIZE);
+
+    const ProcessingResult serial = ProcessPBList(0, pb_addr);
+    memory.CopyToEmu(PB_AREA, initial_pb_area.data(), PB_AREA_SIZE);
+    const ProcessingResult parallel = ProcessPBList(VOICE_WORKERS, pb_addr);
+
+    EXPECT_FALSE(serial.used_voice_workers);
+    EXPECT_EQ(parallel.used_voice_workers, expect_voice_workers);
+    EXPECT_NE(serial.pb_area, initial_pb_area);
+    EXPECT_EQ(serial.samples, parallel.samples);
+    EXPECT_EQ(serial.pb_area, parallel.pb_area);
+  }
+
+  Core::System& m_system = Core::System::GetInstance();
+  DSPHLE m_dsphle{m_system};
+  std::mt19937 m_rng{0x4158};
+};
+
+TEST_F(AXVoiceListTest, ParallelMatchesSerial)
+{
+  const std::vector<u32> addrs = SpacedPBAddresses(40);
+  std::vector<AXPB> pbs = WritePBList(addrs);
+
+  // The list changes through an update as well, with voice 9 skipping voice 10 from the fifth ms.
+  SetUpdates(pbs[9], UPDATES_AREA + 9 * UPDATES_STRIDE,
+             {{{}, {}, {}, {}, {{PBOffset(offsetof(AXPB, next_pb_lo)), u16(addrs[11])}}}});
+  WritePB(addrs[9], pbs[9]);
+
+  ExpectSameAsSerial(addrs[0], true);
+}
+
+TEST_F(AXVoiceListTest, OverlappingPBs)
+{
+  std::vector<u32> addrs = SpacedPBAddresses(40);
+  addrs[5] = addrs[4] + 0x40;
+  WritePBList(addrs);
+
+  ExpectSameAsSerial(addrs[0], false);
+}
+
+TEST_F(AXVoiceListTest, PBOverlappingUpdates)
+{
+  const std::vector<u32> addrs = SpacedPBAddresses(40);
+  std::vector<AXPB> pbs = WritePBList(addrs);
+
+  // Voice 25 reads its updates from the end of the PB of voice 20, which is written back first.
+  for (size_t i = 0; i + 1 < std::size(pbs[20].padding); i += 2)
+  {
+    pbs[20].padding[i] = PBOffset(offsetof(AXPB, mixer.main_right.volume));
+    pbs[20].padding[i + 1] = static_cast<u16>(0x100 * i);
+  }
+  WritePB(addrs[20], pbs[20]);
+  pbs[25].updates.num_updates[1] = 2;
+  pbs[25].updates.num_updates[3] = 1;
+  const u32 updates_addr = addrs[20] + offsetof(AXPB, padding);
+  pbs[25].updates.data_hi = static_cast<u16>(updates_addr >> 16);
+  pbs[25].updates.data_lo = static_cast<u16>(updates_addr);
+  WritePB(addrs[25], pbs[25]);
+
+  ExpectSameAsSerial(addrs[0], false);
+}
+
+TEST_F(AXVoiceListTest, LongPBList)
+{
+  const std::vector<u32> addrs = SpacedPBAddresses(300);
+  WritePBList(addrs);
+
+  ExpectSameAsSerial(addrs[0], false);
+}
@@ -0,0 +1,299 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceSamples.h"
+
+using namespace DSP::HLE;
+
+// The per-sample implementations AX voices were processed with before, which the block versions
+// have to match exactly.
+namespace Reference
+{
+static s16 ClampS16(s64 sample)
+{
+  return std::clamp<s64>(sample, -0x8000, 0x7FFF);
+}
+
+static u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta,
+                           bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 sample_volume = signed_volume ? (s16)volume : (u16)volume;
+    const s32 sample = ((s32)samples[i] * sample_volume) >> 15;
+    samples[i] = ClampS16(sample);
+    volume += volume_delta;
+  }
+  return volume;
+}
+
+static void MixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                   s16* dpop)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= volume;
+    sample >>= 15;
+    s16 sample16 = ClampS16((s32)sample);
+
+    out[i] += sample16;
+    volume += volume_delta;
+
+    *dpop = sample16;
+  }
+}
+
+static u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count,
+                         s16* last_samples, u32 curr_pos, u32 ratio, int srctype,
+                         const s16* coeffs)
+{
+  int read_samples_count = 0;
+
+  if (coeffs && srctype == SRCTYPE_POLYPHASE)
+  {
+    s16 temp[4];
+    u32 idx = 0;
+
+    temp[idx++ & 3] = last_samples[0];
+    temp[idx++ & 3] = last_samples[1];
+    temp[idx++ & 3] = last_samples[2];
+    temp[idx++ & 3] = last_samples[3];
+
+    for (u32 i = 0; i < count; ++i)
+    {
+      curr_pos += ratio;
+      while (curr_pos >= 0x10000)
+      {
+        temp[idx++ & 3] = input_callback(read_samples_count++);
+        curr_pos -= 0x10000;
+      }
+
+      u16 curr_pos_frac = ((curr_pos & 0xFFFF) >> 9) << 2;
+      const s16* c = &coeffs[curr_pos_frac];
+
+      s64 t0 = temp[idx++ & 3];
+      s64 t1 = temp[idx++ & 3];
+      s64 t2 = temp[idx++ & 3];
+      s64 t3 = temp[idx++ & 3];
+
+      s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
+
+      output[i] = ClampS16(samp);
+    }
+
+    last_samples[3] = temp[--idx & 3];
+    last_samples[2] = temp[--idx & 3];
+    last_samples[1] = temp[--idx & 3];
+    last_samples[0] = temp[--idx & 3];
+  }
+  else if (srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE)
+  {
+    s16 temp[4];
+    u32 idx = 0;
+
+    temp[idx++ & 3] = last_samples[0];
+    temp[idx++ & 3] = last_samples[1];
+    temp[idx++ & 3] = last_samples[2];
+    temp[idx++ & 3] = last_samples[3];
+
+    for (u32 i = 0; i < count; ++i)
+    {
+      curr_pos += ratio;
+      while (curr_pos >= 0x10000)
+      {
+        temp[idx++ & 3] = input_callback(read_samples_count++);
+        curr_pos -= 0x10000;
+      }
+
+      u16 curr_frac = curr_pos & 0xFFFF;
+      u16 inv_curr_frac = -curr_frac;
+
+      s16 sample;
+      if (curr_frac)
+      {
+        s32 s0 = temp[idx++ & 3];
+        s32 s1 = temp[idx++ & 3];
+
+        sample = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
+        idx += 2;
+      }
+      else
+      {
+        sample = temp[idx++ & 3];
+        idx += 3;
+      }
+
+      output[i] = sample;
+    }
+
+    last_samples[3] = temp[--idx & 3];
+    last_samples[2] = temp[--idx & 3];
+    last_samples[1] = temp[--idx & 3];
+    last_samples[0] = temp[--idx & 3];
+  }
+  else
+  {
+    for (u32 i = 0; i < count; ++i)
+      output[i] = input_callback(i);
+
+    memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
+  }
+
+  return curr_pos;
+}
+}  // namespace Reference
+
+class AXVoiceSamplesTest : public testing::Test
+{
+protected:
+  // Mostly random samples, with the extremes showing up often enough to catch saturation issues.
+  s16 RandomSample()
+  {
+    switch (m_rng() % 8)
+    {
+    case 0:
+      return -0x8000;
+    case 1:
+      return 0x7FFF;
+    default:
+      return static_cast<s16>(m_rng());
+    }
+  }
+
+  u16 RandomVolume()
+  {
+    switch (m_rng() % 8)
+    {
+    case 0:
+      return 0x8000;
+    case 1:
+      return 0xFFFF;
+    default:
+      return static_cast<u16>(m_rng());
+    }
+  }
+
+  std::vector<s16> RandomSamples(size_t count)
+  {
+    std::vector<s16> samples(count);
+    std::generate(samples.begin(), samples.end(), [this] { return RandomSample(); });
+    return samples;
+  }
+
+  std::mt19937 m_rng{1234};
+};
+
+TEST_F(AXVoiceSamplesTest, VolumeRampMatchesReference)
+{
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const u32 count = m_rng() % 100;
+    const u16 volume = RandomVolume();
+    const u16 volume_delta = static_cast<u16>(m_rng());
+    const bool signed_volume = m_rng() % 2;
+
+    std::vector<s16> samples = RandomSamples(count);
+    std::vector<s16> expected = samples;
+
+    const u16 expected_volume =
+        Reference::ApplyVolumeRamp(expected.data(), count, volume, volume_delta, signed_volume);
+    EXPECT_EQ(ApplyVolumeRamp(samples.data(), count, volume, volume_delta, signed_volume),
+              expected_volume);
+    ASSERT_EQ(samples, expected);
+  }
+}
+
+TEST_F(AXVoiceSamplesTest, MixAddMatchesReference)
+{
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const u32 count = m_rng() % 100;
+    const u16 volume_delta = m_rng() % 2 ? static_cast<u16>(m_rng()) : 0;
+    const std::vector<s16> input = RandomSamples(count);
+
+    std::vector<int> out(count);
+    std::generate(out.begin(), out.end(), [this] { return static_cast<int>(m_rng()) >> 8; });
+    std::vector<int> expected_out = out;
+
+    u16 volume = RandomVolume();
+    u16 expected_volume = volume;
+    s16 last_sample = 123;
+    s16 expected_last_sample = 123;
+
+    MixAddSamples(out.data(), input.data(), count, volume, volume_delta, last_sample);
+    Reference::MixAdd(expected_out.data(), input.data(), count, expected_volume, volume_delta,
+                      &expected_last_sample);
+
+    ASSERT_EQ(out, expected_out);
+    EXPECT_EQ(volume, expected_volume);
+    EXPECT_EQ(last_sample, expected_last_sample);
+  }
+}
+
+TEST_F(AXVoiceSamplesTest, ResampleMatchesReference)
+{
+  std::vector<s16> coeffs = RandomSamples(0x200);
+
+  for (int iteration = 0; iteration < 5000; ++iteration)
+  {
+    const int srctype = m_rng() % 4;
+    const u32 count = 6 + m_rng() % 91;
+    u32 ratio;
+    switch (m_rng() % 4)
+    {
+    case 0:
+      // Far more input than output samples, which is read in more than one block.
+      ratio = m_rng() % 0x4000000;
+      break;
+    case 1:
+      ratio = 0x10000;
+      break;
+    default:
+      ratio = m_rng() % 0x40000;
+      break;
+    }
+    const u32 curr_pos = m_rng() % 0x10000;
+    const bool use_coeffs = m_rng() % 4 != 0;
+
+    const std::vector<s16> input = RandomSamples(count + (u64(count) * ratio >> 16) + 1);
+    std::array<s16, 4> last_samples;
+    std::generate(last_samples.begin(), last_samples.end(), [this] { return RandomSample(); });
+    std::array<s16, 4> expected_last_samples = last_samples;
+
+    std::vector<s16> output(count);
+    std::vector<s16> expected_output(count);
+
+    size_t read_pos = 0;
+    const u32 new_pos = ResampleAudio(
+        [&](s16* samples, u32 samples_count) {
+          ASSERT_LE(read_pos + samples_count, input.size());
+          std::copy_n(input.begin() + read_pos, samples_count, samples);
+          read_pos += samples_count;
+        },
+        output.data(), count, last_samples.data(), curr_pos, ratio, srctype,
+        use_coeffs ? coeffs.data() : nullptr);
+
+    size_t expected_read_pos = 0;
+    const u32 expected_new_pos = Reference::ResampleAudio(
+        [&](u32) { return input[expected_read_pos++]; }, expected_output.data(), count,
+        expected_last_samples.data(), curr_pos, ratio, srctype,
+        use_coeffs ? coeffs.data() : nullptr);
+
+    ASSERT_EQ(output, expected_output) << "ratio " << ratio << " srctype " << srctype;
+    EXPECT_EQ(new_pos, expected_new_pos);
+    EXPECT_EQ(last_samples, expected_last_samples);
+    EXPECT_EQ(read_pos, expected_read_pos);
+  }
+}
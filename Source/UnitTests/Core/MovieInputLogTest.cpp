@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Core/MovieInputLog.h"
+
+using Movie::InputFormat;
+using Movie::InputLog;
+
+static std::vector<u8> MakeInput(size_t size)
+{
+  std::vector<u8> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<u8>(i * 7 + i / 251);
+  return data;
+}
+
+static std::vector<u8> ReadAll(InputLog& log)
+{
+  std::vector<u8> data(log.GetSize());
+  EXPECT_TRUE(log.Read(0, data.data(), data.size()));
+  return data;
+}
+
+TEST(MovieInputLog, ReadsBackAcrossChunks)
+{
+  const std::vector<u8> input = MakeInput(InputLog::CHUNK_SIZE * 3 + 123);
+
+  InputLog log;
+  for (size_t offset = 0; offset < input.size(); offset += 8)
+  {
+    const size_t size = std::min<size_t>(8, input.size() - offset);
+    log.Write(offset, input.data() + offset, size);
+  }
+
+  ASSERT_EQ(log.GetSize(), input.size());
+  EXPECT_EQ(ReadAll(log), input);
+
+  u8 byte;
+  EXPECT_FALSE(log.Read(input.size(), &byte, 1));
+}
+
+TEST(MovieInputLog, WriteTruncates)
+{
+  std::vector<u8> input = MakeInput(InputLog::CHUNK_SIZE * 2 + 50);
+
+  InputLog log;
+  log.Write(0, input.data(), input.size());
+
+  // Rerecording from within an earlier chunk discards everything after it.
+  const u64 offset = InputLog::CHUNK_SIZE / 2;
+  const std::vector<u8> rerecorded = {1, 2, 3, 4};
+  log.Write(offset, rerecorded.data(), rerecorded.size());
+
+  input.resize(offset);
+  input.insert(input.end(), rerecorded.begin(), rerecorded.end());
+  EXPECT_EQ(ReadAll(log), input);
+}
+
+TEST(MovieInputLog, SavesAndLoadsBothFormats)
+{
+  const std::vector<u8> input = MakeInput(InputLog::CHUNK_SIZE * 2 + 1000);
+
+  InputLog log;
+  log.Write(0, input.data(), input.size());
+
+  for (InputFormat format : {InputFormat::Raw, InputFormat::Compressed})
+  {
+    File::IOFile file(std::tmpfile());
+    ASSERT_TRUE(log.Save(file, format));
+    if (format == InputFormat::Raw)
+      EXPECT_EQ(file.GetSize(), input.size());
+
+    InputLog loaded;
+    file.Seek(0, File::SeekOrigin::Begin);
+    ASSERT_TRUE(loaded.Load(file, format));
+    EXPECT_EQ(ReadAll(loaded), input);
+  }
+
+  // The log can still be appended to after saving its partial last chunk.
+  const std::vector<u8> more = MakeInput(InputLog::CHUNK_SIZE);
+  log.Write(log.GetSize(), more.data(), more.size());
+  std::vector<u8> expected = input;
+  expected.insert(expected.end(), more.begin(), more.end());
+  EXPECT_EQ(ReadAll(log), expected);
+}
+
+TEST(MovieInputLog, FindsMismatchAndCopiesPrefix)
+{
+  const std::vector<u8> input = MakeInput(InputLog::CHUNK_SIZE + 500);
+  std::vector<u8> other_input = input;
+  other_input[InputLog::CHUNK_SIZE + 10] ^= 0xFF;
+
+  InputLog log;
+  log.Write(0, input.data(), input.size());
+  InputLog other;
+  other.Write(0, other_input.data(), other_input.size());
+
+  EXPECT_EQ(log.FindMismatch(other, InputLog::CHUNK_SIZE), std::nullopt);
+  EXPECT_EQ(log.FindMismatch(other, input.size()), InputLog::CHUNK_SIZE + 10);
+
+  log.CopyPrefix(other, InputLog::CHUNK_SIZE + 20);
+  EXPECT_EQ(ReadAll(log), other_input);
+}
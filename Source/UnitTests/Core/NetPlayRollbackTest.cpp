@@ -0,0 +1,317 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/NetPlayRollback.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "InputCommon/GCPadStatus.h"
+#include "UICommon/UICommon.h"
+
+using NetPlay::RollbackInputs;
+
+static GCPadStatus MakeStatus(u16 button)
+{
+  GCPadStatus status;
+  status.button = button;
+  return status;
+}
+
+TEST(NetPlayRollback, UsesConfirmedInputsInOrder)
+{
+  RollbackInputs inputs;
+  inputs.AddConfirmedInput(0, MakeStatus(PAD_BUTTON_A));
+  inputs.AddConfirmedInput(0, MakeStatus(PAD_BUTTON_B));
+
+  EXPECT_EQ(inputs.Poll(0).button, PAD_BUTTON_A);
+  EXPECT_EQ(inputs.Poll(0).button, PAD_BUTTON_B);
+  EXPECT_FALSE(inputs.HasUnconfirmedPolls());
+  EXPECT_FALSE(inputs.HasMisprediction());
+}
+
+TEST(NetPlayRollback, PredictsLastConfirmedInput)
+{
+  RollbackInputs inputs;
+  inputs.AddConfirmedInput(1, MakeStatus(PAD_BUTTON_X));
+  EXPECT_EQ(inputs.Poll(1).button, PAD_BUTTON_X);
+
+  EXPECT_EQ(inputs.Poll(1).button, PAD_BUTTON_X);
+  EXPECT_EQ(inputs.Poll(1).button, PAD_BUTTON_X);
+  EXPECT_TRUE(inputs.HasUnconfirmedPolls());
+
+  // Correct predictions don't require a rollback.
+  inputs.AddConfirmedInput(1, MakeStatus(PAD_BUTTON_X));
+  inputs.AddConfirmedInput(1, MakeStatus(PAD_BUTTON_X));
+  EXPECT_FALSE(inputs.HasUnconfirmedPolls());
+  EXPECT_FALSE(inputs.HasMisprediction());
+}
+
+TEST(NetPlayRollback, RollsBackToBeforeMisprediction)
+{
+  RollbackInputs inputs;
+  inputs.AddConfirmedInput(0, MakeStatus(0));
+  inputs.Poll(0);
+  const RollbackInputs::PollCounts before_prediction = inputs.GetPollCounts();
+
+  inputs.Poll(0);
+  const RollbackInputs::PollCounts after_prediction = inputs.GetPollCounts();
+  inputs.Poll(0);
+
+  inputs.AddConfirmedInput(0, MakeStatus(PAD_BUTTON_START));
+  EXPECT_TRUE(inputs.HasMisprediction());
+  EXPECT_TRUE(inputs.CanRollBackTo(before_prediction));
+  EXPECT_FALSE(inputs.CanRollBackTo(after_prediction));
+
+  inputs.RewindTo(before_prediction);
+  EXPECT_FALSE(inputs.HasMisprediction());
+  EXPECT_EQ(inputs.GetPollCount(0), 1u);
+
+  // The confirmed input is used now, and the input after it is predicted from it.
+  EXPECT_EQ(inputs.Poll(0).button, PAD_BUTTON_START);
+  EXPECT_EQ(inputs.Poll(0).button, PAD_BUTTON_START);
+  EXPECT_TRUE(inputs.HasUnconfirmedPolls());
+}
+
+TEST(NetPlayRollback, DiscardsOldInputs)
+{
+  RollbackInputs inputs;
+  for (u16 i = 0; i < 4; ++i)
+    inputs.AddConfirmedInput(2, MakeStatus(i));
+  inputs.Poll(2);
+  inputs.Poll(2);
+
+  inputs.DiscardBefore(inputs.GetPollCounts());
+  EXPECT_EQ(inputs.Poll(2).button, 2);
+  EXPECT_EQ(inputs.Poll(2).button, 3);
+
+  // Rolling back into the kept range still replays the confirmed inputs.
+  RollbackInputs::PollCounts counts = inputs.GetPollCounts();
+  counts[2] = 2;
+  inputs.RewindTo(counts);
+  EXPECT_EQ(inputs.Poll(2).button, 2);
+}
+
+namespace ResimulationTest
+{
+constexpr s64 FIELD_CYCLES = 10000;
+constexpr u64 COMPARED_FIELDS = 120;
+// Enough fields after the compared ones for all of their inputs to arrive.
+constexpr u64 TOTAL_FIELDS = COMPARED_FIELDS + 16;
+constexpr u32 MAX_ROLLBACK_FRAMES = 8;
+
+// Stands in for the emulated game. Everything it polls and the timing of every field is folded
+// into the hash, so that any difference in either shows up in it.
+struct GameState
+{
+  u64 fields = 0;
+  u64 hash = 0;
+};
+
+static GameState s_game;
+static CoreTiming::EventType* s_field_event = nullptr;
+static NetPlay::RollbackSession* s_session = nullptr;
+
+// These aren't part of the state, they keep going when a rollback happens.
+static std::vector<u64> s_hashes;
+static std::vector<GCPadStatus> s_remote_inputs;
+static u64 s_remote_delay = 0;
+static size_t s_delivered = 0;
+static u64 s_fields_emulated = 0;
+static u64 s_loads = 0;
+static std::vector<std::pair<u32, u64>> s_sent_timebases;
+static std::vector<u32> s_unavailable_timebases;
+
+class TestSession final : public NetPlay::RollbackSession
+{
+public:
+  TestSession() : RollbackSession(MAX_ROLLBACK_FRAMES) {}
+
+protected:
+  size_t SaveState(Core::System& system, Common::UniqueBuffer<u8>& buffer) override
+  {
+    if (buffer.size() < 0x1000)
+      buffer.reset(0x1000);
+
+    u8* ptr = buffer.data();
+    PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+    DoState(system, p);
+    return p.IsWriteMode() ? static_cast<size_t>(ptr - buffer.data()) : 0;
+  }
+
+  void LoadState(Core::System& system, std::span<const u8> state) override
+  {
+    ++s_loads;
+    u8* ptr = const_cast<u8*>(state.data());
+    PointerWrap p(&ptr, state.size(), PointerWrap::Mode::Read);
+    DoState(system, p);
+  }
+
+private:
+  static void DoState(Core::System& system, PointerWrap& p)
+  {
+    system.GetCoreTiming().DoState(p);
+    p.Do(system.GetPPCState().downcount);
+    p.Do(s_game.fields);
+    p.Do(s_game.hash);
+  }
+};
+
+static void MixIntoHash(u64 value)
+{
+  s_game.hash = (s_game.hash ^ value) * 0x100000001b3;
+}
+
+static void FrameEndCallback(Core::System& system)
+{
+  s_session->OnFrameEnd(system);
+
+  for (const auto& timebase : s_session->TakeConfirmedTimeBases())
+    s_sent_timebases.push_back(timebase);
+}
+
+// Polls the pads once per field, like a game which reads its inputs on every retrace.
+static void FieldCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  ++s_fields_emulated;
+
+  // Inputs of the remote player arrive a few fields late, unless no more can be predicted.
+  RollbackInputs& inputs = s_session->GetInputs();
+  while (s_delivered < s_remote_inputs.size() &&
+         (s_delivered + s_remote_delay <= s_fields_emulated ||
+          (inputs.GetPollCount(1) >= inputs.GetConfirmedCount(1) && !s_session->CanPredict(1))))
+  {
+    inputs.AddConfirmedInput(1, s_remote_inputs[s_delivered++]);
+  }
+
+  // Local inputs are known right away. They are kept when rolling back.
+  const u64 local_index = inputs.GetConfirmedCount(0);
+  if (local_index == inputs.GetPollCount(0))
+    inputs.AddConfirmedInput(0, MakeStatus(local_index % 4 == 0 ? PAD_BUTTON_A : 0));
+
+  MixIntoHash(inputs.Poll(0).button);
+  MixIntoHash(inputs.Poll(1).button);
+  MixIntoHash(system.GetCoreTiming().GetTicks());
+  MixIntoHash(static_cast<u64>(lateness));
+
+  ++s_game.fields;
+  s_hashes.resize(std::max<size_t>(s_hashes.size(), s_game.fields));
+  s_hashes[s_game.fields - 1] = s_game.hash;
+
+  const u32 timebase_frame = s_session->CountTimeBaseFrame();
+  if (timebase_frame % 10 == 0)
+    s_session->RecordTimeBase(timebase_frame, s_game.hash);
+
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.RunAtSafePoint(FrameEndCallback);
+  core_timing.ScheduleEvent(FIELD_CYCLES - lateness, s_field_event);
+}
+
+// Returns the hash of the game state after each field, or nothing if setting up failed.
+static std::vector<u64> EmulateFields(u64 remote_delay)
+{
+  const std::string profile_path = File::CreateTempDir();
+  if (profile_path.empty())
+    return {};
+
+  auto& system = Core::System::GetInstance();
+  Core::DeclareAsCPUThread();
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+  system.GetPowerPC().Init(PowerPC::CPUCore::Interpreter);
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.Init();
+
+  s_game = {};
+  s_hashes.clear();
+  s_remote_inputs.clear();
+  for (u64 i = 0; i < TOTAL_FIELDS + MAX_ROLLBACK_FRAMES; ++i)
+    s_remote_inputs.push_back(MakeStatus((i / 5) % 3 == 0 ? PAD_BUTTON_B : PAD_BUTTON_X));
+  s_remote_delay = remote_delay;
+  s_delivered = 0;
+  s_fields_emulated = 0;
+  s_loads = 0;
+  s_sent_timebases.clear();
+  s_unavailable_timebases.clear();
+
+  {
+    TestSession session;
+    s_session = &session;
+    s_field_event = core_timing.RegisterEvent("field", FieldCallback);
+
+    // Enter slice 0
+    core_timing.Advance();
+    core_timing.ScheduleEvent(FIELD_CYCLES, s_field_event);
+
+    auto& ppc_state = system.GetPPCState();
+    while (s_game.fields < TOTAL_FIELDS || session.IsResimulating())
+    {
+      // Pretend the CPU ran past the end of the slice by an amount which depends on the emulated
+      // state, like the last block of a slice would, so that fields are late by varying amounts.
+      ppc_state.downcount = -static_cast<int>(core_timing.GetTicks() % 61);
+      core_timing.Advance();
+    }
+
+    s_unavailable_timebases = session.TakeUnconfirmedTimeBaseFrames();
+    s_session = nullptr;
+  }
+
+  core_timing.Shutdown();
+  system.GetPowerPC().Shutdown();
+  SConfig::Shutdown();
+  Config::Shutdown();
+  Core::UndeclareAsCPUThread();
+  File::DeleteDirRecursively(profile_path);
+
+  s_hashes.resize(COMPARED_FIELDS);
+  return s_hashes;
+}
+}  // namespace ResimulationTest
+
+TEST(NetPlayRollback, ResimulatesToSameState)
+{
+  using namespace ResimulationTest;
+
+  const std::vector<u64> straight = EmulateFields(0);
+  ASSERT_EQ(straight.size(), COMPARED_FIELDS);
+  EXPECT_EQ(s_loads, 0u);
+  const std::vector<std::pair<u32, u64>> straight_timebases = s_sent_timebases;
+
+  const std::vector<u64> rolled_back = EmulateFields(3);
+  ASSERT_EQ(rolled_back.size(), COMPARED_FIELDS);
+  EXPECT_GT(s_loads, 0u);
+
+  for (u64 i = 0; i < COMPARED_FIELDS; ++i)
+    EXPECT_EQ(straight[i], rolled_back[i]) << "Field " << i;
+
+  // Every recorded time base is sent once, with the value it has without mispredictions, or is
+  // reported as unavailable when the session ends.
+  std::vector<u32> reported;
+  for (const auto& [frame, timebase] : s_sent_timebases)
+  {
+    reported.push_back(frame);
+    if (frame < straight.size())
+    {
+      EXPECT_EQ(timebase, straight[frame]) << "Frame " << frame;
+    }
+  }
+  reported.insert(reported.end(), s_unavailable_timebases.begin(), s_unavailable_timebases.end());
+  ASSERT_EQ(reported.size(), straight_timebases.size());
+  for (size_t i = 0; i < reported.size(); ++i)
+    EXPECT_EQ(reported[i], i * 10);
+}
@@ -0,0 +1,150 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DVD/ReadAheadCache.h"
+#include "DiscIO/Volume.h"
+
+using DVD::ReadAheadCache;
+
+namespace
+{
+constexpr u64 DISC_SIZE = 1024 * 1024;
+constexpr u64 BLOCK_SIZE = 16 * 1024;
+
+class FakeDisc
+{
+public:
+  FakeDisc() : m_data(DISC_SIZE)
+  {
+    for (u64 i = 0; i < DISC_SIZE; ++i)
+      m_data[i] = static_cast<u8>(i * 7 + (i >> 8));
+  }
+
+  ReadAheadCache::ReadFunction GetReader(std::atomic<u64>* read_count)
+  {
+    return [this, read_count](u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition&) {
+      if (read_count)
+        ++*read_count;
+      if (offset + length > DISC_SIZE)
+        return false;
+      std::memcpy(out_ptr, m_data.data() + offset, length);
+      return true;
+    };
+  }
+
+  bool Matches(u64 offset, const std::vector<u8>& data) const
+  {
+    return std::memcmp(m_data.data() + offset, data.data(), data.size()) == 0;
+  }
+
+private:
+  std::vector<u8> m_data;
+};
+
+void StartCache(ReadAheadCache* cache, FakeDisc* disc, std::atomic<u64>* direct_reads,
+                std::atomic<u64>* worker_reads, bool workers_fail = false)
+{
+  cache->Start(
+      2, BLOCK_SIZE, 16 * BLOCK_SIZE, disc->GetReader(direct_reads),
+      [disc, worker_reads, workers_fail]() -> ReadAheadCache::ReadFunction {
+        if (workers_fail)
+        {
+          return [worker_reads](u64, u64, u8*, const DiscIO::Partition&) {
+            ++*worker_reads;
+            return false;
+          };
+        }
+        return disc->GetReader(worker_reads);
+      });
+}
+}  // namespace
+
+TEST(ReadAheadCache, ReadsRandomAccessDirectly)
+{
+  FakeDisc disc;
+  std::atomic<u64> direct_reads = 0;
+  std::atomic<u64> worker_reads = 0;
+  ReadAheadCache cache;
+  StartCache(&cache, &disc, &direct_reads, &worker_reads);
+
+  for (const u64 offset : {0x40000, 0x1000, 0x80000, 0x20000})
+  {
+    std::vector<u8> data(0x800);
+    EXPECT_TRUE(cache.Read(offset, data.size(), data.data(), DiscIO::PARTITION_NONE));
+    EXPECT_TRUE(disc.Matches(offset, data));
+  }
+
+  EXPECT_EQ(direct_reads, 4u);
+  EXPECT_EQ(worker_reads, 0u);
+  EXPECT_EQ(cache.GetStats().misses, 4u);
+  EXPECT_EQ(cache.GetStats().blocks_read_ahead, 0u);
+}
+
+TEST(ReadAheadCache, ReadsAheadOfSequentialReads)
+{
+  FakeDisc disc;
+  std::atomic<u64> direct_reads = 0;
+  std::atomic<u64> worker_reads = 0;
+  ReadAheadCache cache;
+  StartCache(&cache, &disc, &direct_reads, &worker_reads);
+
+  constexpr u64 READ_SIZE = 3000;
+  for (u64 offset = 0; offset + READ_SIZE <= DISC_SIZE; offset += READ_SIZE)
+  {
+    std::vector<u8> data(READ_SIZE);
+    ASSERT_TRUE(cache.Read(offset, data.size(), data.data(), DiscIO::PARTITION_NONE));
+    ASSERT_TRUE(disc.Matches(offset, data));
+  }
+
+  const ReadAheadCache::Stats stats = cache.GetStats();
+  EXPECT_GT(stats.hits, stats.misses);
+  EXPECT_GT(stats.blocks_read_ahead, 0u);
+  EXPECT_EQ(direct_reads, stats.misses);
+  EXPECT_GT(worker_reads, 0u);
+}
+
+TEST(ReadAheadCache, FallsBackWhenReadingAheadFails)
+{
+  FakeDisc disc;
+  std::atomic<u64> direct_reads = 0;
+  std::atomic<u64> worker_reads = 0;
+  ReadAheadCache cache;
+  StartCache(&cache, &disc, &direct_reads, &worker_reads, true);
+
+  for (u64 offset = 0; offset < 64 * 1024; offset += 1024)
+  {
+    std::vector<u8> data(1024);
+    ASSERT_TRUE(cache.Read(offset, data.size(), data.data(), DiscIO::PARTITION_NONE));
+    ASSERT_TRUE(disc.Matches(offset, data));
+  }
+
+  EXPECT_EQ(cache.GetStats().hits, 0u);
+  EXPECT_EQ(direct_reads, 64u);
+}
+
+TEST(ReadAheadCache, KeepsPartitionsApart)
+{
+  FakeDisc disc;
+  std::atomic<u64> direct_reads = 0;
+  std::atomic<u64> worker_reads = 0;
+  ReadAheadCache cache;
+  StartCache(&cache, &disc, &direct_reads, &worker_reads);
+
+  // Alternating between partitions never counts as sequential.
+  const DiscIO::Partition partitions[] = {DiscIO::Partition(0x50000), DiscIO::Partition(0xF800000)};
+  for (u64 i = 0; i < 32; ++i)
+  {
+    std::vector<u8> data(1024);
+    ASSERT_TRUE(cache.Read(i / 2 * 1024, data.size(), data.data(), partitions[i % 2]));
+  }
+
+  EXPECT_EQ(cache.GetStats().blocks_read_ahead, 0u);
+  EXPECT_EQ(worker_reads, 0u);
+}
@@ -0,0 +1,126 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Core/StateDelta.h"
+
+namespace
+{
+Common::UniqueBuffer<u8> MakeState(size_t size, u8 seed)
+{
+  Common::UniqueBuffer<u8> state(size);
+  for (size_t i = 0; i < size; ++i)
+    state[i] = static_cast<u8>((i * 7 + seed) ^ (i >> 12));
+  return state;
+}
+
+Common::UniqueBuffer<u8> Copy(const Common::UniqueBuffer<u8>& buffer)
+{
+  Common::UniqueBuffer<u8> copy(buffer.size());
+  std::copy_n(buffer.data(), buffer.size(), copy.data());
+  return copy;
+}
+
+void ExpectRoundTrip(const State::StateDeltaEncoder& encoder, const Common::UniqueBuffer<u8>& state,
+                     std::vector<u8>* delta)
+{
+  encoder.Encode({state.data(), state.size()}, delta);
+
+  Common::UniqueBuffer<u8> decoded;
+  ASSERT_TRUE(State::DecodeStateDelta(encoder.GetKeyframe(), *delta, decoded));
+  ASSERT_EQ(decoded.size(), state.size());
+  EXPECT_EQ(std::memcmp(decoded.data(), state.data(), state.size()), 0);
+}
+}  // namespace
+
+constexpr size_t PAGE_SIZE = State::DELTA_PAGE_SIZE;
+constexpr size_t STATE_SIZE = 64 * PAGE_SIZE + 123;
+
+TEST(StateDelta, IdenticalState)
+{
+  const Common::UniqueBuffer<u8> state = MakeState(STATE_SIZE, 1);
+  State::StateDeltaEncoder encoder;
+  encoder.SetKeyframe(Copy(state));
+
+  std::vector<u8> delta;
+  ExpectRoundTrip(encoder, state, &delta);
+  EXPECT_EQ(encoder.Encode({state.data(), state.size()}, &delta), 0u);
+  EXPECT_LT(delta.size(), 64u);
+}
+
+TEST(StateDelta, ChangedPages)
+{
+  Common::UniqueBuffer<u8> state = MakeState(STATE_SIZE, 2);
+  State::StateDeltaEncoder encoder;
+  encoder.SetKeyframe(Copy(state));
+
+  state[5 * PAGE_SIZE + 17] ^= 0xFF;
+  state[40 * PAGE_SIZE] ^= 0xFF;
+  state[STATE_SIZE - 1] ^= 0xFF;
+
+  std::vector<u8> delta;
+  ExpectRoundTrip(encoder, state, &delta);
+  EXPECT_EQ(encoder.Encode({state.data(), state.size()}, &delta), 2 * PAGE_SIZE + 123);
+  EXPECT_LT(delta.size(), 3 * PAGE_SIZE);
+}
+
+TEST(StateDelta, ShiftedPages)
+{
+  const Common::UniqueBuffer<u8> keyframe = MakeState(STATE_SIZE, 3);
+  State::StateDeltaEncoder encoder;
+  encoder.SetKeyframe(Copy(keyframe));
+
+  // Data in front of the large arrays grew by two pages, the following pages are unchanged.
+  Common::UniqueBuffer<u8> state(STATE_SIZE + 2 * PAGE_SIZE);
+  std::fill_n(state.data(), 3 * PAGE_SIZE, u8{0xAB});
+  std::copy_n(keyframe.data() + PAGE_SIZE, STATE_SIZE - PAGE_SIZE, state.data() + 3 * PAGE_SIZE);
+
+  std::vector<u8> delta;
+  ExpectRoundTrip(encoder, state, &delta);
+  EXPECT_EQ(encoder.Encode({state.data(), state.size()}, &delta), 3 * PAGE_SIZE);
+}
+
+TEST(StateDelta, MalformedDelta)
+{
+  const Common::UniqueBuffer<u8> state = MakeState(STATE_SIZE, 4);
+  State::StateDeltaEncoder encoder;
+  encoder.SetKeyframe(MakeState(STATE_SIZE, 5));
+
+  std::vector<u8> delta;
+  encoder.Encode({state.data(), state.size()}, &delta);
+
+  Common::UniqueBuffer<u8> decoded;
+  std::vector<u8> truncated(delta.begin(), delta.end() - 1);
+  EXPECT_FALSE(State::DecodeStateDelta(encoder.GetKeyframe(), truncated, decoded));
+
+  const Common::UniqueBuffer<u8> other_keyframe = MakeState(STATE_SIZE - 1, 5);
+  EXPECT_FALSE(State::DecodeStateDelta({other_keyframe.data(), other_keyframe.size()}, delta,
+                                       decoded));
+  EXPECT_TRUE(decoded.empty());
+}
+
+TEST(StateDelta, OversizedState)
+{
+  const Common::UniqueBuffer<u8> state = MakeState(STATE_SIZE, 6);
+  State::StateDeltaEncoder encoder;
+  encoder.SetKeyframe(Copy(state));
+
+  std::vector<u8> delta;
+  encoder.Encode({state.data(), state.size()}, &delta);
+
+  // The state size comes first in the delta. A corrupted one must be rejected before anything of
+  // that size is allocated.
+  const u64 huge_size = u64{1} << 50;
+  std::memcpy(delta.data(), &huge_size, sizeof(huge_size));
+
+  Common::UniqueBuffer<u8> decoded;
+  EXPECT_FALSE(State::DecodeStateDelta(encoder.GetKeyframe(), delta, decoded));
+  EXPECT_TRUE(decoded.empty());
+}